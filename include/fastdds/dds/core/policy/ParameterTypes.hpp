@@ -1148,6 +1148,13 @@ const std::string parameter_property_ds_version = "DS_VERSION";
  */
 const std::string parameter_property_current_ds_version = "2.0";
 
+/**
+ * Parameter property ID for the locator kinds on which a participant receives compressed messages
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_property_compression_locator_kinds = "fastdds.compression.locator_kinds";
+
 /**
  * Parameter property value for Host physical data
  *
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_DDS_LOG_LOG_HPP_
 #define _FASTDDS_DDS_LOG_LOG_HPP_
 
+#include <cstdint>
 #include <regex>
 #include <sstream>
 
@@ -93,6 +94,17 @@ public:
         Info,
     };
 
+    /**
+     * Policies applied when the queue of entries pending to be consumed is full.
+     * * Block: The thread logging an entry waits until it can be queued.
+     * * Drop: The entry is discarded and counted as dropped.
+     */
+    enum QueueFullPolicy
+    {
+        Block,
+        Drop,
+    };
+
     /**
      * Registers an user defined consumer to route log output.
      * There is a default stdout consumer active as default.
@@ -159,6 +171,13 @@ public:
     //! Stops the logging thread. It will re-launch on the next call to a successful log macro.
     FASTDDS_EXPORTED_API static void KillThread();
 
+    //! Sets the policy applied when the queue of pending entries is full. Block by default.
+    FASTDDS_EXPORTED_API static void SetQueueFullPolicy(
+            Log::QueueFullPolicy);
+
+    //! Returns the number of entries dropped because the queue of pending entries was full.
+    FASTDDS_EXPORTED_API static uint64_t GetDroppedEntries();
+
     // Note: In VS2013, if you're linking this class statically, you will have to call KillThread before leaving
     // main, due to an unsolved MSVC bug.
 
@@ -183,9 +202,6 @@ public:
      *  * EPROSIMA_LOG_INFO(cat, msg);
      *  * EPROSIMA_LOG_WARNING(cat, msg);
      *  * EPROSIMA_LOG_ERROR(cat, msg);
-     *
-     * @todo this method takes 2 mutexes (same mutex) internally.
-     * This is a very high sensible point of the code and it should be refactored to be as efficient as possible.
      */
     FASTDDS_EXPORTED_API static void QueueLog(
             const std::string& message,
@@ -93,6 +93,9 @@ public:
 
     //! Thread settings for the data-sharing listener thread
     fastdds::rtps::ThreadSettings data_sharing_listener_thread {};
+
+    //! Time the data-sharing listener polls for new data before blocking (microseconds). Zero disables polling.
+    uint32_t data_sharing_listener_spin_budget_us = 0;
 };
 
 } /* namespace rtps */
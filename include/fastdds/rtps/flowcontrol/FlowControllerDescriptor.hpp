@@ -55,6 +55,25 @@ struct FlowControllerDescriptor
     //! Default value: 100ms.
     uint64_t period_ms = 100;
 
+    //! Maximum number of bytes that can be sent in a burst.
+    //!
+    //! When set along with max_bytes_per_period, samples are paced with a token bucket refilled continuously at the
+    //! rate of max_bytes_per_period every period_ms, instead of sending max_bytes_per_period at the start of each
+    //! period.
+    //! 0 value means the bandwidth limitation is applied per period.
+    //! Default value: 0
+    uint32_t max_burst_bytes = 0;
+
+    //! Number of asynchronous sender threads.
+    //!
+    //! Writers are distributed among the threads, which share the bandwidth limitation, so a single writer can use
+    //! all of it. Each writer is always sent by the same thread, so its samples keep their order.
+    //! Only one is allowed with the HIGH_PRIORITY and PRIORITY_WITH_RESERVATION schedulers, which order all the
+    //! writers.
+    //! Ignored by synchronous flow controllers.
+    //! Default value: 1
+    uint32_t sender_threads = 1;
+
     //! Thread settings for the sender thread
     ThreadSettings sender_thread;
 
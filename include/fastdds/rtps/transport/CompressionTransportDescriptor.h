@@ -0,0 +1,91 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_COMPRESSIONTRANSPORTDESCRIPTOR_H_
+#define _FASTDDS_RTPS_TRANSPORT_COMPRESSIONTRANSPORTDESCRIPTOR_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "ChainingTransportDescriptor.h"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+//! When the compression transport compresses the messages carrying user data.
+enum class CompressionMode : uint8_t
+{
+    //! Never compress. Compressed messages are still received.
+    NONE,
+    //! Compress every message carrying user data, unless compressing it does not save any byte.
+    ALWAYS,
+    //! Like ALWAYS, but after a message which does not compress well, the following ones are sent uncompressed.
+    ADAPTIVE
+};
+
+/**
+ * Descriptor of the compression transport, a chaining transport which compresses the RTPS messages carrying user
+ * data with a fast LZ codec before handing them to the low level transport.
+ *
+ * Every compressed message starts with its own header, describing the codec and the size of the original message,
+ * so the receiving side tells compressed messages from plain RTPS ones. Messages with no user data, like discovery,
+ * heartbeats or acknacks, are always sent uncompressed.
+ *
+ * Participants with this transport announce it in discovery, and messages are only compressed for the unicast
+ * locators of the participants which announced it. The rest of the destinations, including multicast ones, receive
+ * them uncompressed.
+ *
+ * Transport configuration:
+ *
+ * - low_level_descriptor: Descriptor for lower level transport.
+ * - mode: When messages are compressed.
+ * - min_size: Messages smaller than this are not compressed.
+ * - min_savings_percent: Minimum percentage of bytes a message has to save for ADAPTIVE mode to keep compressing.
+ * - adaptive_skip: Messages sent uncompressed by ADAPTIVE mode after one which did not compress well.
+ * @ingroup TRANSPORT_MODULE
+ */
+struct CompressionTransportDescriptor : public ChainingTransportDescriptor
+{
+    FASTDDS_EXPORTED_API CompressionTransportDescriptor(
+            std::shared_ptr<TransportDescriptorInterface> low_level)
+        : ChainingTransportDescriptor(low_level)
+    {
+    }
+
+    FASTDDS_EXPORTED_API CompressionTransportDescriptor(
+            const CompressionTransportDescriptor& t) = default;
+
+    FASTDDS_EXPORTED_API virtual ~CompressionTransportDescriptor() = default;
+
+    FASTDDS_EXPORTED_API TransportInterface* create_transport() const override;
+
+    //! When messages are compressed. Default value: NONE
+    CompressionMode mode = CompressionMode::NONE;
+
+    //! Messages smaller than this are not compressed. Default value: 512
+    uint32_t min_size = 512;
+
+    //! Minimum percentage of bytes a message has to save for ADAPTIVE mode to keep compressing. Default value: 10
+    uint32_t min_savings_percent = 10;
+
+    //! Messages sent uncompressed by ADAPTIVE mode after one which did not compress well. Default value: 32
+    uint32_t adaptive_skip = 32;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_COMPRESSIONTRANSPORTDESCRIPTOR_H_
@@ -296,6 +296,19 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
      */
     bool non_blocking_send;
 
+    /**
+     * Number of threads serving the reception of all the connections of the transport.
+     *
+     * When set to zero, which is the default, a reception thread is created for each connection, which performs
+     * blocking reads on it.
+     *
+     * When set to a positive value, connections are read without blocking by a fixed pool of this many threads, in
+     * addition to the one accepting connections. This reduces the resources used by transports with many connections,
+     * like the one of a discovery server, but the processing of an incoming message delays the reception on the other
+     * connections served by the same thread. Connections using TLS always have their own reception thread.
+     */
+    uint32_t reactor_threads;
+
     //! Add listener port to the listening_ports list
     void add_listener_port(
             uint16_t port)
@@ -31,6 +31,10 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c receive_batch_size: maximum number of datagrams drained from an input socket on each receive call.
+ *
+ * - \c send_batch_size: maximum number of datagrams handed to the kernel on each send call.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +72,31 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Maximum number of datagrams read from an input socket on each receive system call.
+     *
+     * When greater than 1, each input channel preallocates this number of receive buffers of
+     * maxMessageSize bytes, fills as many of them as are already queued on the socket with a single
+     * system call (recvmmsg), and then dispatches the received datagrams in arrival order.
+     * This reduces the number of system calls on high-rate topics at the cost of the extra memory.
+     *
+     * Batched reception is only available on Linux. On other platforms, and when set to 0 or 1,
+     * datagrams are received one at a time.
+     */
+    uint32_t receive_batch_size = 1;
+
+    /**
+     * Maximum number of datagrams written to an output socket on each send system call.
+     *
+     * When greater than 1, a message that has to be delivered to several destinations through the same socket
+     * (e.g. a best-effort writer with many unicast readers) is sent to all of them with as few system calls
+     * (sendmmsg) as possible, instead of calling send_to() once per destination.
+     *
+     * Batched sending is only available on Linux. On other platforms, and when set to 0 or 1,
+     * datagrams are sent one at a time.
+     */
+    uint32_t send_batch_size = 1;
 };
 
 } // namespace rtps
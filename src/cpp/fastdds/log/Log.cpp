@@ -13,10 +13,12 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include <fastdds/dds/log/Colors.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -24,7 +26,7 @@
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 
-#include <utils/DBQueue.hpp>
+#include "LogQueue.hpp"
 #include <utils/SystemInfo.hpp>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
@@ -36,13 +38,19 @@ namespace detail {
 
 struct LogResources
 {
+    //! Number of entries the queue can hold until they are consumed
+    static constexpr size_t queue_capacity = 1024u;
+
     LogResources()
-        : logging_(false)
+        : logs_(queue_capacity)
+        , logging_(false)
         , work_(false)
-        , current_loop_(0)
+        , consumer_waiting_(false)
         , filenames_(false)
         , functions_(true)
         , verbosity_(Log::Error)
+        , queue_full_policy_(Log::Block)
+        , dropped_entries_(0u)
     {
 #if STDOUTERR_LOG_CONSUMER
         consumers_.emplace_back(new StdoutErrConsumer);
@@ -186,6 +194,8 @@ struct LogResources
         functions_ = true;
         verbosity_ = Log::Error;
         consumers_.clear();
+        queue_full_policy_ = Log::Block;
+        dropped_entries_ = 0u;
 
 #if STDOUTERR_LOG_CONSUMER
         consumers_.emplace_back(new StdoutErrConsumer);
@@ -194,6 +204,19 @@ struct LogResources
 #endif // if STDOUTERR_LOG_CONSUMER
     }
 
+    //! Sets the policy applied when the queue of pending entries is full.
+    void SetQueueFullPolicy(
+            Log::QueueFullPolicy policy)
+    {
+        queue_full_policy_ = policy;
+    }
+
+    //! Returns the number of entries dropped because the queue of pending entries was full.
+    uint64_t GetDroppedEntries()
+    {
+        return dropped_entries_;
+    }
+
     //! Waits until all info logged up to the call time is consumed
     void Flush()
     {
@@ -205,33 +228,15 @@ struct LogResources
             return;
         }
 
-        /*   Flush() two steps strategy:
-
-             I must assure Log::Run swaps the queues because only swapping the queues the background content
-             will be consumed (first Run() loop).
-
-             Then, I must assure the new front queue content is consumed (second Run() loop).
-         */
-
-        int last_loop = -1;
-
-        for (int i = 0; i < 2; ++i)
-        {
-            cv_.wait(guard,
-                    [&]()
-                    {
-                        /* I must avoid:
-                         + the two calls be processed without an intermediate Run() loop (by using last_loop sequence number)
-                         + deadlock by absence of Run() loop activity (by using BothEmpty() call)
-                         */
-                        return !logging_ ||
-                        (logs_.Empty() &&
-                        (last_loop != current_loop_ || logs_.BothEmpty()));
-                    });
-
-            last_loop = current_loop_;
-
-        }
+        // Entries still being written by their producers are also waited for
+        uint64_t pushed = logs_.pushed();
+        work_ = true;
+        cv_.notify_all();
+        cv_.wait(guard,
+                [&]()
+                {
+                    return !logging_ || logs_.popped() >= pushed;
+                });
     }
 
     /**
@@ -239,9 +244,6 @@ struct LogResources
      *  * EPROSIMA_LOG_INFO(cat, msg);
      *  * EPROSIMA_LOG_WARNING(cat, msg);
      *  * EPROSIMA_LOG_ERROR(cat, msg);
-     *
-     * @todo this method takes 2 mutexes (same mutex) internally.
-     * This is a very high sensible point of the code and it should be refactored to be as efficient as possible.
      */
     void QueueLog(
             const std::string& message,
@@ -250,18 +252,35 @@ struct LogResources
     {
         StartThread();
 
-        std::string timestamp = SystemInfo::get_timestamp();
-        logs_.Push(Log::Entry{ message, context, kind, timestamp });
+        auto timestamp = std::chrono::system_clock::now();
+        while (!logs_.try_push(message, context, kind, timestamp))
         {
+            if (Log::Drop == queue_full_policy_)
+            {
+                ++dropped_entries_;
+                return;
+            }
+
             std::unique_lock<std::mutex> guard(cv_mutex_);
+            // Entries logged by the consumers cannot wait for themselves
+            if (!logging_ || logging_thread_.is_calling_thread())
+            {
+                ++dropped_entries_;
+                return;
+            }
+
+            // Wait for the logging thread to make room, which notifies after each round of entries
+            work_ = true;
+            cv_.notify_all();
+            cv_.wait_for(guard, std::chrono::milliseconds(1));
+        }
+
+        // Only wake the logging thread up when it is waiting for entries
+        if (consumer_waiting_)
+        {
+            std::lock_guard<std::mutex> guard(cv_mutex_);
             work_ = true;
-            // pessimization
             cv_.notify_all();
-            // wait till the thread is initialized
-            cv_.wait(guard, [&]
-                    {
-                        return current_loop_;
-                    });
         }
     }
 
@@ -288,6 +307,11 @@ private:
 
     void StartThread()
     {
+        if (logging_)
+        {
+            return;
+        }
+
         std::unique_lock<std::mutex> guard(cv_mutex_);
         if (!logging_ && !logging_thread_.joinable())
         {
@@ -306,47 +330,70 @@ private:
 
         while (logging_)
         {
+            // Producers check this flag after queueing an entry, and the queue is checked after setting it, so an
+            // entry is either seen here or its producer wakes this thread up
+            consumer_waiting_ = true;
             cv_.wait(guard,
                     [&]()
                     {
-                        return !logging_ || work_;
+                        return !logging_ || work_ || !logs_.empty();
                     });
+            consumer_waiting_ = false;
 
             work_ = false;
 
             guard.unlock();
             {
-                logs_.Swap();
-                while (!logs_.Empty())
+                std::chrono::system_clock::time_point time;
+                Log::Entry* entry = nullptr;
+                while (nullptr != (entry = logs_.front(time)))
                 {
-                    Log::Entry& entry = logs_.Front();
+                    // Timestamps are formatted here to keep it away from the threads logging
+                    set_timestamp(*entry, time);
                     {
                         std::unique_lock<std::mutex> configGuard(config_mutex_);
 
-                        if (preprocess(entry))
+                        if (preprocess(*entry))
                         {
                             for (auto& consumer : consumers_)
                             {
-                                consumer->Consume(entry);
+                                consumer->Consume(*entry);
                             }
                         }
                     }
-                    // This Pop() is also a barrier for Log::Flush wait condition
-                    logs_.Pop();
+                    // This pop() is also a barrier for Log::Flush wait condition
+                    logs_.pop();
                 }
             }
             guard.lock();
 
-            // avoid overflow
-            if (++current_loop_ > 10000)
-            {
-                current_loop_ = 0;
-            }
-
             cv_.notify_all();
         }
     }
 
+    /**
+     * Format the timestamp of an entry, reusing the part up to the seconds while they do not change.
+     */
+    void set_timestamp(
+            Log::Entry& entry,
+            const std::chrono::system_clock::time_point& time)
+    {
+        auto second = std::chrono::time_point_cast<std::chrono::seconds>(time);
+        if (timestamp_prefix_.empty() || second != timestamp_second_)
+        {
+            // Everything but the milliseconds
+            std::string timestamp = SystemInfo::get_timestamp(time);
+            timestamp_prefix_.assign(timestamp, 0, timestamp.size() - 3u);
+            timestamp_second_ = second;
+        }
+
+        char milliseconds[4];
+        snprintf(milliseconds, sizeof(milliseconds), "%03u",
+                static_cast<unsigned>((time - second) / std::chrono::milliseconds(1)) % 1000u);
+        entry.timestamp.assign(timestamp_prefix_);
+        entry.timestamp.append(milliseconds);
+    }
+
     bool preprocess(
             Log::Entry& entry)
     {
@@ -374,16 +421,20 @@ private:
         return true;
     }
 
-    DBQueue<Log::Entry> logs_;
+    LogQueue logs_;
     std::vector<std::unique_ptr<LogConsumer>> consumers_;
     eprosima::thread logging_thread_;
 
     // Condition variable segment.
     std::condition_variable cv_;
     std::mutex cv_mutex_;
-    bool logging_;
+    std::atomic<bool> logging_;
     bool work_;
-    int current_loop_;
+    std::atomic<bool> consumer_waiting_;
+
+    // Timestamp formatting segment, only used by the logging thread.
+    std::string timestamp_prefix_;
+    std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds> timestamp_second_;
 
     // Context configuration.
     std::mutex config_mutex_;
@@ -395,8 +446,14 @@ private:
 
     std::atomic<Log::Kind> verbosity_;
     rtps::ThreadSettings thread_settings_;
+
+    // Queue full segment.
+    std::atomic<Log::QueueFullPolicy> queue_full_policy_;
+    std::atomic<uint64_t> dropped_entries_;
 };
 
+constexpr size_t LogResources::queue_capacity;
+
 const std::shared_ptr<LogResources>& get_log_resources()
 {
     static std::shared_ptr<LogResources> instance = std::make_shared<LogResources>();
@@ -443,6 +500,17 @@ void Log::KillThread()
     detail::get_log_resources()->KillThread();
 }
 
+void Log::SetQueueFullPolicy(
+        Log::QueueFullPolicy policy)
+{
+    detail::get_log_resources()->SetQueueFullPolicy(policy);
+}
+
+uint64_t Log::GetDroppedEntries()
+{
+    return detail::get_log_resources()->GetDroppedEntries();
+}
+
 void Log::QueueLog(
         const std::string& message,
         const Log::Context& context,
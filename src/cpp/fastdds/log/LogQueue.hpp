@@ -0,0 +1,183 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_LOG__LOGQUEUE_HPP
+#define FASTDDS_LOG__LOGQUEUE_HPP
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Bounded queue of log entries, with many producers and a single consumer.
+ *
+ * Entries are written directly on preallocated slots of a ring, claimed by producers with a single atomic operation.
+ * Slots keep the buffers of their strings, so once they have held a message as long as the ones being logged, adding
+ * an entry does not allocate memory.
+ */
+class LogQueue
+{
+public:
+
+    /**
+     * @param capacity  Number of slots on the ring. Should be a power of two.
+     */
+    explicit LogQueue(
+            size_t capacity)
+        : slots_(new Slot[capacity])
+        , mask_(capacity - 1u)
+    {
+        assert(0u < capacity && 0u == (capacity & mask_));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogQueue(
+            const LogQueue&) = delete;
+
+    LogQueue& operator =(
+            const LogQueue&) = delete;
+
+    /**
+     * Add an entry. Can be called from any thread.
+     *
+     * @return false if the queue is full, true otherwise.
+     */
+    bool try_push(
+            const std::string& message,
+            const Log::Context& context,
+            Log::Kind kind,
+            const std::chrono::system_clock::time_point& time)
+    {
+        uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &slots_[pos & mask_];
+            uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence == pos)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (sequence < pos)
+            {
+                // The consumer has not released this slot yet
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->entry.message.assign(message);
+        slot->entry.context = context;
+        slot->entry.kind = kind;
+        slot->time = time;
+        // Sequentially consistent, to pair with the check of a sleeping consumer done afterwards
+        slot->sequence.store(pos + 1u);
+        return true;
+    }
+
+    /**
+     * Get the oldest entry, leaving it on the queue. Should only be called from the consumer thread.
+     *
+     * @param [out] time  Point in time the entry was added at.
+     *
+     * @return The oldest entry, or nullptr if there is none ready.
+     */
+    Log::Entry* front(
+            std::chrono::system_clock::time_point& time)
+    {
+        Slot& slot = slots_[dequeue_pos_.load(std::memory_order_relaxed) & mask_];
+        if (slot.sequence.load() != dequeue_pos_.load(std::memory_order_relaxed) + 1u)
+        {
+            return nullptr;
+        }
+
+        time = slot.time;
+        return &slot.entry;
+    }
+
+    /**
+     * Remove the entry returned by front(), making its slot available for producers.
+     * Should only be called from the consumer thread.
+     */
+    void pop()
+    {
+        uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        slots_[pos & mask_].sequence.store(pos + mask_ + 1u, std::memory_order_release);
+        dequeue_pos_.store(pos + 1u, std::memory_order_release);
+    }
+
+    //! Whether there are no entries ready for the consumer.
+    bool empty() const
+    {
+        uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        return slots_[pos & mask_].sequence.load() != pos + 1u;
+    }
+
+    //! Number of entries added or being added since the queue was created.
+    uint64_t pushed() const
+    {
+        return enqueue_pos_.load(std::memory_order_acquire);
+    }
+
+    //! Number of entries removed since the queue was created.
+    uint64_t popped() const
+    {
+        return dequeue_pos_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    struct Slot
+    {
+        //! Position the slot can be claimed for, or that position plus one once its entry is ready
+        std::atomic<uint64_t> sequence;
+        Log::Entry entry;
+        std::chrono::system_clock::time_point time;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    uint64_t mask_;
+
+    //! Position of the next slot to claim, on its own cache line as producers contend on it
+    alignas(64) std::atomic<uint64_t> enqueue_pos_{0u};
+    //! Position of the next slot to consume
+    alignas(64) std::atomic<uint64_t> dequeue_pos_{0u};
+};
+
+}  // namespace detail
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // FASTDDS_LOG__LOGQUEUE_HPP
@@ -61,6 +61,7 @@ DataWriterHistory::DataWriterHistory(
         MemoryManagementPolicy_t mempolicy,
         std::function<void (const fastdds::rtps::InstanceHandle_t&)> unack_sample_remove_functor)
     : WriterHistory(to_history_attributes(topic_att, payloadMaxSize, mempolicy))
+    , keyed_changes_(topic_att.resourceLimitsQos)
     , history_qos_(topic_att.historyQos)
     , resource_limited_qos_(topic_att.resourceLimitsQos)
     , topic_att_(topic_att)
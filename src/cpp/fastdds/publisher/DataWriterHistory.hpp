@@ -30,6 +30,7 @@
 #include <fastdds/rtps/attributes/ResourceManagement.hpp>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <fastdds/utils/InstanceHashTable.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -237,9 +238,9 @@ public:
 
 private:
 
-    typedef std::map<rtps::InstanceHandle_t, detail::DataWriterInstance> t_m_Inst_Caches;
+    typedef detail::InstanceHashTable<detail::DataWriterInstance> t_m_Inst_Caches;
 
-    //!Map where keys are instance handles and values are vectors of cache changes associated
+    //!Hash table where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
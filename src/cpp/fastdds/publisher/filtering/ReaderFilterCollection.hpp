@@ -42,6 +42,9 @@
 
 #include <utils/collections/node_size_helpers.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -120,14 +123,24 @@ public:
             info.sample_identity.writer_guid(change.writerGUID);
             info.sample_identity.sequence_number(change.sequenceNumber);
 
+            // Readers whose expressions only differ on the parameters share the values of the fields
+            group_sources_.clear();
+
             // Functor used from the serialization process to evaluate each filter and write its signature.
-            auto filter_process = [this, &change, &info](
+            auto it = reader_filters_.cbegin();
+            std::size_t it_index = 0;
+            auto filter_process = [this, &change, &info, &it, &it_index](
                 std::size_t i,
                 uint8_t* signature) -> bool
                     {
-                        // Point to the corresponding entry
-                        auto it = reader_filters_.cbegin();
-                        std::advance(it, i);
+                        // Point to the corresponding entry. Filters are usually processed in order.
+                        if (i < it_index)
+                        {
+                            it = reader_filters_.cbegin();
+                            it_index = 0;
+                        }
+                        std::advance(it, i - it_index);
+                        it_index = i;
                         const ReaderFilterInformation& entry = it->second;
 
                         // Copy the signature
@@ -138,7 +151,7 @@ public:
                         if (fastdds::rtps::ALIVE == change.kind)
                         {
                             // Evaluate filter and update filtered_out_readers
-                            filter_result = entry.filter->evaluate(change.serializedPayload, info, it->first);
+                            filter_result = evaluate(entry, it->first, change, info);
                             if (!filter_result)
                             {
                                 change.filtered_out_readers.emplace_back(it->first);
@@ -248,6 +261,75 @@ public:
 
 private:
 
+    /**
+     * Evaluate the filter of a reader on a change.
+     * The fields of a DDS-SQL expression are only read once per group of readers using the same expression.
+     *
+     * @param [in] entry   Filtering information of the reader.
+     * @param [in] guid    GUID of the reader.
+     * @param [in] change  Change being filtered.
+     * @param [in] info    Information about the change.
+     *
+     * @return Whether the change should be delivered to the reader.
+     */
+    bool evaluate(
+            const ReaderFilterInformation& entry,
+            const fastdds::rtps::GUID_t& guid,
+            const DataWriterFilteredChange& change,
+            const IContentFilter::FilterSampleInfo& info) const
+    {
+        if (nullptr != entry.sql_expression)
+        {
+            for (const auto& source : group_sources_)
+            {
+                if (source.first == entry.filter_group)
+                {
+                    return entry.sql_expression->evaluate_with_fields_of(*source.second);
+                }
+            }
+
+            bool result = false;
+            if (entry.sql_expression->evaluate_all_fields(change.serializedPayload, result))
+            {
+                group_sources_.emplace_back(entry.filter_group, entry.sql_expression);
+                return result;
+            }
+        }
+
+        return entry.filter->evaluate(change.serializedPayload, info, guid);
+    }
+
+    /**
+     * Assign the evaluation group of an entry.
+     * Entries using the same DDS-SQL expression, maybe with different parameters, belong to the same group.
+     *
+     * @param [in,out] entry  The ReaderFilterInformation entry to update.
+     */
+    void update_group(
+            ReaderFilterInformation& entry)
+    {
+        entry.sql_expression = dynamic_cast<const DDSSQLFilter::DDSFilterExpression*>(entry.filter);
+        entry.filter_group = 0;
+        if (nullptr == entry.sql_expression)
+        {
+            return;
+        }
+
+        for (const auto& item : reader_filters_)
+        {
+            const ReaderFilterInformation& other = item.second;
+            if (&other != &entry && nullptr != other.sql_expression &&
+                    other.filter_factory == entry.filter_factory &&
+                    other.filter_expression == entry.filter_expression)
+            {
+                entry.filter_group = other.filter_group;
+                return;
+            }
+        }
+
+        entry.filter_group = ++last_filter_group_;
+    }
+
     /**
      * Ensure a filter instance is removed before an information entry is removed.
      *
@@ -326,6 +408,8 @@ private:
         entry.filter_signature = new_signature;
         entry.filter_factory = new_factory;
         entry.filter = new_filter;
+        entry.filter_expression = filter_info.filter_expression;
+        update_group(entry);
 
         return true;
     }
@@ -338,6 +422,12 @@ private:
     foonathan::memory::map<fastdds::rtps::GUID_t, ReaderFilterInformation, pool_allocator_t> reader_filters_;
 
     std::size_t max_filters_;
+
+    /// Last group assigned to a DDS-SQL expression
+    uint32_t last_filter_group_ = 0;
+
+    /// Expressions whose fields have been read for the change being filtered, with their group
+    mutable std::vector<std::pair<uint32_t, const DDSSQLFilter::DDSFilterExpression*>> group_sources_;
 };
 
 }  // namespace dds
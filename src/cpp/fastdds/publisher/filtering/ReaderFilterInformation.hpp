@@ -21,12 +21,15 @@
 
 #include <array>
 #include <cstdint>
+#include <string>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
 
 #include <fastdds/dds/topic/IContentFilter.hpp>
 #include <fastdds/dds/topic/IContentFilterFactory.hpp>
 
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -37,6 +40,11 @@ struct ReaderFilterInformation
     IContentFilterFactory* filter_factory = nullptr;
     IContentFilter* filter = nullptr;
     std::array<uint8_t, 16> filter_signature{ { 0 } };
+    std::string filter_expression;
+    /// Set when the filter is a DDS-SQL expression, whose field values can be shared with other readers
+    const DDSSQLFilter::DDSFilterExpression* sql_expression = nullptr;
+    /// Entries with the same group use the same expression with different parameters
+    uint32_t filter_group = 0;
 };
 
 }  // namespace dds
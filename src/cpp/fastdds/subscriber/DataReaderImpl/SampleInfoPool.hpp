@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <vector>
 
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
@@ -28,76 +30,86 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
-#include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace dds {
 namespace detail {
 
+/**
+ * Pool of the SampleInfo structures loaned to the user on read / take operations.
+ * Structures are allocated in contiguous blocks, and getting or returning one of them does not depend on the number
+ * of outstanding loans.
+ */
 struct SampleInfoPool
 {
     explicit SampleInfoPool(
             const DataReaderQos& qos)
-        : free_items_(qos.reader_resource_limits().sample_infos_allocation)
-        , used_items_(qos.reader_resource_limits().sample_infos_allocation)
+        : limits_(qos.reader_resource_limits().sample_infos_allocation)
     {
-        for (size_t n = 0; n < qos.reader_resource_limits().sample_infos_allocation.initial; ++n)
-        {
-            free_items_.push_back(new SampleInfo());
-        }
-    }
-
-    ~SampleInfoPool()
-    {
-        for (SampleInfo* it : free_items_)
-        {
-            delete it;
-        }
+        free_items_.reserve(limits_.initial);
+        add_block(limits_.initial);
     }
 
     size_t num_allocated()
     {
-        return used_items_.size();
+        return num_used_;
     }
 
     SampleInfo* get_item()
     {
-        SampleInfo** result = nullptr;
-
         if (free_items_.empty())
         {
-            result = used_items_.push_back(new SampleInfo());
-        }
-        else
-        {
-            result = used_items_.push_back(free_items_.back());
-            static_cast<void>(result);
-            assert(result != nullptr);
-            free_items_.pop_back();
+            // Grow geometrically, so large reads do not allocate their infos one by one
+            size_t num_items = num_used_;
+            if (num_items >= limits_.maximum)
+            {
+                return nullptr;
+            }
+            add_block(std::min(std::max(limits_.increment, num_items), limits_.maximum - num_items));
         }
 
-        return result ? *result : nullptr;
+        SampleInfo* result = free_items_.back();
+        free_items_.pop_back();
+        ++num_used_;
+        return result;
     }
 
     void return_item(
             SampleInfo* item)
     {
-        bool removed = used_items_.remove(item);
-        static_cast<void>(removed);
-        assert(removed);
-
-        SampleInfo** result = free_items_.push_back(item);
-        static_cast<void>(result);
-        assert(result != nullptr);
+        assert(0 < num_used_);
+        --num_used_;
+        free_items_.push_back(item);
     }
 
 private:
 
-    using collection_type = eprosima::fastdds::ResourceLimitedVector<SampleInfo*>;
+    eprosima::fastdds::ResourceLimitedContainerConfig limits_;
+    std::vector<std::unique_ptr<SampleInfo[]>> blocks_;
+    std::vector<SampleInfo*> free_items_;
+    size_t num_used_ = 0;
+
+    void add_block(
+            size_t num_items)
+    {
+        if (0 == num_items)
+        {
+            return;
+        }
+
+        blocks_.emplace_back(new SampleInfo[num_items]);
+        SampleInfo* block = blocks_.back().get();
+
+        // Pushed in reverse order, so consecutive calls to get_item return consecutive items
+        size_t n = num_items;
+        while (n > 0)
+        {
+            --n;
+            free_items_.push_back(&block[n]);
+        }
+    }
 
-    collection_type free_items_;
-    collection_type used_items_;
 };
 
 } /* namespace detail */
@@ -19,8 +19,11 @@
 #ifndef _FASTDDS_SUBSCRIBER_DATAREADERIMPL_SAMPLELOANMANAGER_HPP_
 #define _FASTDDS_SUBSCRIBER_DATAREADERIMPL_SAMPLELOANMANAGER_HPP_
 
-#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
@@ -30,7 +33,6 @@
 #include <fastdds/rtps/history/IPayloadPool.h>
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
-#include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
 #include <rtps/history/PoolConfig.h>
 
@@ -39,12 +41,16 @@ namespace fastdds {
 namespace dds {
 namespace detail {
 
+/**
+ * Pool of the samples loaned to the user on read / take operations.
+ * Loaned samples are indexed by their address, so returning them does not depend on the number of outstanding loans.
+ * The index is sized together with the pool, so loaning and returning a sample do not allocate memory.
+ */
 struct SampleLoanManager
 {
     using CacheChange_t = eprosima::fastdds::rtps::CacheChange_t;
     using IPayloadPool = eprosima::fastdds::rtps::IPayloadPool;
     using PoolConfig = eprosima::fastdds::rtps::PoolConfig;
-    using SampleIdentity = eprosima::fastdds::rtps::SampleIdentity;
     using SerializedPayload_t = eprosima::fastdds::rtps::SerializedPayload_t;
 
     SampleLoanManager(
@@ -55,70 +61,54 @@ struct SampleLoanManager
         , limits_(pool_config.initial_size,
                 pool_config.maximum_size ? pool_config.maximum_size : std::numeric_limits<size_t>::max(),
                 1)
-        , free_loans_(limits_)
-        , used_loans_(limits_)
         , type_(type)
     {
+        items_.reserve(limits_.initial);
+        free_loans_.reserve(limits_.initial);
         for (size_t n = 0; n < limits_.initial; ++n)
         {
-            OutstandingLoanItem item;
-            if (!is_plain_)
-            {
-                item.sample = type_->createData();
-            }
-            free_loans_.push_back(std::move(item));
+            free_loans_.push_back(create_item());
         }
+        resize_used_loans();
     }
 
     ~SampleLoanManager()
     {
         if (!is_plain_)
         {
-            for (const OutstandingLoanItem& item : free_loans_)
+            for (OutstandingLoanItem* item : free_loans_)
             {
-                type_->deleteData(item.sample);
+                type_->deleteData(item->sample);
             }
         }
     }
 
     int32_t num_allocated() const
     {
-        assert(used_loans_.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()));
-        return static_cast<int32_t>(used_loans_.size());
+        assert(num_used_loans_ <= static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+        return static_cast<int32_t>(num_used_loans_);
     }
 
     void get_loan(
             CacheChange_t* change,
             void*& sample)
     {
-        // Early return an already loaned item
-        OutstandingLoanItem* item = find_by_change(change);
-        if (nullptr != item)
-        {
-            item->num_refs += 1;
-            sample = item->sample;
-            return;
-        }
+        OutstandingLoanItem* item = nullptr;
 
         // Get an item from the pool
         if (free_loans_.empty())
         {
             // Try to create a new entry
-            item = used_loans_.push_back({});
-            if (nullptr != item)
+            if (items_.size() < limits_.maximum)
             {
-                // Create sample if necessary
-                if (!is_plain_)
-                {
-                    item->sample = type_->createData();
-                }
+                item = create_item();
+                resize_used_loans();
             }
         }
         else
         {
             // Reuse a free entry
-            item = used_loans_.push_back(std::move(free_loans_.back()));
-            assert(nullptr != item);
+            item = free_loans_.back();
             free_loans_.pop_back();
         }
 
@@ -146,13 +136,14 @@ struct SampleLoanManager
         // Increment reference counter and return sample
         item->num_refs += 1;
         sample = item->sample;
+        add_used_loan(item);
     }
 
     void return_loan(
             void* sample)
     {
-        OutstandingLoanItem* item = find_by_sample(sample);
-        assert(nullptr != item);
+        size_t slot = find_used_loan(sample);
+        OutstandingLoanItem* item = used_loans_[slot];
 
         item->num_refs -= 1;
         if (item->num_refs == 0)
@@ -161,9 +152,8 @@ struct SampleLoanManager
             assert(item->payload.data == nullptr);
             assert(item->payload.payload_owner == nullptr);
 
-            item = free_loans_.push_back(std::move(*item));
-            assert(nullptr != item);
-            used_loans_.remove(*item);
+            remove_used_loan(slot);
+            free_loans_.push_back(item);
         }
     }
 
@@ -172,7 +162,6 @@ private:
     struct OutstandingLoanItem
     {
         void* sample = nullptr;
-        SampleIdentity identity;
         SerializedPayload_t payload;
         uint32_t num_refs = 0;
 
@@ -192,52 +181,112 @@ private:
                 OutstandingLoanItem&&) = default;
         OutstandingLoanItem& operator =(
                 OutstandingLoanItem&&) = default;
+    };
+
+    bool is_plain_;
+    eprosima::fastdds::ResourceLimitedContainerConfig limits_;
+    TypeSupport type_;
+
+    //! Owns every item of the pool, so their addresses are stable.
+    std::vector<std::unique_ptr<OutstandingLoanItem>> items_;
+    std::vector<OutstandingLoanItem*> free_loans_;
+    //! Loaned items by the address of their sample, on an open addressing table with at least twice as many slots as
+    //! items. Samples of plain types loaned twice share the address, and take a slot each.
+    std::vector<OutstandingLoanItem*> used_loans_;
+    size_t num_used_loans_ = 0;
 
-        bool operator == (
-                const OutstandingLoanItem& other) const
+    OutstandingLoanItem* create_item()
+    {
+        items_.emplace_back(new OutstandingLoanItem());
+        OutstandingLoanItem* item = items_.back().get();
+
+        // Create sample if necessary
+        if (!is_plain_)
         {
-            return other.sample == sample && other.payload.data == payload.data;
+            item->sample = type_->createData();
         }
+        return item;
+    }
 
-    };
+    size_t home_slot(
+            const void* sample) const
+    {
+        // Fibonacci hashing, as sample addresses are aligned and only differ on their middle bits
+        uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(sample)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & (used_loans_.size() - 1);
+    }
+
+    //! Grow the index of loaned items, if needed, to keep at least twice as many slots as items.
+    void resize_used_loans()
+    {
+        size_t size = 16;
+        while (size < 2 * items_.size())
+        {
+            size *= 2;
+        }
 
-    using collection_type = eprosima::fastdds::ResourceLimitedVector<OutstandingLoanItem>;
+        if (size <= used_loans_.size())
+        {
+            return;
+        }
 
-    bool is_plain_;
-    eprosima::fastdds::ResourceLimitedContainerConfig limits_;
-    collection_type free_loans_;
-    collection_type used_loans_;
-    TypeSupport type_;
+        std::vector<OutstandingLoanItem*> previous(size, nullptr);
+        previous.swap(used_loans_);
+        num_used_loans_ = 0;
+        for (OutstandingLoanItem* item : previous)
+        {
+            if (nullptr != item)
+            {
+                add_used_loan(item);
+            }
+        }
+    }
 
-    OutstandingLoanItem* find_by_change(
-            CacheChange_t* change)
+    void add_used_loan(
+            OutstandingLoanItem* item)
     {
-        SampleIdentity id;
-        id.writer_guid(change->writerGUID);
-        id.sequence_number(change->sequenceNumber);
-
-        auto comp = [id](const OutstandingLoanItem& item)
-                {
-                    return id == item.identity;
-                };
-        auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
-        if (it != used_loans_.end())
+        size_t mask = used_loans_.size() - 1;
+        size_t slot = home_slot(item->sample);
+        while (nullptr != used_loans_[slot])
         {
-            return &(*it);
+            slot = (slot + 1) & mask;
         }
-        return nullptr;
+        used_loans_[slot] = item;
+        ++num_used_loans_;
     }
 
-    OutstandingLoanItem* find_by_sample(
-            void* sample)
+    size_t find_used_loan(
+            const void* sample) const
+    {
+        size_t mask = used_loans_.size() - 1;
+        size_t slot = home_slot(sample);
+        while (used_loans_[slot]->sample != sample)
+        {
+            slot = (slot + 1) & mask;
+            // Only samples which have been loaned are returned
+            assert(nullptr != used_loans_[slot]);
+        }
+        return slot;
+    }
+
+    void remove_used_loan(
+            size_t slot)
     {
-        auto comp = [sample](const OutstandingLoanItem& item)
-                {
-                    return sample == item.sample;
-                };
-        auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
-        assert(it != used_loans_.end());
-        return &(*it);
+        // Shift back the items after the removed one which would not be found otherwise
+        size_t mask = used_loans_.size() - 1;
+        size_t next = (slot + 1) & mask;
+        while (nullptr != used_loans_[next])
+        {
+            size_t home = home_slot(used_loans_[next]->sample);
+            if (((next - home) & mask) >= ((next - slot) & mask))
+            {
+                used_loans_[slot] = used_loans_[next];
+                slot = next;
+            }
+            next = (next + 1) & mask;
+        }
+        used_loans_[slot] = nullptr;
+        --num_used_loans_;
     }
 
 };
@@ -63,6 +63,7 @@ DataReaderHistory::DataReaderHistory(
         const DataReaderQos& qos)
     : ReaderHistory(to_history_attributes(type, qos))
     , key_writers_allocation_(qos.reader_resource_limits().matched_publisher_allocation)
+    , instances_(qos.resource_limits())
     , history_qos_(qos.history())
     , resource_limited_qos_(qos.resource_limits())
     , topic_name_(topic.get_name())
@@ -227,7 +228,7 @@ bool DataReaderHistory::received_change_keep_all(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(a_change->instanceHandle, vit))
     {
         DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
@@ -263,7 +264,7 @@ bool DataReaderHistory::received_change_keep_last(
     }
 
     bool ret_value = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(a_change->instanceHandle, vit))
     {
         DataReaderInstance::ChangeCollection& instance_changes = vit->second->cache_changes;
@@ -382,9 +383,9 @@ bool DataReaderHistory::get_first_untaken_info(
 
 bool DataReaderHistory::find_key(
         const InstanceHandle_t& handle,
-        InstanceCollection::iterator& vit_out)
+        InstanceIndex::iterator& vit_out)
 {
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     vit = instances_.find(handle);
     if (vit != instances_.end())
     {
@@ -439,7 +440,7 @@ bool DataReaderHistory::remove_change_sub(
 
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
     bool found = false;
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     if (find_key(change->instanceHandle, vit))
     {
         for (auto chit = vit->second->cache_changes.begin(); chit != vit->second->cache_changes.end(); ++chit)
@@ -502,7 +503,7 @@ bool DataReaderHistory::remove_change_sub(
 
     if (new_it == changesEnd() || !matches_change(&dummy_change, *new_it)) // Change was successfully removed.
     {
-        InstanceCollection::iterator vit;
+        InstanceIndex::iterator vit;
         if (find_key(dummy_change.instanceHandle, vit))
         {
             auto in_it = std::find(vit->second->cache_changes.begin(), vit->second->cache_changes.end(), change);
@@ -568,8 +569,8 @@ bool DataReaderHistory::get_next_deadline(
     auto min = std::min_element(instances_.begin(),
                     instances_.end(),
                     [](
-                        const InstanceCollection::value_type& lhs,
-                        const InstanceCollection::value_type& rhs)
+                        const InstanceIndex::value_type& lhs,
+                        const InstanceIndex::value_type& rhs)
                     {
                         return lhs.second->next_deadline_us < rhs.second->next_deadline_us;
                     });
@@ -634,11 +635,7 @@ std::pair<bool, DataReaderHistory::instance_info> DataReaderHistory::lookup_avai
             else
             {
                 // Looking for an instance with a handle greater than the one on the input
-                auto comp = [](const InstanceHandle_t& h, const InstanceCollection::value_type& it)
-                        {
-                            return h < it.first;
-                        };
-                it = std::upper_bound(data_available_instances_.begin(), data_available_instances_.end(), handle, comp);
+                it = data_available_instances_.upper_bound(handle);
             }
         }
     }
@@ -755,7 +752,7 @@ bool DataReaderHistory::completed_change(
 
     if (compute_key_for_change_fn_(change))
     {
-        InstanceCollection::iterator vit;
+        InstanceIndex::iterator vit;
         if (find_key(change->instanceHandle, vit))
         {
             ret_value = !change->instanceHandle.isDefined() ||
@@ -855,7 +852,7 @@ void DataReaderHistory::instance_viewed_nts(
 bool DataReaderHistory::update_instance_nts(
         CacheChange_t* const change)
 {
-    InstanceCollection::iterator vit;
+    InstanceIndex::iterator vit;
     vit = instances_.find(change->instanceHandle);
 
     assert(vit != instances_.end());
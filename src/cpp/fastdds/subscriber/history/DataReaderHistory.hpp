@@ -43,6 +43,7 @@
 #include <fastdds/rtps/attributes/ResourceManagement.hpp>
 
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
+#include <fastdds/utils/InstanceHashTable.hpp>
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
 
@@ -68,6 +69,7 @@ public:
     using SequenceNumber_t = eprosima::fastdds::rtps::SequenceNumber_t;
 
     using InstanceCollection = std::map<InstanceHandle_t, std::shared_ptr<DataReaderInstance>>;
+    using InstanceIndex = InstanceHashTable<std::shared_ptr<DataReaderInstance>>;
     using instance_info = InstanceCollection::iterator;
 
     /**
@@ -374,7 +376,7 @@ private:
     //!Resource limits for allocating the array of alive writers per instance
     eprosima::fastdds::ResourceLimitedContainerConfig key_writers_allocation_;
     //!Collection of DataReaderInstance objects accessible by their handle
-    InstanceCollection instances_;
+    InstanceIndex instances_;
     //!Collection of DataReaderInstance objects with available data, accessible by their handle
     InstanceCollection data_available_instances_;
     //!HistoryQosPolicy values.
@@ -411,7 +413,7 @@ private:
      */
     bool find_key(
             const InstanceHandle_t& handle,
-            InstanceCollection::iterator& map_it);
+            InstanceIndex::iterator& map_it);
 
     /**
      * @name Variants of incoming change processing.
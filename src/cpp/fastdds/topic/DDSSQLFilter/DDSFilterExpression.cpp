@@ -17,6 +17,7 @@
  */
 #include "DDSFilterExpression.hpp"
 
+#include <cassert>
 #include <map>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@
 #include <fastdds/dds/topic/IContentFilter.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/rtps/common/Types.h>
 
 #include "DDSFilterConditionState.hpp"
 #include "DDSFilterField.hpp"
@@ -39,6 +41,11 @@ namespace fastdds {
 namespace dds {
 namespace DDSSQLFilter {
 
+// Representation identifiers without the endianness bit (XTypes 1.3, 7.6.3.1.2)
+static constexpr uint8_t ENCAPSULATION_CDR = 0x00;
+static constexpr uint8_t ENCAPSULATION_CDR2 = 0x06;
+static constexpr uint8_t ENCAPSULATION_D_CDR2 = 0x08;
+
 bool DDSFilterExpression::evaluate(
         const IContentFilter::SerializedPayload& payload,
         const IContentFilter::FilterSampleInfo& sample_info,
@@ -47,6 +54,44 @@ bool DDSFilterExpression::evaluate(
     static_cast<void>(sample_info);
     static_cast<void>(reader_guid);
 
+    bool result = false;
+    return evaluate_fields(payload, false, result) && result;
+}
+
+bool DDSFilterExpression::evaluate_all_fields(
+        const IContentFilter::SerializedPayload& payload,
+        bool& result) const
+{
+    return evaluate_fields(payload, true, result);
+}
+
+bool DDSFilterExpression::evaluate_with_fields_of(
+        const DDSFilterExpression& source) const
+{
+    assert(fields.size() == source.fields.size());
+
+    root->reset();
+    auto source_it = source.fields.begin();
+    for (auto it = fields.begin();
+            it != fields.end() && DDSFilterConditionState::UNDECIDED == root->get_state();
+            ++it, ++source_it)
+    {
+        it->second->set_value(*source_it->second);
+    }
+
+    return DDSFilterConditionState::RESULT_TRUE == root->get_state();
+}
+
+bool DDSFilterExpression::evaluate_fields(
+        const IContentFilter::SerializedPayload& payload,
+        bool all_fields,
+        bool& result) const
+{
+    if (compiled_ && evaluate_compiled(payload, all_fields, result))
+    {
+        return true;
+    }
+
     using namespace eprosima::fastdds::dds::xtypes;
     using namespace eprosima::fastcdr;
 
@@ -70,7 +115,7 @@ bool DDSFilterExpression::evaluate(
 
     root->reset();
     for (auto it = fields.begin();
-            it != fields.end() && DDSFilterConditionState::UNDECIDED == root->get_state();
+            it != fields.end() && (all_fields || DDSFilterConditionState::UNDECIDED == root->get_state());
             ++it)
     {
         if (!it->second->set_value(dyn_data_))
@@ -79,11 +124,59 @@ bool DDSFilterExpression::evaluate(
         }
     }
 
-    return DDSFilterConditionState::RESULT_TRUE == root->get_state();
+    result = DDSFilterConditionState::RESULT_TRUE == root->get_state();
+    return true;
+}
+
+bool DDSFilterExpression::evaluate_compiled(
+        const IContentFilter::SerializedPayload& payload,
+        bool all_fields,
+        bool& result) const
+{
+    if (SerializedPayload::representation_header_size > payload.length || 0 != payload.data[0])
+    {
+        return false;
+    }
+
+    bool xcdr2 = false;
+    uint8_t encoding = static_cast<uint8_t>(payload.data[1] & 0xFE);
+    switch (encoding)
+    {
+        case ENCAPSULATION_CDR:
+            break;
+
+        case ENCAPSULATION_CDR2:
+        case ENCAPSULATION_D_CDR2:
+            xcdr2 = true;
+            break;
+
+        default:
+            return false;
+    }
+
+    bool little_endian = 0 != (payload.data[1] & 0x01);
+    bool swap = little_endian != (fastdds::rtps::LITTLEEND == fastdds::rtps::DEFAULT_ENDIAN);
+    const fastdds::rtps::octet* cdr_body = payload.data + SerializedPayload::representation_header_size;
+    uint32_t length = static_cast<uint32_t>(payload.length - SerializedPayload::representation_header_size);
+
+    root->reset();
+    for (auto it = fields.begin();
+            it != fields.end() && (all_fields || DDSFilterConditionState::UNDECIDED == root->get_state());
+            ++it)
+    {
+        if (!it->second->set_value(cdr_body, length, xcdr2, swap))
+        {
+            return false;
+        }
+    }
+
+    result = DDSFilterConditionState::RESULT_TRUE == root->get_state();
+    return true;
 }
 
 void DDSFilterExpression::clear()
 {
+    compiled_ = false;
     DynamicDataFactory::get_instance()->delete_data(dyn_data_);
     DynamicTypeBuilderFactory::get_instance()->delete_type(dyn_type_);
     parameters.clear();
@@ -98,6 +191,15 @@ void DDSFilterExpression::set_type(
     dyn_data_ = traits<DynamicData>::narrow<DynamicDataImpl>(DynamicDataFactory::get_instance()->create_data(type));
 }
 
+void DDSFilterExpression::compile()
+{
+    compiled_ = !fields.empty();
+    for (auto& field : fields)
+    {
+        compiled_ = field.second->compile(dyn_type_) && compiled_;
+    }
+}
+
 } // namespace DDSSQLFilter
 } // namespace dds
 } // namespace fastdds
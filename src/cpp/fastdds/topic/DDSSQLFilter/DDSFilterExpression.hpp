@@ -65,6 +65,36 @@ public:
     void set_type(
             DynamicType::_ref_type type);
 
+    /**
+     * Precompute the location of the referenced fields on the serialized payloads, so they can be read without
+     * deserializing the whole sample.
+     * Should be called after all the fields of the expression have been added.
+     */
+    void compile();
+
+    /**
+     * Evaluate the expression reading all its fields from the payload, even those not needed to decide the result.
+     * This way the values can be shared with other expressions having the same fields.
+     *
+     * @param [in]  payload  The payload to evaluate.
+     * @param [out] result   The result of the evaluation.
+     *
+     * @return Whether all the fields could be read.
+     */
+    bool evaluate_all_fields(
+            const SerializedPayload& payload,
+            bool& result) const;
+
+    /**
+     * Evaluate the expression using the field values read by another expression.
+     *
+     * @param [in] source  Expression with the same fields, on which @c evaluate_all_fields succeeded.
+     *
+     * @return The result of the evaluation.
+     */
+    bool evaluate_with_fields_of(
+            const DDSFilterExpression& source) const;
+
     /// The root condition of the expression tree.
     std::unique_ptr<DDSFilterCondition> root;
     /// The fields referenced by this expression.
@@ -74,6 +104,36 @@ public:
 
 private:
 
+    /**
+     * Read the fields from the payload and evaluate the expression.
+     *
+     * @param [in]  payload     The payload to evaluate.
+     * @param [in]  all_fields  Whether to keep reading fields once the result is known.
+     * @param [out] result      The result of the evaluation.
+     *
+     * @return Whether the fields could be read.
+     */
+    bool evaluate_fields(
+            const SerializedPayload& payload,
+            bool all_fields,
+            bool& result) const;
+
+    /**
+     * Evaluate the expression reading the fields directly from the serialized payload.
+     *
+     * @param [in]  payload     The payload to evaluate.
+     * @param [in]  all_fields  Whether to keep reading fields once the result is known.
+     * @param [out] result      The result of the evaluation.
+     *
+     * @return Whether the fields could be read. When false, the payload should be fully deserialized.
+     */
+    bool evaluate_compiled(
+            const SerializedPayload& payload,
+            bool all_fields,
+            bool& result) const;
+
+    /// Whether all the fields can be read directly from the serialized payloads
+    bool compiled_ = false;
     /// The Dynamic type used to deserialize the payloads
     DynamicType::_ref_type dyn_type_;
     /// The Dynamic data used to deserialize the payloads
@@ -554,6 +554,7 @@ ReturnCode_t DDSFilterFactory::create_content_filter(
                     ret = convert_tree<DDSFilterCondition>(state, expr->root, *(node->children[0]));
                     if (RETCODE_OK == ret)
                     {
+                        expr->compile();
                         delete_content_filter(filter_class_name, filter_instance);
                         filter_instance = expr;
                     }
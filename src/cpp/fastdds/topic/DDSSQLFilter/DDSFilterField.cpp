@@ -18,7 +18,9 @@
 
 #include "DDSFilterField.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <unordered_set>
 #include <vector>
 
@@ -30,11 +32,286 @@
 #include "DDSFilterPredicate.hpp"
 #include "DDSFilterValue.hpp"
 
+#include "../../xtypes/dynamic_types/DynamicTypeImpl.hpp"
+#include "../../xtypes/dynamic_types/DynamicTypeMemberImpl.hpp"
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
 namespace DDSSQLFilter {
 
+namespace {
+
+using DynamicTypeImplRef = traits<DynamicTypeImpl>::ref_type;
+
+inline uint32_t align(
+        uint32_t offset,
+        uint32_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+inline DynamicTypeImplRef resolve(
+        DynamicType::_ref_type type)
+{
+    return traits<DynamicType>::narrow<DynamicTypeImpl>(type)->resolve_alias_enclosed_type();
+}
+
+/*
+ * Size and alignment of a primitive type on the CDR stream.
+ * XCDRv2 limits the alignment of 8-byte types to 4.
+ */
+bool primitive_layout(
+        TypeKind kind,
+        bool xcdr2,
+        uint32_t& size,
+        uint32_t& alignment)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_INT8:
+        case TK_UINT8:
+        case TK_CHAR8:
+            size = 1;
+            break;
+
+        case TK_INT16:
+        case TK_UINT16:
+            size = 2;
+            break;
+
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+            size = 4;
+            break;
+
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            size = 8;
+            break;
+
+        default:
+            return false;
+    }
+
+    alignment = (xcdr2 && 8 == size) ? 4 : size;
+    return true;
+}
+
+/*
+ * Kind used to serialize a type. Enumerations are serialized as their holder type.
+ */
+TypeKind serialized_kind(
+        const DynamicTypeImplRef& type)
+{
+    if (TK_ENUM == type->get_kind())
+    {
+        const auto& members = type->get_all_members_by_index();
+        return members.empty() ? TK_NONE : resolve(members.at(0)->get_descriptor().type())->get_kind();
+    }
+
+    return type->get_kind();
+}
+
+/*
+ * Advance the offset over a type whose serialized size does not depend on its contents.
+ */
+bool skip_fixed_size(
+        const DynamicTypeImplRef& type,
+        bool xcdr2,
+        uint32_t& offset)
+{
+    uint32_t size = 0;
+    uint32_t alignment = 1;
+    TypeKind kind = serialized_kind(type);
+
+    if (primitive_layout(kind, xcdr2, size, alignment))
+    {
+        offset = align(offset, alignment) + size;
+        return true;
+    }
+
+    if (TK_ARRAY == kind)
+    {
+        // Only arrays of primitives, as XCDRv2 adds a DHEADER to arrays of other types
+        if (!primitive_layout(resolve(type->get_descriptor().element_type())->get_kind(), xcdr2, size, alignment))
+        {
+            return false;
+        }
+
+        uint32_t count = 1;
+        for (uint32_t bound : type->get_descriptor().bound())
+        {
+            count *= bound;
+        }
+        offset = align(offset, alignment) + count * size;
+        return true;
+    }
+
+    if (TK_STRUCTURE == kind)
+    {
+        // XCDRv2 DHEADERs hold the size of the serialized struct, which may be a different version of the type
+        ExtensibilityKind extensibility = type->get_descriptor().extensibility_kind();
+        if (ExtensibilityKind::MUTABLE == extensibility ||
+                (xcdr2 && ExtensibilityKind::APPENDABLE == extensibility))
+        {
+            return false;
+        }
+
+        for (const auto& member : type->get_all_members_by_index())
+        {
+            const MemberDescriptorImpl& descriptor = member->get_descriptor();
+            if (descriptor.is_optional() || !skip_fixed_size(resolve(descriptor.type()), xcdr2, offset))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Compute the position of the field at the given step of the access path.
+ */
+bool locate_field(
+        const DynamicTypeImplRef& type,
+        const std::vector<DDSFilterField::FieldAccessor>& access_path,
+        size_t n,
+        bool xcdr2,
+        uint32_t& offset,
+        uint32_t& end,
+        DDSFilterField::CdrAccessPlan& plan,
+        TypeKind& field_kind)
+{
+    if (TK_STRUCTURE != type->get_kind())
+    {
+        return false;
+    }
+
+    ExtensibilityKind extensibility = type->get_descriptor().extensibility_kind();
+    if (ExtensibilityKind::MUTABLE == extensibility)
+    {
+        return false;
+    }
+
+    bool delimited = xcdr2 && ExtensibilityKind::APPENDABLE == extensibility;
+    uint32_t dheader_offset = 0;
+    if (delimited)
+    {
+        offset = align(offset, 4);
+        dheader_offset = offset;
+        offset += 4;
+    }
+    uint32_t begin = offset;
+
+    const auto& members = type->get_all_members_by_index();
+    size_t index = access_path[n].member_index;
+    if (members.size() <= index)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < index; ++i)
+    {
+        const MemberDescriptorImpl& descriptor = members[i]->get_descriptor();
+        if (descriptor.is_optional() || !skip_fixed_size(resolve(descriptor.type()), xcdr2, offset))
+        {
+            return false;
+        }
+    }
+
+    const MemberDescriptorImpl& descriptor = members[index]->get_descriptor();
+    if (descriptor.is_optional())
+    {
+        return false;
+    }
+
+    DynamicTypeImplRef member_type = resolve(descriptor.type());
+    bool last_step = access_path.size() - 1 == n;
+    uint32_t size = 0;
+    uint32_t alignment = 1;
+
+    if (access_path[n].array_index < MEMBER_ID_INVALID)
+    {
+        if (!last_step || TK_ARRAY != member_type->get_kind())
+        {
+            return false;
+        }
+
+        field_kind = resolve(member_type->get_descriptor().element_type())->get_kind();
+        if (!primitive_layout(field_kind, xcdr2, size, alignment))
+        {
+            return false;
+        }
+
+        offset = align(offset, alignment) + static_cast<uint32_t>(access_path[n].array_index) * size;
+        plan.offset = offset;
+        end = offset + size;
+    }
+    else if (!last_step)
+    {
+        if (!locate_field(member_type, access_path, n + 1, xcdr2, offset, end, plan, field_kind))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        field_kind = serialized_kind(member_type);
+        if (TK_STRING8 == field_kind)
+        {
+            // Only the length is at a known position. The characters are checked when reading.
+            size = 4;
+            alignment = 4;
+        }
+        else if (!primitive_layout(field_kind, xcdr2, size, alignment))
+        {
+            return false;
+        }
+
+        offset = align(offset, alignment);
+        plan.offset = offset;
+        end = offset + size;
+    }
+
+    if (delimited)
+    {
+        plan.delimiters.emplace_back(dheader_offset, end - begin);
+    }
+
+    return true;
+}
+
+template<typename T>
+bool read_primitive(
+        const fastdds::rtps::octet* cdr_body,
+        uint32_t length,
+        uint32_t offset,
+        bool swap,
+        T& value)
+{
+    if (length < offset || length - offset < sizeof(T))
+    {
+        return false;
+    }
+
+    memcpy(&value, cdr_body + offset, sizeof(T));
+    if (swap)
+    {
+        fastdds::rtps::octet* bytes = reinterpret_cast<fastdds::rtps::octet*>(&value);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    return true;
+}
+
+}  // namespace
+
 bool DDSFilterField::set_value(
         DynamicData::_ref_type data,
         size_t n)
@@ -88,16 +365,165 @@ bool DDSFilterField::set_value(
 
     if (ret && last_step)
     {
-        has_value_ = true;
-        value_has_changed();
+        notify_value_set();
+    }
+
+    return ret;
+}
+
+bool DDSFilterField::compile(
+        DynamicType::_ref_type type)
+{
+    bool ret = false;
+
+    for (uint32_t version = 0; version < 2; ++version)
+    {
+        CdrAccessPlan& plan = cdr_plans_[version];
+        plan = CdrAccessPlan();
+
+        uint32_t offset = 0;
+        uint32_t end = 0;
+        plan.valid = locate_field(resolve(type), access_path_, 0, 1 == version, offset, end, plan, serialized_kind_);
+        ret = ret || plan.valid;
+    }
+
+    return ret;
+}
+
+bool DDSFilterField::set_value(
+        const fastdds::rtps::octet* cdr_body,
+        uint32_t length,
+        bool xcdr2,
+        bool swap)
+{
+    const CdrAccessPlan& plan = cdr_plans_[xcdr2 ? 1 : 0];
+    if (!plan.valid)
+    {
+        return false;
+    }
 
-        // Inform parent predicates
-        for (DDSFilterPredicate* parent : parents_)
+    // The struct may have been serialized from a shorter version of the type
+    for (const auto& delimiter : plan.delimiters)
+    {
+        uint32_t dheader = 0;
+        if (!read_primitive(cdr_body, length, delimiter.first, swap, dheader) || dheader < delimiter.second)
         {
-            parent->value_has_changed();
+            return false;
         }
     }
 
+    bool ret = false;
+    uint32_t offset = plan.offset;
+    switch (serialized_kind_)
+    {
+        case TK_BOOLEAN:
+        {
+            uint8_t value {0};
+            ret = read_primitive(cdr_body, length, offset, false, value);
+            boolean_value = 0 != value;
+        }
+        break;
+
+        case TK_CHAR8:
+            ret = read_primitive(cdr_body, length, offset, false, char_value);
+            break;
+
+        case TK_STRING8:
+        {
+            uint32_t str_length {0};
+            ret = read_primitive(cdr_body, length, offset, swap, str_length) &&
+                    length - offset - 4 >= str_length;
+            if (ret)
+            {
+                // The serialized length includes the null character
+                const char* str = reinterpret_cast<const char*>(cdr_body + offset + 4);
+                string_value.assign(str, 0 < str_length ? str_length - 1 : 0);
+            }
+        }
+        break;
+
+        case TK_INT8:
+        {
+            int8_t value8 {0};
+            ret = read_primitive(cdr_body, length, offset, false, value8);
+            signed_integer_value = value8;
+        }
+        break;
+
+        case TK_INT16:
+        {
+            int16_t value16 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, value16);
+            signed_integer_value = value16;
+        }
+        break;
+
+        case TK_INT32:
+        {
+            int32_t value32 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, value32);
+            signed_integer_value = value32;
+        }
+        break;
+
+        case TK_INT64:
+            ret = read_primitive(cdr_body, length, offset, swap, signed_integer_value);
+            break;
+
+        case TK_BYTE:
+        case TK_UINT8:
+        {
+            uint8_t valueu8 {0};
+            ret = read_primitive(cdr_body, length, offset, false, valueu8);
+            unsigned_integer_value = valueu8;
+        }
+        break;
+
+        case TK_UINT16:
+        {
+            uint16_t valueu16 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, valueu16);
+            unsigned_integer_value = valueu16;
+        }
+        break;
+
+        case TK_UINT32:
+        {
+            uint32_t valueu32 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, valueu32);
+            unsigned_integer_value = valueu32;
+        }
+        break;
+
+        case TK_UINT64:
+            ret = read_primitive(cdr_body, length, offset, swap, unsigned_integer_value);
+            break;
+
+        case TK_FLOAT32:
+        {
+            float valuef32 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, valuef32);
+            float_value = valuef32;
+        }
+        break;
+
+        case TK_FLOAT64:
+        {
+            double valuef64 {0};
+            ret = read_primitive(cdr_body, length, offset, swap, valuef64);
+            float_value = valuef64;
+        }
+        break;
+
+        default:
+            break;
+    }
+
+    if (ret)
+    {
+        notify_value_set();
+    }
+
     return ret;
 }
 
@@ -225,6 +651,26 @@ bool DDSFilterField::set_value_using_member_id(
     return ret;
 }
 
+void DDSFilterField::set_value(
+        const DDSFilterField& source)
+{
+    assert(source.has_value());
+    copy_from(source, false);
+    notify_value_set();
+}
+
+void DDSFilterField::notify_value_set()
+{
+    has_value_ = true;
+    value_has_changed();
+
+    // Inform parent predicates
+    for (DDSFilterPredicate* parent : parents_)
+    {
+        parent->value_has_changed();
+    }
+}
+
 }  // namespace DDSSQLFilter
 
 }  // namespace dds
@@ -25,6 +25,7 @@
 
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 #include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
 #include <fastdds/rtps/common/SerializedPayload.h>
 
@@ -56,6 +57,21 @@ public:
         size_t array_index;
     };
 
+    /**
+     * Location of the field inside the CDR body of a serialized payload, for one version of the encoding.
+     */
+    struct CdrAccessPlan final
+    {
+        /// Whether the field is always at the same position for this version of the encoding
+        bool valid = false;
+
+        /// Offset of the field from the beginning of the CDR body
+        uint32_t offset = 0;
+
+        /// DHEADERs on the access path, as pairs of their offset and the minimum size they should announce
+        std::vector<std::pair<uint32_t, uint32_t>> delimiters;
+    };
+
     /**
      * Construct a DDSFilterField.
      *
@@ -123,6 +139,47 @@ public:
             DynamicData::_ref_type data,
             size_t n);
 
+    /**
+     * Precompute where this field lies on the serialized payloads of a type.
+     * The field can only be located when every member serialized before it has a fixed size.
+     *
+     * @param[in]  type  The DynamicType of the payloads being filtered.
+     *
+     * @return Whether the field can be read directly from payloads of any of the supported encodings.
+     */
+    bool compile(
+            DynamicType::_ref_type type);
+
+    /**
+     * Read the field directly from the CDR body of a serialized payload, using the plan computed by @c compile.
+     * Will notify the predicates where this DDSFilterField is being used.
+     *
+     * @param[in]  cdr_body  Pointer to the CDR body (the serialized payload after the encapsulation).
+     * @param[in]  length    Length of the CDR body.
+     * @param[in]  xcdr2     Whether the CDR body is encoded with XCDRv2.
+     * @param[in]  swap      Whether the endianness of the CDR body differs from the one of this host.
+     *
+     * @return Whether the field could be read. When false, the payload should be fully deserialized.
+     *
+     * @post Method @c has_value returns true if the method succeeds.
+     */
+    bool set_value(
+            const fastdds::rtps::octet* cdr_body,
+            uint32_t length,
+            bool xcdr2,
+            bool swap);
+
+    /**
+     * Take the value read by a field with the same access path on another expression.
+     * Will notify the predicates where this DDSFilterField is being used.
+     *
+     * @param[in]  source  The field from where to copy the value. Should have a value.
+     *
+     * @post Method @c has_value returns true.
+     */
+    void set_value(
+            const DDSFilterField& source);
+
 protected:
 
     inline void add_parent(
@@ -138,7 +195,13 @@ private:
             DynamicData::_ref_type data,
             MemberId member_id);
 
+    void notify_value_set();
+
     bool has_value_ = false;
+    /// Access plans for XCDRv1 and XCDRv2
+    CdrAccessPlan cdr_plans_[2];
+    /// Primitive kind used to serialize the field
+    TypeKind serialized_kind_ = TK_NONE;
     std::vector<FieldAccessor> access_path_;
     const std::shared_ptr<xtypes::TypeIdentifier> type_id_;
     std::unordered_set<DDSFilterPredicate*> parents_;
@@ -0,0 +1,140 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceHashTable.hpp
+ */
+
+#ifndef _FASTDDS_UTILS_INSTANCEHASHTABLE_HPP_
+#define _FASTDDS_UTILS_INSTANCEHASHTABLE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+#include <foonathan/memory/container.hpp>
+#include <foonathan/memory/memory_pool.hpp>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+#include <rtps/builtin/data/ProxyHashTables.hpp>
+#include <utils/collections/node_size_helpers.hpp>
+
+namespace std {
+
+template<>
+struct hash<eprosima::fastdds::rtps::InstanceHandle_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastdds::rtps::InstanceHandle_t& k) const noexcept
+    {
+        // Handles are either MD5 digests or zero padded keys, so both halves are mixed together
+        const eprosima::fastdds::rtps::octet* value = k.value;
+        uint64_t low = 0;
+        uint64_t high = 0;
+        memcpy(&low, value, sizeof(low));
+        memcpy(&high, &value[sizeof(low)], sizeof(high));
+
+        uint64_t h = low ^ (high * 0x9E3779B97F4A7C15ull);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+};
+
+} // namespace std
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Hash table of instances accessible by their handle.
+ * Nodes are taken from a memory pool, so adding and removing instances does not reach the heap once the pool has
+ * grown to the number of instances in use.
+ */
+template<class Instance>
+class InstanceHashTable
+    : protected rtps::detail::binary_node_segregator<
+        utilities::collections::unordered_map_size_helper<rtps::InstanceHandle_t, Instance>::node_size>
+    , public foonathan::memory::unordered_map<
+        rtps::InstanceHandle_t,
+        Instance,
+        rtps::detail::binary_node_segregator<
+            utilities::collections::unordered_map_size_helper<rtps::InstanceHandle_t, Instance>::node_size>
+        >
+{
+public:
+
+    using allocator_type = rtps::detail::binary_node_segregator<
+        utilities::collections::unordered_map_size_helper<rtps::InstanceHandle_t, Instance>::node_size>;
+    using base_class = foonathan::memory::unordered_map<rtps::InstanceHandle_t, Instance, allocator_type>;
+
+    /**
+     * Construct the table for the given resource limits.
+     * Room for as many instances as preallocated samples is reserved upfront, without exceeding max_instances.
+     *
+     * @param resource_limits  Resource limits of the entity, with non-positive values meaning unlimited.
+     */
+    explicit InstanceHashTable(
+            const ResourceLimitsQosPolicy& resource_limits)
+        : allocator_type(initial_instances(resource_limits))
+        , base_class(
+            initial_instances(resource_limits),
+            std::hash<rtps::InstanceHandle_t>(),
+            std::equal_to<rtps::InstanceHandle_t>(),
+            *static_cast<allocator_type*>(this))
+    {
+        // notify the pool that fixed allocations may start
+        allocator_type::has_been_initialized();
+    }
+
+    ~InstanceHashTable()
+    {
+        base_class::clear();
+        allocator_type::is_being_destroyed();
+    }
+
+private:
+
+    static std::size_t initial_instances(
+            const ResourceLimitsQosPolicy& resource_limits)
+    {
+        std::size_t initial = 1u;
+        if (0 < resource_limits.allocated_samples)
+        {
+            initial = static_cast<std::size_t>(resource_limits.allocated_samples);
+        }
+        if (0 < resource_limits.max_instances)
+        {
+            initial = std::min(initial, static_cast<std::size_t>(resource_limits.max_instances));
+        }
+        return initial;
+    }
+
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UTILS_INSTANCEHASHTABLE_HPP_
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <bitset>
 #include <cassert>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -108,6 +109,180 @@ void fill_vector_with_dynamic_data(
     }
 }
 
+template<TypeKind TK, typename Functor>
+void call_with_inline_value(
+        void* value,
+        Functor& functor)
+{
+    functor(*static_cast<TypeForKind<TK>*>(value));
+}
+
+template<TypeKind TK, typename Functor>
+void call_with_inline_value(
+        const void* value,
+        Functor& functor)
+{
+    functor(*static_cast<const TypeForKind<TK>*>(value));
+}
+
+/*!
+ * Calls a functor with the value of a member kept inline, casted to the type of the member.
+ */
+template<typename Pointer, typename Functor>
+void visit_inline_value(
+        const DynamicDataLayout::Member& member,
+        Pointer value,
+        Functor& functor)
+{
+    switch (member.kind)
+    {
+        case TK_BOOLEAN:
+            call_with_inline_value<TK_BOOLEAN>(value, functor);
+            break;
+        case TK_BYTE:
+            call_with_inline_value<TK_BYTE>(value, functor);
+            break;
+        case TK_INT8:
+            call_with_inline_value<TK_INT8>(value, functor);
+            break;
+        case TK_UINT8:
+            call_with_inline_value<TK_UINT8>(value, functor);
+            break;
+        case TK_INT16:
+            call_with_inline_value<TK_INT16>(value, functor);
+            break;
+        case TK_UINT16:
+            call_with_inline_value<TK_UINT16>(value, functor);
+            break;
+        case TK_INT32:
+            call_with_inline_value<TK_INT32>(value, functor);
+            break;
+        case TK_UINT32:
+            call_with_inline_value<TK_UINT32>(value, functor);
+            break;
+        case TK_INT64:
+            call_with_inline_value<TK_INT64>(value, functor);
+            break;
+        case TK_UINT64:
+            call_with_inline_value<TK_UINT64>(value, functor);
+            break;
+        case TK_FLOAT32:
+            call_with_inline_value<TK_FLOAT32>(value, functor);
+            break;
+        case TK_FLOAT64:
+            call_with_inline_value<TK_FLOAT64>(value, functor);
+            break;
+        case TK_FLOAT128:
+            call_with_inline_value<TK_FLOAT128>(value, functor);
+            break;
+        case TK_CHAR8:
+            call_with_inline_value<TK_CHAR8>(value, functor);
+            break;
+        case TK_CHAR16:
+            call_with_inline_value<TK_CHAR16>(value, functor);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+struct InlineValueSizeCalculator
+{
+    eprosima::fastcdr::CdrSizeCalculator& calculator;
+    size_t& current_alignment;
+    MemberId id;
+    size_t calculated_size;
+
+    template<typename T>
+    void operator ()(
+            const T& value)
+    {
+        calculated_size += calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(id), value,
+                        current_alignment);
+    }
+
+};
+
+struct InlineValueSerializer
+{
+    eprosima::fastcdr::Cdr& cdr;
+    //! MEMBER_ID_INVALID when serializing the value without member header, as part of the key.
+    MemberId id;
+
+    template<typename T>
+    void operator ()(
+            const T& value)
+    {
+        if (MEMBER_ID_INVALID != id)
+        {
+            cdr << eprosima::fastcdr::MemberId{id} << value;
+        }
+        else
+        {
+            cdr << value;
+        }
+    }
+
+};
+
+struct InlineValueDeserializer
+{
+    eprosima::fastcdr::Cdr& cdr;
+
+    template<typename T>
+    void operator ()(
+            T& value)
+    {
+        cdr >> value;
+    }
+
+};
+
+struct InlineRunSizeCalculator
+{
+    eprosima::fastcdr::CdrSizeCalculator& calculator;
+    size_t& current_alignment;
+    uint32_t run;
+    size_t calculated_size;
+
+    template<typename T>
+    void operator ()(
+            const T& first)
+    {
+        calculated_size += calculator.calculate_array_serialized_size(&first, run, current_alignment);
+    }
+
+};
+
+struct InlineRunSerializer
+{
+    eprosima::fastcdr::Cdr& cdr;
+    uint32_t run;
+
+    template<typename T>
+    void operator ()(
+            const T& first)
+    {
+        cdr.serialize_array(&first, run);
+    }
+
+};
+
+struct InlineRunDeserializer
+{
+    eprosima::fastcdr::Cdr& cdr;
+    uint32_t run;
+
+    template<typename T>
+    void operator ()(
+            T& first)
+    {
+        cdr.deserialize_array(&first, run);
+    }
+
+};
+
 template<typename T>
 ReturnCode_t clear_sequence_typed_element(
         std::shared_ptr<T>& sequence,
@@ -160,8 +335,22 @@ DynamicDataImpl::DynamicDataImpl(
             TK_STRUCTURE == type_kind ||
             TK_UNION == type_kind)
     {
+        if (TK_STRUCTURE == type_kind)
+        {
+            layout_ = enclosing_type_->data_layout();
+            if (nullptr != layout_)
+            {
+                inline_values_ = layout_->defaults();
+            }
+        }
+
         for (auto& member : enclosing_type_->get_all_members_by_index())
         {
+            if (nullptr != inline_member(member->get_id()))
+            {
+                continue;
+            }
+
             traits<DynamicData>::ref_type data = DynamicDataFactory::get_instance()->create_data(
                 member->get_descriptor().type());
             traits<DynamicDataImpl>::ref_type data_impl = traits<DynamicData>::narrow<DynamicDataImpl>(data);
@@ -256,8 +445,14 @@ ReturnCode_t DynamicDataImpl::clear_value(
         {
             const auto& members = enclosing_type_->get_all_members();
             auto it_value = value_.find(id);
+            const DynamicDataLayout::Member* inline_placement = inline_member(id);
 
-            if (it_value != value_.end())
+            if (nullptr != inline_placement)
+            {
+                reset_inline_value(*inline_placement);
+                ret_val = RETCODE_OK;
+            }
+            else if (it_value != value_.end())
             {
                 const auto it = members.find(it_value->first);
                 assert(members.end() != it);
@@ -296,6 +491,8 @@ traits<DynamicData>::ref_type DynamicDataImpl::clone() noexcept
             TK_UNION == type_kind)
     {
         ret_value->selected_union_member_ = selected_union_member_;
+        ret_value->layout_ = layout_;
+        ret_value->inline_values_ = inline_values_;
         for (const auto& value : value_)
         {
             ret_value->value_.emplace(value.first, std::static_pointer_cast<DynamicDataImpl>(value.second)->clone());
@@ -360,6 +557,24 @@ bool DynamicDataImpl::equals(
                 TK_BITSET == type_kind ||
                 TK_STRUCTURE == type_kind)
         {
+            // Equal types place the members kept inline in the same way.
+            if ((nullptr == layout_) != (nullptr == other_data->layout_))
+            {
+                return false;
+            }
+
+            if (nullptr != layout_)
+            {
+                for (const auto& member : layout_->members())
+                {
+                    if (!compare_values(member.kind, inline_value_pointer(member),
+                            other_data->inline_value_pointer(member)))
+                    {
+                        return false;
+                    }
+                }
+            }
+
             return value_.size() == other_data->value_.size() &&
                    std::equal(
                 value_.begin(),
@@ -476,6 +691,11 @@ uint32_t DynamicDataImpl::get_item_count() noexcept
     else
     {
         ret_value = static_cast<uint32_t>(value_.size());
+
+        if (nullptr != layout_)
+        {
+            ret_value += static_cast<uint32_t>(layout_->members().size());
+        }
     }
 
     return ret_value;
@@ -724,7 +944,13 @@ ReturnCode_t DynamicDataImpl::get_complex_value(
             if (TK_UNION != type_kind || selected_union_member_ == id)
             {
                 auto it = value_.find(id);
-                if (it != value_.end())
+                const DynamicDataLayout::Member* inline_placement = inline_member(id);
+                if (nullptr != inline_placement)
+                {
+                    value = inline_member_data(*inline_placement);
+                    return RETCODE_OK;
+                }
+                else if (it != value_.end())
                 {
                     value = std::static_pointer_cast<DynamicData>(it->second)->clone();
                     return RETCODE_OK;
@@ -944,7 +1170,16 @@ traits<DynamicData>::ref_type DynamicDataImpl::loan_value(
                     TK_UNION == type_kind)
             {
                 auto it = value_.find(id);
-                if (it != value_.end())
+                const DynamicDataLayout::Member* inline_placement = inline_member(id);
+                if (nullptr != inline_placement)
+                {
+                    // The loan works on a copy, which is written back when returned.
+                    auto data = inline_member_data(*inline_placement);
+                    loaned_inline_values_[id] = data;
+                    loaned_values_.push_back(id);
+                    return data;
+                }
+                else if (it != value_.end())
                 {
                     auto sp = std::static_pointer_cast<DynamicData>(it->second);
 
@@ -1049,6 +1284,18 @@ ReturnCode_t DynamicDataImpl::return_loaned_value(
                 TK_STRUCTURE == type_kind ||
                 TK_UNION == type_kind)
         {
+            auto inline_it = loaned_inline_values_.find(*loan_it);
+            if (inline_it != loaned_inline_values_.end() && inline_it->second == value)
+            {
+                const DynamicDataLayout::Member* inline_placement = inline_member(*loan_it);
+                assert(nullptr != inline_placement);
+                std::memcpy(inline_value(*inline_placement), inline_it->second->value_.begin()->second.get(),
+                        inline_placement->size);
+                loaned_inline_values_.erase(inline_it);
+                loaned_values_.erase(loan_it);
+                return RETCODE_OK;
+            }
+
             auto it = value_.find(*loan_it);
             if (it != value_.end() && std::static_pointer_cast<DynamicData>(it->second) == value)
             {
@@ -1249,7 +1496,26 @@ ReturnCode_t DynamicDataImpl::set_complex_value(
             if (TK_UNION != type_kind || 0 != id)
             {
                 auto it = value_.find(id);
-                if (it != value_.end())
+                const DynamicDataLayout::Member* inline_placement = inline_member(id);
+                if (nullptr != inline_placement)
+                {
+                    traits<DynamicTypeMember>::ref_type member;
+                    enclosing_type_->get_member(member, id);
+                    auto member_impl = traits<DynamicTypeMember>::narrow<DynamicTypeMemberImpl>(member);
+
+                    if (member_impl->get_descriptor().type()->equals(value->type()))
+                    {
+                        auto value_impl = traits<DynamicData>::narrow<DynamicDataImpl>(value);
+                        std::memcpy(inline_value(*inline_placement), value_impl->value_.begin()->second.get(),
+                                inline_placement->size);
+                        ret_value =  RETCODE_OK;
+                    }
+                    else
+                    {
+                        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error setting due to the fact that types are different.");
+                    }
+                }
+                else if (it != value_.end())
                 {
                     auto data = std::static_pointer_cast<DynamicDataImpl>(it->second);
 
@@ -1567,8 +1833,15 @@ size_t DynamicDataImpl::calculate_key_serialized_size(
                 {
                     there_is_keyed_member = true;
                     auto it = value_.find(member.first);
+                    const DynamicDataLayout::Member* inline_placement = inline_member(member.first);
 
-                    if (it != value_.end())
+                    if (nullptr != inline_placement)
+                    {
+                        InlineValueSizeCalculator size_calculator {calculator, current_alignment, member.first, 0};
+                        visit_inline_value(*inline_placement, inline_value(*inline_placement), size_calculator);
+                        calculated_size += size_calculator.calculated_size;
+                    }
+                    else if (it != value_.end())
                     {
                         auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
 
@@ -1594,8 +1867,15 @@ size_t DynamicDataImpl::calculate_key_serialized_size(
                     if (TK_MAP != member_type->resolve_alias_enclosed_type()->get_kind())
                     {
                         auto it = value_.find(member.first);
+                        const DynamicDataLayout::Member* inline_placement = inline_member(member.first);
 
-                        if (it != value_.end())
+                        if (nullptr != inline_placement)
+                        {
+                            InlineValueSizeCalculator size_calculator {calculator, current_alignment, member.first, 0};
+                            visit_inline_value(*inline_placement, inline_value(*inline_placement), size_calculator);
+                            calculated_size += size_calculator.calculated_size;
+                        }
+                        else if (it != value_.end())
                         {
                             auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
 
@@ -1960,8 +2240,14 @@ void DynamicDataImpl::serialize_key(
                 {
                     there_is_keyed_member = true;
                     auto it = value_.find(member.first);
+                    const DynamicDataLayout::Member* inline_placement = inline_member(member.first);
 
-                    if (it != value_.end())
+                    if (nullptr != inline_placement)
+                    {
+                        InlineValueSerializer serializer {cdr, MEMBER_ID_INVALID};
+                        visit_inline_value(*inline_placement, inline_value(*inline_placement), serializer);
+                    }
+                    else if (it != value_.end())
                     {
                         auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
 
@@ -1985,8 +2271,14 @@ void DynamicDataImpl::serialize_key(
                     if (TK_MAP != member_type->resolve_alias_enclosed_type()->get_kind())
                     {
                         auto it = value_.find(member.first);
+                        const DynamicDataLayout::Member* inline_placement = inline_member(member.first);
 
-                        if (it != value_.end())
+                        if (nullptr != inline_placement)
+                        {
+                            InlineValueSerializer serializer {cdr, MEMBER_ID_INVALID};
+                            visit_inline_value(*inline_placement, inline_value(*inline_placement), serializer);
+                        }
+                        else if (it != value_.end())
                         {
                             auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
 
@@ -2013,6 +2305,85 @@ void DynamicDataImpl::serialize_key(
     }
 }
 
+void DynamicDataImpl::serialize_member(
+        eprosima::fastcdr::Cdr& cdr,
+        MemberId id) const
+{
+    auto it = value_.find(id);
+
+    if (it != value_.end())
+    {
+        auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
+
+        cdr << eprosima::fastcdr::MemberId{id} << member_data;
+    }
+    else
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES,
+                "Error serializing structure member because it is not found on DynamicData");
+    }
+}
+
+void DynamicDataImpl::deserialize_member(
+        eprosima::fastcdr::Cdr& cdr,
+        const traits<DynamicTypeMemberImpl>::ref_type& member)
+{
+    traits<DynamicDataImpl>::ref_type member_data;
+    auto it = value_.find(member->get_id());
+
+    if (it != value_.end())
+    {
+        member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+    }
+    else
+    {
+        member_data = traits<DynamicData>::narrow<DynamicDataImpl>(
+            DynamicDataFactory::get_instance()->create_data(member->get_descriptor().type()));
+        value_.emplace(member->get_id(), member_data);
+    }
+
+    cdr >> member_data;
+}
+
+std::shared_ptr<const DynamicDataLayout> DynamicDataImpl::create_layout(
+        const traits<DynamicTypeImpl>::ref_type& type) noexcept
+{
+    assert(TK_STRUCTURE == type->get_kind());
+    auto layout = std::make_shared<DynamicDataLayout>();
+    std::vector<MemberId> ids;
+
+    for (auto& member : type->get_all_members_by_index())
+    {
+        ids.push_back(member->get_id());
+        auto member_type = get_enclosing_type(traits<DynamicType>::narrow<DynamicTypeImpl>(
+                            member->get_descriptor().type()));
+        TypeKind member_kind = member_type->get_kind();
+
+        if (0 < DynamicDataLayout::inline_size(member_kind))
+        {
+            DynamicDataLayout::Member placement = layout->add_member(member->get_id(), member_type, member_kind);
+
+            if (0 < member->get_descriptor().default_value().length())
+            {
+                // Let the primitive DynamicData parse the default value, as it does for the members not kept inline.
+                auto data = traits<DynamicData>::narrow<DynamicDataImpl>(
+                    DynamicDataFactory::get_instance()->create_data(member->get_descriptor().type()));
+                data->set_value(member->get_descriptor().default_value());
+                layout->set_default(placement, data->value_.begin()->second.get());
+            }
+        }
+    }
+
+    if (layout->members().empty())
+    {
+        return {};
+    }
+
+    // Mutable structures precede every member with its own header.
+    layout->compile(ids, ExtensibilityKind::MUTABLE != type->get_descriptor().extensibility_kind());
+    return layout;
+}
+
 //}}}
 
 //}}}
@@ -2458,6 +2829,20 @@ ReturnCode_t DynamicDataImpl::clear_all_values(
                 set_default_value(member, data);
             }
         }
+
+        if (nullptr != layout_)
+        {
+            for (const auto& inline_placement : layout_->members())
+            {
+                const auto it = members.find(inline_placement.id);
+                assert(members.end() != it);
+                auto member = traits<DynamicTypeMember>::narrow<DynamicTypeMemberImpl>(it->second);
+                if (!only_non_keyed || !member->get_descriptor().is_key())
+                {
+                    reset_inline_value(inline_placement);
+                }
+            }
+        }
     }
     else
     {
@@ -3053,7 +3438,7 @@ TypeKind DynamicDataImpl::get_enclosing_typekind(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::get_primitive_value(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         TypeForKind<TK>& value,
         MemberId member_id) noexcept
 {
@@ -3061,7 +3446,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
 
     if (TK == element_kind)
     {
-        value = *std::static_pointer_cast<TypeForKind<TK>>(value_iterator->second);
+        value = *std::static_pointer_cast<TypeForKind<TK>>(value_pointer);
         ret_value =  RETCODE_OK;
     }
     else
@@ -3074,7 +3459,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_INT8>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3084,7 +3469,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_UINT8>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3094,7 +3479,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_INT16>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3104,7 +3489,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_UINT16>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3114,7 +3499,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_INT32>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3124,7 +3509,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_UINT32>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3134,7 +3519,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_INT64>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3144,7 +3529,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_UINT64>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3154,7 +3539,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_FLOAT32>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3164,7 +3549,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_FLOAT64>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3174,7 +3559,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_FLOAT128>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3184,7 +3569,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_CHAR8>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3194,7 +3579,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_CHAR16>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3204,7 +3589,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_BYTE>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
@@ -3214,14 +3599,14 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
                     assert(MEMBER_ID_INVALID == member_id);
                     value =
                             static_cast<TypeForKind<TK>>(*std::static_pointer_cast<TypeForKind<TK_BOOLEAN>>(
-                                value_iterator->second));
+                                value_pointer));
                     ret_value =  RETCODE_OK;
                 }
                 break;
             case TK_STRING8:
                 if (MEMBER_ID_INVALID != member_id && TypePromotion<TK_CHAR8, TK>::value)
                 {
-                    auto str = std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_iterator->second);
+                    auto str = std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_pointer);
                     if (member_id < str->length())
                     {
                         value = str->at(member_id);
@@ -3233,7 +3618,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
             case TK_STRING16:
                 if (MEMBER_ID_INVALID != member_id && TypePromotion<TK_CHAR16, TK>::value)
                 {
-                    auto str = std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_iterator->second);
+                    auto str = std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_pointer);
                     if (member_id < str->length())
                     {
                         value = static_cast<TypeForKind<TK>>(str->at(member_id));
@@ -3258,7 +3643,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value(
 template<>
 ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING8>(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         TypeForKind<TK_STRING8>& value,
         MemberId member_id) noexcept
 {
@@ -3266,7 +3651,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING8>(
 
     if (TK_STRING8 == element_kind)
     {
-        auto str = std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_iterator->second);
+        auto str = std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_pointer);
 
         if (MEMBER_ID_INVALID == member_id)
         {
@@ -3291,7 +3676,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING8>(
 template<>
 ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING16>(
         TypeKind element_kind,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         TypeForKind<TK_STRING16>& value,
         MemberId member_id) noexcept
 {
@@ -3299,7 +3684,7 @@ ReturnCode_t DynamicDataImpl::get_primitive_value<TK_STRING16>(
 
     if (TK_STRING16 == element_kind)
     {
-        auto str = std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_iterator->second);
+        auto str = std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_pointer);
 
         if (MEMBER_ID_INVALID == member_id)
         {
@@ -3769,8 +4154,14 @@ ReturnCode_t DynamicDataImpl::get_value(
     {
         if (MEMBER_ID_INVALID != id && (TK_UNION != type_kind || 0 == id || selected_union_member_ == id))
         {
-            auto it = value_.find(id);
-            if (it != value_.end())
+            const DynamicDataLayout::Member* inline_placement = inline_member(id);
+            auto it = nullptr == inline_placement ? value_.find(id) : value_.end();
+            if (nullptr != inline_placement)
+            {
+                ret_value = get_primitive_value<TK>(inline_placement->kind, inline_value_pointer(*inline_placement),
+                                value, MEMBER_ID_INVALID);
+            }
+            else if (it != value_.end())
             {
                 ret_value =  std::static_pointer_cast<DynamicDataImpl>(it->second)->get_value<TK>(
                     value,
@@ -3836,7 +4227,7 @@ ReturnCode_t DynamicDataImpl::get_value(
                 }
                 else
                 {
-                    ret_value = get_primitive_value<TK>(element_kind, it, value, MEMBER_ID_INVALID);
+                    ret_value = get_primitive_value<TK>(element_kind, it->second, value, MEMBER_ID_INVALID);
                 }
             }
             else
@@ -3858,13 +4249,60 @@ ReturnCode_t DynamicDataImpl::get_value(
         if (MEMBER_ID_INVALID == id || TK_STRING8 == type_kind || TK_STRING16 == type_kind)
         {
             assert(1 == value_.size() && MEMBER_ID_INVALID == value_.begin()->first);
-            ret_value = get_primitive_value<TK>(type_kind, value_.begin(), value, id);
+            ret_value = get_primitive_value<TK>(type_kind, value_.begin()->second, value, id);
         }
     }
 
     return ret_value;
 }
 
+const DynamicDataLayout::Member* DynamicDataImpl::inline_member(
+        MemberId id) const noexcept
+{
+    return nullptr != layout_ ? layout_->find(id) : nullptr;
+}
+
+traits<DynamicDataImpl>::ref_type DynamicDataImpl::inline_member_data(
+        const DynamicDataLayout::Member& member) const noexcept
+{
+    traits<DynamicTypeMember>::ref_type type_member;
+    enclosing_type_->get_member(type_member, member.id);
+    assert(type_member);
+
+    auto member_impl = traits<DynamicTypeMember>::narrow<DynamicTypeMemberImpl>(type_member);
+    auto data = traits<DynamicData>::narrow<DynamicDataImpl>(
+        DynamicDataFactory::get_instance()->create_data(member_impl->get_descriptor().type()));
+    assert(1 == data->value_.size());
+    std::memcpy(data->value_.begin()->second.get(), inline_value(member), member.size);
+    return data;
+}
+
+void* DynamicDataImpl::inline_value(
+        const DynamicDataLayout::Member& member) noexcept
+{
+    return reinterpret_cast<uint8_t*>(inline_values_.data()) + member.offset;
+}
+
+const void* DynamicDataImpl::inline_value(
+        const DynamicDataLayout::Member& member) const noexcept
+{
+    return reinterpret_cast<const uint8_t*>(inline_values_.data()) + member.offset;
+}
+
+std::shared_ptr<void> DynamicDataImpl::inline_value_pointer(
+        const DynamicDataLayout::Member& member) const noexcept
+{
+    // Aliasing constructor with an empty owner: the pointer does not keep anything alive.
+    return std::shared_ptr<void>(std::shared_ptr<void>(), const_cast<void*>(inline_value(member)));
+}
+
+void DynamicDataImpl::reset_inline_value(
+        const DynamicDataLayout::Member& member) noexcept
+{
+    std::memcpy(inline_value(member), reinterpret_cast<const uint8_t*>(layout_->defaults().data()) + member.offset,
+            member.size);
+}
+
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::set_bitmask_bit(
         MemberId id,
@@ -4061,7 +4499,7 @@ void DynamicDataImpl::set_discriminator_value(
 template<TypeKind TK>
 ReturnCode_t DynamicDataImpl::set_primitive_value(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         const TypeForKind<TK>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4069,7 +4507,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
 
     if (TK == element_kind)
     {
-        *std::static_pointer_cast<TypeForKind<TK>>(value_iterator->second) = value;
+        *std::static_pointer_cast<TypeForKind<TK>>(value_pointer) = value;
         ret_value =  RETCODE_OK;
     }
     else
@@ -4079,7 +4517,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_INT8:
                 if (TypePromotion<TK, TK_INT8>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_INT8>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_INT8>>(value_pointer) =
                             static_cast<TypeForKind<TK_INT8>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4087,7 +4525,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_UINT8:
                 if (TypePromotion<TK, TK_UINT8>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_UINT8>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_UINT8>>(value_pointer) =
                             static_cast<TypeForKind<TK_UINT8>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4095,7 +4533,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_INT16:
                 if (TypePromotion<TK, TK_INT16>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_INT16>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_INT16>>(value_pointer) =
                             static_cast<TypeForKind<TK_INT16>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4103,7 +4541,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_UINT16:
                 if (TypePromotion<TK, TK_UINT16>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_UINT16>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_UINT16>>(value_pointer) =
                             static_cast<TypeForKind<TK_UINT16>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4111,7 +4549,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_INT32:
                 if (TypePromotion<TK, TK_INT32>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_INT32>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_INT32>>(value_pointer) =
                             static_cast<TypeForKind<TK_INT32>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4119,7 +4557,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_UINT32:
                 if (TypePromotion<TK, TK_UINT32>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_UINT32>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_UINT32>>(value_pointer) =
                             static_cast<TypeForKind<TK_UINT32>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4127,7 +4565,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_INT64:
                 if (TypePromotion<TK, TK_INT64>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_INT64>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_INT64>>(value_pointer) =
                             static_cast<TypeForKind<TK_INT64>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4135,7 +4573,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_UINT64:
                 if (TypePromotion<TK, TK_UINT64>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_UINT64>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_UINT64>>(value_pointer) =
                             static_cast<TypeForKind<TK_UINT64>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4143,7 +4581,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_FLOAT32:
                 if (TypePromotion<TK, TK_FLOAT32>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_FLOAT32>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_FLOAT32>>(value_pointer) =
                             static_cast<TypeForKind<TK_FLOAT32>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4151,7 +4589,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_FLOAT64:
                 if (TypePromotion<TK, TK_FLOAT64>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_FLOAT64>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_FLOAT64>>(value_pointer) =
                             static_cast<TypeForKind<TK_FLOAT64>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4159,7 +4597,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_FLOAT128:
                 if (TypePromotion<TK, TK_FLOAT128>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_FLOAT128>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_FLOAT128>>(value_pointer) =
                             static_cast<TypeForKind<TK_FLOAT128>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4167,7 +4605,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_CHAR8:
                 if (TypePromotion<TK, TK_CHAR8>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_CHAR8>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_CHAR8>>(value_pointer) =
                             static_cast<TypeForKind<TK_CHAR8>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4175,7 +4613,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_CHAR16:
                 if (TypePromotion<TK, TK_CHAR16>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_CHAR16>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_CHAR16>>(value_pointer) =
                             static_cast<TypeForKind<TK_CHAR16>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4183,7 +4621,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_BYTE:
                 if (TypePromotion<TK, TK_BYTE>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_BYTE>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_BYTE>>(value_pointer) =
                             static_cast<TypeForKind<TK_BYTE>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4191,7 +4629,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
             case TK_BOOLEAN:
                 if (TypePromotion<TK, TK_BOOLEAN>::value)
                 {
-                    *std::static_pointer_cast<TypeForKind<TK_BOOLEAN>>(value_iterator->second) =
+                    *std::static_pointer_cast<TypeForKind<TK_BOOLEAN>>(value_pointer) =
                             static_cast<TypeForKind<TK_BOOLEAN>>(value);
                     ret_value =  RETCODE_OK;
                 }
@@ -4207,7 +4645,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value(
 template<>
 ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING8>(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         const TypeForKind<TK_STRING8>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4217,7 +4655,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING8>(
                 static_cast<uint32_t>(LENGTH_UNLIMITED) == element_type->get_descriptor().bound().at(0) ||
                 value.size() <= element_type->get_descriptor().bound().at(0)))
     {
-        *std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_iterator->second) = value;
+        *std::static_pointer_cast<TypeForKind<TK_STRING8>>(value_pointer) = value;
         ret_value =  RETCODE_OK;
     }
     else
@@ -4231,7 +4669,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING8>(
 template<>
 ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING16>(
         const traits<DynamicTypeImpl>::ref_type& element_type,
-        std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+        const std::shared_ptr<void>& value_pointer,
         const TypeForKind<TK_STRING16>& value) noexcept
 {
     ReturnCode_t ret_value = RETCODE_BAD_PARAMETER;
@@ -4241,7 +4679,7 @@ ReturnCode_t DynamicDataImpl::set_primitive_value<TK_STRING16>(
                 static_cast<uint32_t>(LENGTH_UNLIMITED) == enclosing_type_->get_descriptor().bound().at(0) ||
                 value.size() <= enclosing_type_->get_descriptor().bound().at(0)))
     {
-        *std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_iterator->second) = value;
+        *std::static_pointer_cast<TypeForKind<TK_STRING16>>(value_pointer) = value;
         ret_value =  RETCODE_OK;
     }
     else
@@ -4870,8 +5308,14 @@ ReturnCode_t DynamicDataImpl::set_value(
                 }
             }
 
-            auto it = value_.find(id);
-            if (it != value_.end())
+            const DynamicDataLayout::Member* inline_placement = inline_member(id);
+            auto it = nullptr == inline_placement ? value_.find(id) : value_.end();
+            if (nullptr != inline_placement)
+            {
+                ret_value = set_primitive_value<TK>(inline_placement->type, inline_value_pointer(*inline_placement),
+                                value);
+            }
+            else if (it != value_.end())
             {
                 TypeForKind<TK> new_value {value};
 
@@ -4941,7 +5385,7 @@ ReturnCode_t DynamicDataImpl::set_value(
                 }
                 else
                 {
-                    ret_value = set_primitive_value<TK>(element_type, it, value);
+                    ret_value = set_primitive_value<TK>(element_type, it->second, value);
                 }
             }
             else
@@ -4963,7 +5407,7 @@ ReturnCode_t DynamicDataImpl::set_value(
         if (MEMBER_ID_INVALID == id)
         {
             assert(1 == value_.size() && MEMBER_ID_INVALID == value_.begin()->first);
-            ret_value = set_primitive_value<TK>(enclosing_type_, value_.begin(), value);
+            ret_value = set_primitive_value<TK>(enclosing_type_, value_.begin()->second, value);
         }
     }
 
@@ -5593,15 +6037,45 @@ size_t DynamicDataImpl::calculate_serialized_size(
             eprosima::fastcdr::EncodingAlgorithmFlag previous_encoding = calculator.get_encoding();
             calculated_size = calculator.begin_calculate_type_serialized_size(encoding, current_alignment);
 
-            for (auto& member : type->get_all_members_by_index())
+            if (nullptr != layout_)
             {
-                it = value_.find(member->get_id());
-
-                if (it != value_.end())
+                for (const auto& instruction : layout_->plan())
                 {
-                    auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
-                    calculated_size += calculator.calculate_member_serialized_size(
-                        member->get_id(), member_data, current_alignment);
+                    if (1 < instruction.run)
+                    {
+                        InlineRunSizeCalculator size_calculator {calculator, current_alignment, instruction.run, 0};
+                        visit_inline_value(*instruction.placement, inline_value(*instruction.placement),
+                                size_calculator);
+                        calculated_size += size_calculator.calculated_size;
+                    }
+                    else if (1 == instruction.run)
+                    {
+                        InlineValueSizeCalculator size_calculator {calculator, current_alignment, instruction.id, 0};
+                        visit_inline_value(*instruction.placement, inline_value(*instruction.placement),
+                                size_calculator);
+                        calculated_size += size_calculator.calculated_size;
+                    }
+                    else if (nullptr == instruction.placement &&
+                            (it = value_.find(instruction.id)) != value_.end())
+                    {
+                        auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+                        calculated_size += calculator.calculate_member_serialized_size(
+                            instruction.id, member_data, current_alignment);
+                    }
+                }
+            }
+            else
+            {
+                for (auto& member : type->get_all_members_by_index())
+                {
+                    it = value_.find(member->get_id());
+
+                    if (it != value_.end())
+                    {
+                        auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+                        calculated_size += calculator.calculate_member_serialized_size(
+                            member->get_id(), member_data, current_alignment);
+                    }
                 }
             }
 
@@ -6364,6 +6838,10 @@ bool DynamicDataImpl::deserialize(
             eprosima::fastcdr::EncodingAlgorithmFlag encoding {get_fastcdr_encoding_flag(
                                                                    type->get_descriptor().extensibility_kind(),
                                                                    cdr.get_cdr_version())};
+            // An appendable structure may end before a run does, when the sample comes from a type with fewer
+            // members, so only final ones read runs as a block. Otherwise members are read one by one up to the
+            // end set by the DHEADER.
+            const bool read_runs {ExtensibilityKind::FINAL == type->get_descriptor().extensibility_kind()};
             cdr.deserialize_type(encoding,
                     [&](eprosima::fastcdr::Cdr& dcdr, const eprosima::fastcdr::MemberId& mid) -> bool
                     {
@@ -6375,6 +6853,36 @@ bool DynamicDataImpl::deserialize(
                         {
                             ret_value = (RETCODE_OK == type->get_member(member, mid.id));
                         }
+                        else if (nullptr != layout_)
+                        {
+                            // Members come in the order of their indexes, which is the order of the plan.
+                            if (layout_->plan().size() <= mid.id)
+                            {
+                                return false;
+                            }
+
+                            const auto& instruction = layout_->plan()[mid.id];
+
+                            if (read_runs && 1 < instruction.run)
+                            {
+                                InlineRunDeserializer deserializer {dcdr, instruction.run};
+                                visit_inline_value(*instruction.placement, inline_value(*instruction.placement),
+                                deserializer);
+                                return ret_value;
+                            }
+                            else if (nullptr != instruction.placement)
+                            {
+                                if (!read_runs || 1 == instruction.run)
+                                {
+                                    InlineValueDeserializer deserializer {dcdr};
+                                    visit_inline_value(*instruction.placement, inline_value(*instruction.placement),
+                                    deserializer);
+                                }
+                                return ret_value;
+                            }
+
+                            ret_value = (RETCODE_OK == type->get_member(member, instruction.id));
+                        }
                         else
                         {
                             ret_value = (RETCODE_OK == type->get_member_by_index(member, mid.id));
@@ -6383,23 +6891,17 @@ bool DynamicDataImpl::deserialize(
                         if (ret_value)
                         {
                             auto member_impl = traits<DynamicTypeMember>::narrow<DynamicTypeMemberImpl>(member);
-                            traits<DynamicDataImpl>::ref_type member_data;
-                            auto it = value_.find(member_impl->get_id());
+                            const DynamicDataLayout::Member* inline_placement = inline_member(member_impl->get_id());
 
-                            if (it != value_.end())
+                            if (nullptr != inline_placement)
                             {
-                                member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+                                InlineValueDeserializer deserializer {dcdr};
+                                visit_inline_value(*inline_placement, inline_value(*inline_placement), deserializer);
                             }
                             else
                             {
-                                member_data =
-                                traits<DynamicData>::narrow<DynamicDataImpl>(DynamicDataFactory::get_instance()
-                                        ->create_data(
-                                    member_impl->get_descriptor().type()));
-                                value_.emplace(it->first, member_data);
+                                deserialize_member(dcdr, member_impl);
                             }
-
-                            dcdr >> member_data;
                         }
 
                         return ret_value;
@@ -7074,20 +7576,31 @@ void DynamicDataImpl::serialize(
             eprosima::fastcdr::Cdr::state current_state(cdr);
             cdr.begin_serialize_type(current_state, encoding);
 
-            for (auto& member : type->get_all_members_by_index())
+            if (nullptr != layout_)
             {
-                auto it = value_.find(member->get_id());
-
-                if (it != value_.end())
+                for (const auto& instruction : layout_->plan())
                 {
-                    auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
-
-                    cdr << eprosima::fastcdr::MemberId{member->get_id()} << member_data;
+                    if (1 < instruction.run)
+                    {
+                        InlineRunSerializer serializer {cdr, instruction.run};
+                        visit_inline_value(*instruction.placement, inline_value(*instruction.placement), serializer);
+                    }
+                    else if (1 == instruction.run)
+                    {
+                        InlineValueSerializer serializer {cdr, instruction.id};
+                        visit_inline_value(*instruction.placement, inline_value(*instruction.placement), serializer);
+                    }
+                    else if (nullptr == instruction.placement)
+                    {
+                        serialize_member(cdr, instruction.id);
+                    }
                 }
-                else
+            }
+            else
+            {
+                for (auto& member : type->get_all_members_by_index())
                 {
-                    EPROSIMA_LOG_ERROR(DYN_TYPES,
-                            "Error serializing structure member because it is not found on DynamicData");
+                    serialize_member(cdr, member->get_id());
                 }
             }
 
@@ -21,6 +21,7 @@
 #include <fastdds/dds/core/Types.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
 
+#include "DynamicDataLayout.hpp"
 #include "DynamicTypeImpl.hpp"
 #include "TypeForKind.hpp"
 
@@ -59,6 +60,15 @@ class DynamicDataImpl : public traits<DynamicData>::base_type
     //! Points to the current selected member in the union.
     MemberId selected_union_member_ {MEMBER_ID_INVALID};
 
+    //! Placement of the members kept inline in TK_STRUCTURE. Owned by `enclosing_type_`.
+    const DynamicDataLayout* layout_ {nullptr};
+
+    //! Values of the members kept inline in TK_STRUCTURE, instead of on `value_`.
+    std::vector<DynamicDataLayout::block_type> inline_values_;
+
+    //! Values of the members kept inline that are loaned by the user.
+    std::map<MemberId, traits<DynamicDataImpl>::ref_type> loaned_inline_values_;
+
     //}}}
 
 public:
@@ -430,6 +440,15 @@ public:
     void serialize_key(
             eprosima::fastcdr::Cdr& cdr) const noexcept;
 
+    /*!
+     * Calculates the placement of the members that the samples of a TK_STRUCTURE keep inline, along with their
+     * default values.
+     * @param type TK_STRUCTURE type.
+     * @return The layout, or nullptr if no member can be kept inline.
+     */
+    static std::shared_ptr<const DynamicDataLayout> create_layout(
+            const traits<DynamicTypeImpl>::ref_type& type) noexcept;
+
     //}}}
 
     //}}}
@@ -595,7 +614,7 @@ private:
     template<TypeKind TK >
     ReturnCode_t get_primitive_value(
             TypeKind element_kind,
-            std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+            const std::shared_ptr<void>& value_pointer,
             TypeForKind<TK>& value,
             MemberId member_id) noexcept;
 
@@ -653,6 +672,37 @@ private:
             TypeForKind<TK>& value,
             MemberId id) noexcept;
 
+    /*!
+     * @brief Returns the placement of a member kept inline, or nullptr if it is kept on `value_`.
+     */
+    const DynamicDataLayout::Member* inline_member(
+            MemberId id) const noexcept;
+
+    /*!
+     * @brief Returns a DynamicData with a copy of the value of a member kept inline.
+     */
+    traits<DynamicDataImpl>::ref_type inline_member_data(
+            const DynamicDataLayout::Member& member) const noexcept;
+
+    void* inline_value(
+            const DynamicDataLayout::Member& member) noexcept;
+
+    const void* inline_value(
+            const DynamicDataLayout::Member& member) const noexcept;
+
+    /*!
+     * @brief Returns a non-owning pointer to the value of a member kept inline, to be used by the functions working
+     * on the values of `value_`.
+     */
+    std::shared_ptr<void> inline_value_pointer(
+            const DynamicDataLayout::Member& member) const noexcept;
+
+    /*!
+     * @brief Sets the default value of a member kept inline.
+     */
+    void reset_inline_value(
+            const DynamicDataLayout::Member& member) noexcept;
+
     /*!
      * Auxiliary function for setting a bitmask bit.
      */
@@ -685,7 +735,7 @@ private:
     template<TypeKind TK>
     ReturnCode_t set_primitive_value(
             const traits<DynamicTypeImpl>::ref_type& element_type,
-            std::map<MemberId, std::shared_ptr<void>>::iterator value_iterator,
+            const std::shared_ptr<void>& value_pointer,
             const TypeForKind<TK>& value) noexcept;
 
     /*!
@@ -757,6 +807,16 @@ private:
             eprosima::fastcdr::Cdr& cdr,
             const traits<DynamicTypeImpl>::ref_type type) const;
 
+    //! Serializes a member of a structure kept as a DynamicData object.
+    void serialize_member(
+            eprosima::fastcdr::Cdr& cdr,
+            MemberId id) const;
+
+    //! Deserializes a member of a structure kept as a DynamicData object, creating it if it does not exist yet.
+    void deserialize_member(
+            eprosima::fastcdr::Cdr& cdr,
+            const traits<DynamicTypeMemberImpl>::ref_type& member);
+
     //}}}
 
 };
@@ -0,0 +1,262 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATALAYOUT_HPP
+#define FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATALAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
+
+#include "TypeForKind.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DynamicTypeImpl;
+
+/**
+ * Placement of the members of a structure that DynamicDataImpl keeps inline, on a single buffer per sample.
+ *
+ * Members whose type is primitive, once aliases are resolved, are placed at fixed offsets of the buffer.
+ * The rest of members are kept as independent DynamicData objects.
+ * It is computed once, when the structure type is built, together with the serialization plan of the structure.
+ */
+class DynamicDataLayout
+{
+public:
+
+    //! Unit of the inline buffers, aligned for any of the inline kinds.
+    using block_type = std::aligned_storage<sizeof(long double), alignof(long double)>::type;
+
+    struct Member
+    {
+        //! MemberId of the member.
+        MemberId id;
+        //! Kind of the type of the member, once aliases are resolved.
+        TypeKind kind;
+        //! Type of the member, once aliases are resolved.
+        std::shared_ptr<DynamicTypeImpl> type;
+        //! Offset of the value on the buffer.
+        uint32_t offset;
+        //! Size of the value.
+        uint32_t size;
+    };
+
+    /**
+     * Step of the serialization plan of a structure.
+     *
+     * There is one step per member of the structure, in the order of their indexes.
+     */
+    struct Instruction
+    {
+        //! MemberId of the member.
+        MemberId id;
+        //! Placement of the member, or nullptr if the member is kept as a DynamicData object.
+        const Member* placement;
+        //! Number of inline members, starting with this one, which are (de)serialized as a single array.
+        //! 0 if the member is kept as a DynamicData object or is (de)serialized as part of the run of a previous one.
+        uint32_t run;
+    };
+
+    /**
+     * Get the size of the values of a kind that can be stored inline.
+     * @param kind Kind of the value.
+     * @return Size of the value, or 0 if values of the kind are not stored inline.
+     */
+    static uint32_t inline_size(
+            TypeKind kind) noexcept
+    {
+        switch (kind)
+        {
+            case TK_BOOLEAN:
+                return sizeof(TypeForKind<TK_BOOLEAN>);
+            case TK_BYTE:
+                return sizeof(TypeForKind<TK_BYTE>);
+            case TK_INT8:
+                return sizeof(TypeForKind<TK_INT8>);
+            case TK_UINT8:
+                return sizeof(TypeForKind<TK_UINT8>);
+            case TK_INT16:
+                return sizeof(TypeForKind<TK_INT16>);
+            case TK_UINT16:
+                return sizeof(TypeForKind<TK_UINT16>);
+            case TK_INT32:
+                return sizeof(TypeForKind<TK_INT32>);
+            case TK_UINT32:
+                return sizeof(TypeForKind<TK_UINT32>);
+            case TK_INT64:
+                return sizeof(TypeForKind<TK_INT64>);
+            case TK_UINT64:
+                return sizeof(TypeForKind<TK_UINT64>);
+            case TK_FLOAT32:
+                return sizeof(TypeForKind<TK_FLOAT32>);
+            case TK_FLOAT64:
+                return sizeof(TypeForKind<TK_FLOAT64>);
+            case TK_FLOAT128:
+                return sizeof(TypeForKind<TK_FLOAT128>);
+            case TK_CHAR8:
+                return sizeof(TypeForKind<TK_CHAR8>);
+            case TK_CHAR16:
+                return sizeof(TypeForKind<TK_CHAR16>);
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * Place a member at the end of the buffer.
+     * @param id MemberId of the member.
+     * @param type Type of the member, once aliases are resolved. Its kind should be one stored inline.
+     * @param kind Kind of @c type.
+     * @return Placement of the member.
+     */
+    Member add_member(
+            MemberId id,
+            const std::shared_ptr<DynamicTypeImpl>& type,
+            TypeKind kind)
+    {
+        uint32_t size = inline_size(kind);
+        uint32_t alignment = (std::min)(size, static_cast<uint32_t>(alignof(block_type)));
+        uint32_t offset = (size_ + alignment - 1u) & ~(alignment - 1u);
+        size_ = offset + size;
+        defaults_.resize(blocks());
+
+        Member member {id, kind, type, offset, size};
+        members_.insert(std::upper_bound(members_.begin(), members_.end(), member,
+                [](const Member& l, const Member& r)
+                {
+                    return l.id < r.id;
+                }), member);
+        return member;
+    }
+
+    /**
+     * Set the default value of a member.
+     * @param member Member whose default value is set.
+     * @param value Pointer to the default value, which should have the size of the member.
+     */
+    void set_default(
+            const Member& member,
+            const void* value) noexcept
+    {
+        std::memcpy(reinterpret_cast<uint8_t*>(defaults_.data()) + member.offset, value, member.size);
+    }
+
+    /**
+     * Find a member stored inline.
+     * @param id MemberId of the member.
+     * @return Pointer to the placement of the member, or nullptr if it is not stored inline.
+     */
+    const Member* find(
+            MemberId id) const noexcept
+    {
+        // MemberIds are usually consecutive from 0
+        if (id < members_.size() && members_[id].id == id)
+        {
+            return &members_[id];
+        }
+
+        auto it = std::lower_bound(members_.begin(), members_.end(), id,
+                        [](const Member& member, MemberId value)
+                        {
+                            return member.id < value;
+                        });
+        return (members_.end() != it && it->id == id) ? &*it : nullptr;
+    }
+
+    //! Members stored inline, sorted by MemberId.
+    const std::vector<Member>& members() const noexcept
+    {
+        return members_;
+    }
+
+    /**
+     * Compute the serialization plan of the structure, once all the inline members have been added.
+     *
+     * Consecutive inline members of the same kind are placed one after the other on the buffer, which is how an
+     * array of that kind is kept in memory, so they can be (de)serialized at once as an array without changing the
+     * CDR stream, as long as members are not preceded by a member header.
+     * @param ids MemberIds of all the members of the structure, in the order of their indexes.
+     * @param join_runs Whether consecutive inline members of the same kind are (de)serialized as a single array.
+     * It must be false for the structures encoded with member headers, i.e. the mutable ones.
+     * Runs of appendable structures are only written as a block, as the samples read may end before a run does.
+     */
+    void compile(
+            const std::vector<MemberId>& ids,
+            bool join_runs)
+    {
+        plan_.clear();
+        plan_.reserve(ids.size());
+        Instruction* run_start {nullptr};
+
+        for (MemberId id : ids)
+        {
+            const Member* placement = find(id);
+
+            if (join_runs && nullptr != placement && nullptr != run_start &&
+                    run_start->placement->kind == placement->kind &&
+                    run_start->placement->offset + run_start->run * placement->size == placement->offset)
+            {
+                ++run_start->run;
+                plan_.push_back({id, placement, 0});
+                continue;
+            }
+
+            plan_.push_back({id, placement, nullptr != placement ? 1u : 0u});
+            run_start = nullptr != placement ? &plan_.back() : nullptr;
+        }
+    }
+
+    //! Serialization plan of the structure, with one step per member in the order of their indexes.
+    const std::vector<Instruction>& plan() const noexcept
+    {
+        return plan_;
+    }
+
+    //! Number of blocks of a buffer.
+    size_t blocks() const noexcept
+    {
+        return (size_ + sizeof(block_type) - 1u) / sizeof(block_type);
+    }
+
+    //! Buffer with the default values of all the members, to initialize the buffers of new samples.
+    const std::vector<block_type>& defaults() const noexcept
+    {
+        return defaults_;
+    }
+
+private:
+
+    std::vector<Member> members_;
+
+    std::vector<block_type> defaults_;
+
+    std::vector<Instruction> plan_;
+
+    uint32_t size_ {0};
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_XTYPES_DYNAMIC_TYPES_DYNAMICDATALAYOUT_HPP
@@ -23,6 +23,7 @@
 #include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
 
 #include "AnnotationDescriptorImpl.hpp"
+#include "DynamicDataImpl.hpp"
 #include "DynamicTypeImpl.hpp"
 #include "DynamicTypeMemberImpl.hpp"
 #include "MemberDescriptorImpl.hpp"
@@ -680,6 +681,11 @@ traits<DynamicType>::ref_type DynamicTypeBuilderImpl::build() noexcept
             ret_val->default_value_ = default_value_;
             ret_val->default_union_member_ = default_union_member_;
             ret_val->index_own_members_ = index_own_members_;
+
+            if (TK_STRUCTURE == type_descriptor_.kind())
+            {
+                ret_val->data_layout_ = DynamicDataImpl::create_layout(ret_val);
+            }
         }
     }
 
@@ -22,6 +22,7 @@
 #include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
 
 #include "AnnotationDescriptorImpl.hpp"
+#include "DynamicDataLayout.hpp"
 #include "DynamicTypeMemberImpl.hpp"
 #include "TypeDescriptorImpl.hpp"
 #include "VerbatimTextDescriptorImpl.hpp"
@@ -118,6 +119,15 @@ public:
 
     traits<DynamicTypeImpl>::ref_type resolve_alias_enclosed_type() noexcept;
 
+    /**
+     * Get the placement of the members that the samples of this type keep inline.
+     * @return Pointer to the layout, or nullptr if the samples of this type do not keep members inline.
+     */
+    const DynamicDataLayout* data_layout() const noexcept
+    {
+        return data_layout_.get();
+    }
+
 protected:
 
     traits<DynamicType>::ref_type _this();
@@ -151,6 +161,9 @@ private:
 
     //! Contains the verbatim builtin annotation applied by the user.
     std::vector<VerbatimTextDescriptorImpl> verbatim_;
+
+    //! Placement of the members kept inline by the samples of a TK_STRUCTURE. Calculated when the type is built.
+    std::shared_ptr<const DynamicDataLayout> data_layout_;
 };
 
 } // namespace dds
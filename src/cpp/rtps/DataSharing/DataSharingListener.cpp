@@ -37,7 +37,8 @@ DataSharingListener::DataSharingListener(
         const std::string& datasharing_pools_directory,
         const ThreadSettings& thr_config,
         ResourceLimitedContainerConfig limits,
-        BaseReader* reader)
+        BaseReader* reader,
+        uint32_t spin_budget_us)
     : notification_(notification)
     , is_running_(false)
     , reader_(reader)
@@ -45,6 +46,7 @@ DataSharingListener::DataSharingListener(
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
     , thread_config_(thr_config)
+    , spin_(spin_budget_us)
 {
 }
 
@@ -59,20 +61,23 @@ void DataSharingListener::run()
     std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex, std::defer_lock);
     while (is_running_.load())
     {
-        try
+        if (!spin_for_new_data())
         {
-            lock.lock();
-            notification_->notification_->notification_cv.wait(lock, [&]
-                    {
-                        return !is_running_.load() || notification_->notification_->new_data.load();
-                    });
+            try
+            {
+                lock.lock();
+                notification_->notification_->notification_cv.wait(lock, [&]
+                        {
+                            return !is_running_.load() || notification_->notification_->new_data.load();
+                        });
 
-            lock.unlock();
-        }
-        catch (const boost::interprocess::interprocess_exception& /*e*/)
-        {
-            // Timeout when locking
-            continue;
+                lock.unlock();
+            }
+            catch (const boost::interprocess::interprocess_exception& /*e*/)
+            {
+                // Timeout when locking
+                continue;
+            }
         }
 
         if (!is_running_.load())
@@ -92,6 +97,26 @@ void DataSharingListener::run()
     }
 }
 
+bool DataSharingListener::spin_for_new_data()
+{
+    if (!spin_.enabled())
+    {
+        return false;
+    }
+
+    Notification* notification = notification_->notification_;
+    ListenerState* listener_state = notification_->listener_state_;
+    listener_state->spinning.store(true);
+    bool ret = spin_.spin([&]
+                    {
+                        return !is_running_.load() || notification->new_data.load();
+                    });
+    listener_state->spinning.store(false);
+
+    // Writers seeing the flag set have not notified, so check again once it is cleared
+    return ret || !is_running_.load() || notification->new_data.load();
+}
+
 void DataSharingListener::start()
 {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -30,6 +30,7 @@
 #include <rtps/DataSharing/IDataSharingListener.hpp>
 #include <rtps/DataSharing/DataSharingNotification.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
+#include <utils/AdaptiveSpin.hpp>
 #include <utils/thread.hpp>
 
 namespace eprosima {
@@ -55,6 +56,7 @@ class DataSharingListener : public IDataSharingListener
 public:
 
     typedef DataSharingNotification::Notification Notification;
+    typedef DataSharingNotification::ListenerState ListenerState;
     typedef DataSharingNotification::Segment Segment;
 
     DataSharingListener(
@@ -62,7 +64,8 @@ public:
             const std::string& datasharing_pools_directory,
             const ThreadSettings& thr_config,
             ResourceLimitedContainerConfig limits,
-            BaseReader* reader);
+            BaseReader* reader,
+            uint32_t spin_budget_us = 0);
 
     virtual ~DataSharingListener();
 
@@ -102,6 +105,12 @@ protected:
      */
     void run();
 
+    /**
+     * Poll for new data, without blocking, during the spin budget of the listener.
+     * @return whether there is new data to process or the listener was stopped.
+     */
+    bool spin_for_new_data();
+
     /**
      * Processes a notification
      */
@@ -131,6 +140,7 @@ protected:
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
     ThreadSettings thread_config_;
+    AdaptiveSpin spin_;
     mutable std::mutex mutex_;
 
 };
@@ -29,6 +29,7 @@
 #include <vector>
 #include <mutex>
 #include <atomic>
+#include <string>
 
 namespace eprosima {
 namespace fastdds {
@@ -53,6 +54,14 @@ public:
      */
     inline void notify()
     {
+        // A listener polling new_data does not need to be woken up.
+        // The listener clears its flag before checking new_data for the last time, so the data cannot be missed.
+        notification_->new_data.store(true);
+        if (nullptr != listener_state_ && listener_state_->spinning.load())
+        {
+            return;
+        }
+
         try
         {
             std::unique_lock<Segment::mutex> lock(notification_->notification_mutex);
@@ -111,8 +120,23 @@ protected:
         //! New data available
         std::atomic<bool> new_data;
     };
+
+    /**
+     * State of the listener, kept apart from Notification so the layout of the latter does not change.
+     * Segments created by versions without it lack this object, and writers then always notify.
+     */
+    struct alignas (8) ListenerState
+    {
+        //! The listener is polling new_data instead of waiting on notification_cv
+        std::atomic<bool> spinning;
+    };
 #pragma warning(pop)
 
+    constexpr static const char* listener_state_name()
+    {
+        return "listener_state_node";
+    }
+
     static std::string generate_segment_name(
             const std::string& shared_dir,
             const GUID_t& reader_guid)
@@ -147,7 +171,8 @@ protected:
         {
             uint32_t per_allocation_extra_size = T::compute_per_allocation_extra_size(
                 alignof(Notification), DataSharingNotification::domain_name());
-            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification)) + per_allocation_extra_size;
+            uint32_t segment_size = static_cast<uint32_t>(sizeof(Notification) + sizeof(ListenerState) +
+                    std::char_traits<char>::length(listener_state_name())) + 2 * per_allocation_extra_size;
 
             //Open the segment
             T::remove(segment_name_);
@@ -169,6 +194,8 @@ protected:
             // Alloc and initialize the Node
             notification_ = local_segment->get().template construct<Notification>("notification_node")();
             notification_->new_data.store(false);
+            listener_state_ = local_segment->get().template construct<ListenerState>(listener_state_name())();
+            listener_state_->spinning.store(false);
         }
         catch (std::exception& e)
         {
@@ -218,6 +245,9 @@ protected:
             return false;
         }
 
+        // Not found on segments of listeners from previous versions, which never spin
+        listener_state_ = (local_segment->get().template find<ListenerState>(listener_state_name())).first;
+
         segment_ = std::move(local_segment);
         return true;
     }
@@ -227,6 +257,7 @@ protected:
 
     std::unique_ptr<Segment> segment_;  //< Shared memory segment
     Notification* notification_;        //< The notification data
+    ListenerState* listener_state_ = nullptr;   //< The state of the listener, if its version keeps it
     bool owned_ = false;                //< Whether the shared segment is owned by this instance
 };
 
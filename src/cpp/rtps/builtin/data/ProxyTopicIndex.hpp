@@ -0,0 +1,161 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxyTopicIndex.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DATA_PROXYTOPICINDEX_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DATA_PROXYTOPICINDEX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Index of endpoint proxies by the name of their topic.
+ *
+ * Proxies are only referenced, so they should be removed from the index before being released.
+ * The topic a proxy is indexed under is remembered, so it can be removed even when its topic name has changed or its
+ * data has been moved somewhere else.
+ *
+ * @tparam Proxy Type of the proxies, providing topicName().
+ */
+template<class Proxy>
+class ProxyTopicIndex
+{
+public:
+
+    ProxyTopicIndex() = default;
+
+    ProxyTopicIndex(
+            const ProxyTopicIndex&) = delete;
+
+    ProxyTopicIndex& operator =(
+            const ProxyTopicIndex&) = delete;
+
+    /**
+     * Add a proxy under its current topic name, moving it there if it was already on the index.
+     * @param proxy Proxy to add.
+     */
+    void add(
+            Proxy* proxy)
+    {
+        std::string topic_name(proxy->topicName().c_str());
+        auto it = topic_of_.find(proxy);
+        if (it != topic_of_.end())
+        {
+            if (it->second == topic_name)
+            {
+                return;
+            }
+            erase_from_topic(it->second, proxy);
+            it->second = topic_name;
+        }
+        else
+        {
+            topic_of_.emplace(proxy, topic_name);
+        }
+
+        proxies_by_topic_[topic_name].push_back(proxy);
+    }
+
+    /**
+     * Remove a proxy.
+     * @param proxy Proxy to remove.
+     * @return Whether the proxy was on the index.
+     */
+    bool remove(
+            const Proxy* proxy)
+    {
+        auto it = topic_of_.find(proxy);
+        if (it == topic_of_.end())
+        {
+            return false;
+        }
+
+        erase_from_topic(it->second, proxy);
+        topic_of_.erase(it);
+        return true;
+    }
+
+    /**
+     * Get the proxies on a topic.
+     * @param topic_name  Name of the topic.
+     * @param [out] proxies  Vector where the proxies on the topic are appended.
+     */
+    void get(
+            const std::string& topic_name,
+            std::vector<Proxy*>& proxies) const
+    {
+        auto it = proxies_by_topic_.find(topic_name);
+        if (it != proxies_by_topic_.end())
+        {
+            proxies.insert(proxies.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    size_t size() const
+    {
+        return topic_of_.size();
+    }
+
+    void clear()
+    {
+        proxies_by_topic_.clear();
+        topic_of_.clear();
+    }
+
+private:
+
+    void erase_from_topic(
+            const std::string& topic_name,
+            const Proxy* proxy)
+    {
+        auto topic_it = proxies_by_topic_.find(topic_name);
+        if (topic_it == proxies_by_topic_.end())
+        {
+            return;
+        }
+
+        std::vector<Proxy*>& proxies = topic_it->second;
+        auto it = std::find(proxies.begin(), proxies.end(), proxy);
+        if (it != proxies.end())
+        {
+            *it = proxies.back();
+            proxies.pop_back();
+        }
+        if (proxies.empty())
+        {
+            proxies_by_topic_.erase(topic_it);
+        }
+    }
+
+    //! Proxies on each topic
+    std::unordered_map<std::string, std::vector<Proxy*>> proxies_by_topic_;
+    //! Topic each proxy is indexed under
+    std::unordered_map<const Proxy*, std::string> topic_of_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_BUILTIN_DATA_PROXYTOPICINDEX_HPP_
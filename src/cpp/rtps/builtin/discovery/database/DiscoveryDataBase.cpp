@@ -17,16 +17,21 @@
  *
  */
 
+#include <algorithm>
 #include <mutex>
 #include <set>
+#include <thread>
+#include <unordered_set>
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/EntityId_t.hpp>
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 #include <statistics/rtps/GuidUtils.hpp>
 
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <utils/threading.hpp>
 
 #include <nlohmann/json.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
@@ -45,12 +50,15 @@ DiscoveryDataBase::DiscoveryDataBase(
     , enabled_(true)
     , new_updates_(0)
     , processing_backup_(false)
+    , processing_threads_(std::max(1u, std::min(4u, std::thread::hardware_concurrency())))
     , is_persistent_(false)
 {
 }
 
 DiscoveryDataBase::~DiscoveryDataBase()
 {
+    stop_workers_();
+
     if (!clear().empty())
     {
         EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Destroying a NOT cleared database");
@@ -58,7 +66,7 @@ DiscoveryDataBase::~DiscoveryDataBase()
 
     if (is_persistent_)
     {
-        backup_file_.close();
+        backup_journal_.close();
     }
 }
 
@@ -122,14 +130,18 @@ std::vector<fastdds::rtps::CacheChange_t*> DiscoveryDataBase::clear()
 
     /* Clear list of dirty topics */
     dirty_topics_.clear();
+    dirty_topics_index_.clear();
 
     /* Clear disposals list */
     disposals_.clear();
 
     /* Clear to_send collections */
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 
     /* Clear writers_ */
     for (auto writers_it = writers_.begin(); writers_it != writers_.end();)
@@ -338,10 +350,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_journal_.append(*change, participant_change_data);
     }
 
     if (!enabled_)
@@ -370,10 +379,10 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_journal_.append(
+            is_writer(change) ? DiscoveryJournalEntity::WRITER : DiscoveryJournalEntity::READER,
+            *change,
+            topic_name);
     }
 
     if (!enabled_)
@@ -422,6 +431,7 @@ void DiscoveryDataBase::clear_pdp_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastdds::rtps::CacheChange_t*> DiscoveryDataBase::edp_publications_to_send()
@@ -436,6 +446,7 @@ void DiscoveryDataBase::clear_edp_publications_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastdds::rtps::CacheChange_t*> DiscoveryDataBase::edp_subscriptions_to_send()
@@ -450,6 +461,7 @@ void DiscoveryDataBase::clear_edp_subscriptions_to_send()
     // lock(exclusive mode) mutex locally
     std::lock_guard<std::recursive_mutex> guard(mutex_);
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastdds::rtps::CacheChange_t*> DiscoveryDataBase::changes_to_release()
@@ -678,7 +690,7 @@ void DiscoveryDataBase::create_new_participant_from_change_(
 {
     fastdds::rtps::GUID_t change_guid = guid_from_change(ch);
 
-    std::pair<std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+    std::pair<ParticipantMap::iterator, bool> ret =
             participants_.insert(
         std::make_pair(
             change_guid.guidPrefix,
@@ -863,7 +875,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
@@ -876,7 +888,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::writers
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+        ParticipantMap::iterator writer_part_it =
                 participants_.find(writer_guid.guidPrefix);
         if (writer_part_it != participants_.end())
         {
@@ -899,7 +911,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto reader_it : readers_)
+            for (const auto& reader_it : readers_)
             {
                 match_writer_reader_(writer_guid, reader_it.first);
             }
@@ -981,7 +993,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
@@ -994,7 +1006,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::readers
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+        ParticipantMap::iterator reader_part_it =
                 participants_.find(reader_guid.guidPrefix);
         if (reader_part_it != participants_.end())
         {
@@ -1017,7 +1029,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto writer_it : writers_)
+            for (const auto& writer_it : writers_)
             {
                 match_writer_reader_(writer_it.first, reader_guid);
             }
@@ -1201,24 +1213,23 @@ bool DiscoveryDataBase::set_dirty_topic_(
     {
         // Set all topics to dirty
         dirty_topics_.clear();
+        dirty_topics_index_.clear();
 
         // It is enough to use writers_by_topic because the topics are simetrical in writers and readers:
         //  if a topic exists in one, it exists in the other
-        for (auto topic_it : writers_by_topic_)
+        for (const auto& topic_it : writers_by_topic_)
         {
             if (topic_it.first != virtual_topic_)
             {
                 dirty_topics_.push_back(topic_it.first);
+                dirty_topics_index_.insert(topic_it.first);
             }
         }
         return true;
     }
     else
     {
-        if (std::find(
-                    dirty_topics_.begin(),
-                    dirty_topics_.end(),
-                    topic) == dirty_topics_.end())
+        if (dirty_topics_index_.insert(topic).second)
         {
             dirty_topics_.push_back(topic);
             return true;
@@ -1233,7 +1244,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastdds::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
+    ParticipantMap::iterator pit =
             participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
@@ -1303,7 +1314,7 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastdds::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    EndpointMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1333,7 +1344,7 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    EndpointMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1356,6 +1367,88 @@ void DiscoveryDataBase::process_dispose_reader_(
     }
 }
 
+void DiscoveryDataBase::run_partitions_(
+        std::size_t partitions,
+        const std::function<void(std::size_t)>& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(workers_mutex_);
+        while (workers_.size() + 1 < partitions)
+        {
+            std::size_t index = workers_.size();
+            uint32_t first_round = workers_round_ + 1;
+            workers_.push_back(create_thread([this, index, first_round]()
+                    {
+                        worker_loop_(index, first_round);
+                    }, fastdds::rtps::ThreadSettings{}, "dds.ddb.%u", static_cast<uint32_t>(index + 1)));
+        }
+
+        workers_task_ = task;
+        workers_partitions_ = partitions;
+        workers_pending_ = partitions - 1;
+        ++workers_round_;
+    }
+    workers_cv_.notify_all();
+
+    task(0);
+
+    std::unique_lock<std::mutex> lock(workers_mutex_);
+    workers_done_cv_.wait(lock, [this]()
+            {
+                return 0 == workers_pending_;
+            });
+    workers_task_ = nullptr;
+}
+
+void DiscoveryDataBase::worker_loop_(
+        std::size_t index,
+        uint32_t first_round)
+{
+    std::unique_lock<std::mutex> lock(workers_mutex_);
+    // The round the worker was started for cannot finish without it, however late the thread starts
+    uint32_t last_round = first_round - 1;
+    while (true)
+    {
+        workers_cv_.wait(lock, [this, last_round]()
+                {
+                    return workers_stop_ || workers_round_ != last_round;
+                });
+        if (workers_stop_)
+        {
+            return;
+        }
+
+        last_round = workers_round_;
+        if (index + 1 < workers_partitions_)
+        {
+            // The task does not change until every partition of the round is finished
+            lock.unlock();
+            workers_task_(index + 1);
+            lock.lock();
+
+            if (0 == --workers_pending_)
+            {
+                workers_done_cv_.notify_one();
+            }
+        }
+    }
+}
+
+void DiscoveryDataBase::stop_workers_()
+{
+    {
+        std::lock_guard<std::mutex> lock(workers_mutex_);
+        workers_stop_ = true;
+    }
+    workers_cv_.notify_all();
+
+    for (eprosima::thread& worker : workers_)
+    {
+        worker.join();
+    }
+    workers_.clear();
+}
+
 bool DiscoveryDataBase::process_dirty_topics()
 {
     if (!enabled_)
@@ -1368,130 +1461,66 @@ bool DiscoveryDataBase::process_dirty_topics()
     // Get shared lock
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
+    // Processing a topic only reads the database, so the dirty topics are split in partitions processed in parallel.
+    // The results are merged afterwards in the order of dirty_topics_, so the changes to send are the same, and in
+    // the same order, as when processing the topics one after the other.
+    std::vector<DirtyTopicResult> results(dirty_topics_.size());
+    std::size_t partitions = std::min<std::size_t>(processing_threads_,
+                    dirty_topics_.size() / dirty_topics_per_thread_);
+    if (partitions > 1)
+    {
+        std::size_t partition_size = (dirty_topics_.size() + partitions - 1) / partitions;
+        auto process_partition = [this, &results, partition_size](std::size_t partition)
+                {
+                    std::size_t last = std::min(results.size(), (partition + 1) * partition_size);
+                    for (std::size_t i = partition * partition_size; i < last; ++i)
+                    {
+                        process_dirty_topic_(dirty_topics_[i], results[i]);
+                    }
+                };
 
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+        run_partitions_(partitions, process_partition);
+    }
+    else
     {
-        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
+        for (std::size_t i = 0; i < dirty_topics_.size(); ++i)
+        {
+            process_dirty_topic_(dirty_topics_[i], results[i]);
+        }
+    }
 
-        // Get all the writers in the topic
-        std::vector<fastdds::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
+    std::vector<std::string> still_dirty;
+    for (std::size_t i = 0; i < dirty_topics_.size(); ++i)
+    {
+        const DirtyTopicResult& result = results[i];
+        for (fastdds::rtps::CacheChange_t* change : result.pdp_to_send)
         {
-            writers = ret->second;
+            add_pdp_to_send_(change);
         }
-        // Get all the readers in the topic
-        std::vector<fastdds::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        for (fastdds::rtps::CacheChange_t* change : result.edp_publications_to_send)
         {
-            readers = ret->second;
+            add_edp_publications_to_send_(change);
         }
-
-        for (fastdds::rtps::GUID_t writer: writers)
-        // Iterate over writers in the topic:
+        for (fastdds::rtps::CacheChange_t* change : result.edp_subscriptions_to_send)
         {
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastdds::rtps::GUID_t reader : readers)
-            {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
-
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
-                {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
-                    {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
-                {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-            }
+            add_edp_subscriptions_to_send_(change);
         }
 
         // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+        if (result.is_clearable)
         {
             // Delete topic from dirty_topics_
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
-            topic_it = dirty_topics_.erase(topic_it);
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " has been cleaned");
+            dirty_topics_index_.erase(dirty_topics_[i]);
         }
         else
         {
             // Proceed with next topic
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << *topic_it << " is still dirty");
-            ++topic_it;
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " is still dirty");
+            still_dirty.push_back(std::move(dirty_topics_[i]));
         }
     }
+    dirty_topics_.swap(still_dirty);
 
     // Return whether there still are dirty topics
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
@@ -1499,6 +1528,100 @@ bool DiscoveryDataBase::process_dirty_topics()
     return !dirty_topics_.empty();
 }
 
+void DiscoveryDataBase::process_dirty_topic_(
+        const std::string& topic,
+        DirtyTopicResult& result) const
+{
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << topic);
+
+    // Get all the writers in the topic
+    static const std::vector<fastdds::rtps::GUID_t> no_endpoints;
+    auto ret = writers_by_topic_.find(topic);
+    const std::vector<fastdds::rtps::GUID_t>& writers = ret != writers_by_topic_.end() ? ret->second : no_endpoints;
+    // Get all the readers in the topic
+    ret = readers_by_topic_.find(topic);
+    const std::vector<fastdds::rtps::GUID_t>& readers = ret != readers_by_topic_.end() ? ret->second : no_endpoints;
+
+    // Every pair of writer and reader is checked, but each change is added once to the result of the topic, in the
+    // order it is first found, so the result does not grow with the number of pairs.
+    std::unordered_set<fastdds::rtps::CacheChange_t*> found_changes;
+    auto add_once = [&found_changes](
+        std::vector<fastdds::rtps::CacheChange_t*>& to_send,
+        fastdds::rtps::CacheChange_t* change)
+            {
+                if (found_changes.insert(change).second)
+                {
+                    to_send.push_back(change);
+                }
+            };
+
+    for (const fastdds::rtps::GUID_t& writer: writers)
+    // Iterate over writers in the topic:
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing writer: " << writer);
+        // Find participant with writer info in participants_ and writer info in writers_
+        auto parts_writer_it = participants_.find(writer.guidPrefix);
+        auto writers_it = writers_.find(writer);
+
+        // Iterate over readers in the topic:
+        for (const fastdds::rtps::GUID_t& reader : readers)
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing reader: " << reader);
+            // Find participant with reader info in participants_ and reader info in readers_
+            auto parts_reader_it = participants_.find(reader.guidPrefix);
+            auto readers_it = readers_.find(reader);
+
+            // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+            // with the writer.
+            if (parts_reader_it != participants_.end())
+            {
+                if (parts_reader_it->second.is_matched(writer.guidPrefix))
+                {
+                    // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+                    if (readers_it != readers_.end() &&
+                            readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                            !readers_it->second.is_matched(writer.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(r) to a `edp_subscriptions_to_send_` (if it's not there).
+                        add_once(result.edp_subscriptions_to_send, readers_it->second.change());
+                    }
+                }
+                else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+                    add_once(result.pdp_to_send, parts_reader_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+
+            // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+            // with the reader.
+            if (parts_writer_it != participants_.end())
+            {
+                if (parts_writer_it->second.is_matched(reader.guidPrefix))
+                {
+                    // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+                    if (writers_it != writers_.end() &&
+                            writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                            !writers_it->second.is_matched(reader.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(w) to a `edp_publications_to_send_` (if it's not there).
+                        add_once(result.edp_publications_to_send, writers_it->second.change());
+                    }
+                }
+                else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+                    add_once(result.pdp_to_send, parts_writer_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+        }
+    }
+}
+
 bool DiscoveryDataBase::delete_entity_of_change(
         fastdds::rtps::CacheChange_t* change)
 {
@@ -1969,7 +2092,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastdds::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -1986,7 +2109,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it =
+        TopicMap::iterator topic_it =
                 writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
@@ -2017,7 +2140,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastdds::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -2034,7 +2157,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>>::iterator topic_it =
+        TopicMap::iterator topic_it =
                 readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
@@ -2203,9 +2326,9 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
+DiscoveryDataBase::ParticipantMap::iterator
 DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+        ParticipantMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2230,8 +2353,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2279,8 +2402,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2318,10 +2441,7 @@ bool DiscoveryDataBase::add_pdp_to_send_(
         eprosima::fastdds::rtps::CacheChange_t* change)
 {
     // Add DATA(p) to send in next iteration if it is not already there
-    if (std::find(
-                pdp_to_send_.begin(),
-                pdp_to_send_.end(),
-                change) == pdp_to_send_.end())
+    if (pdp_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(p) to send: "
                 << change->instanceHandle);
@@ -2335,10 +2455,7 @@ bool DiscoveryDataBase::add_edp_publications_to_send_(
         eprosima::fastdds::rtps::CacheChange_t* change)
 {
     // Add DATA(w) to send in next iteration if it is not already there
-    if (std::find(
-                edp_publications_to_send_.begin(),
-                edp_publications_to_send_.end(),
-                change) == edp_publications_to_send_.end())
+    if (edp_publications_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
                 << change->instanceHandle);
@@ -2352,10 +2469,7 @@ bool DiscoveryDataBase::add_edp_subscriptions_to_send_(
         eprosima::fastdds::rtps::CacheChange_t* change)
 {
     // Add DATA(r) to send in next iteration if it is not already there
-    if (std::find(
-                edp_subscriptions_to_send_.begin(),
-                edp_subscriptions_to_send_.end(),
-                change) == edp_subscriptions_to_send_.end())
+    if (edp_subscriptions_to_send_index_.insert(change).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
                 << change->instanceHandle);
@@ -2514,7 +2628,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+            ParticipantMap::iterator writer_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
@@ -2572,7 +2686,7 @@ bool DiscoveryDataBase::from_json(
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+            ParticipantMap::iterator reader_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
@@ -2606,22 +2720,153 @@ bool DiscoveryDataBase::from_json(
     return true;
 }
 
+void DiscoveryDataBase::to_journal(
+        std::vector<octet>& buffer) const
+{
+    // The own server entities are not stored in the db, because in relaunch the must be created again
+    for (const auto& participant : participants_)
+    {
+        if (participant.first != server_guid_prefix_)
+        {
+            participant.second.to_journal(buffer);
+        }
+    }
+
+    for (const auto& writer : writers_)
+    {
+        if (writer.first.guidPrefix != server_guid_prefix_)
+        {
+            writer.second.to_journal(buffer, DiscoveryJournalEntity::WRITER);
+        }
+    }
+
+    for (const auto& reader : readers_)
+    {
+        if (reader.first.guidPrefix != server_guid_prefix_)
+        {
+            reader.second.to_journal(buffer, DiscoveryJournalEntity::READER);
+        }
+    }
+}
+
+bool DiscoveryDataBase::from_journal(
+        const std::vector<DiscoveryJournalRecord>& records,
+        std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*>& changes_map)
+{
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Raising DDB from journal Backup");
+
+    // Participants must exist before their endpoints are added
+    for (const DiscoveryJournalRecord& record : records)
+    {
+        if (DiscoveryJournalEntity::PARTICIPANT != record.entity)
+        {
+            continue;
+        }
+
+        fastdds::rtps::CacheChange_t* change = changes_map[record.instance_handle];
+        fastdds::rtps::GuidPrefix_t prefix = fastdds::rtps::iHandle2GUID(record.instance_handle).guidPrefix;
+
+        DiscoveryParticipantInfo dpi(change, server_guid_prefix_,
+                DiscoveryParticipantChangeData(record.metatraffic_locators, record.is_client, record.is_local));
+        for (const auto& ack : record.ack_status)
+        {
+            dpi.add_or_update_ack_participant(ack.first, ack.second);
+        }
+        participants_.insert(std::make_pair(prefix, dpi));
+
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Participant " << prefix << " created");
+
+        // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
+        if (change->kind != fastdds::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
+
+    for (const DiscoveryJournalRecord& record : records)
+    {
+        if (DiscoveryJournalEntity::PARTICIPANT == record.entity)
+        {
+            continue;
+        }
+
+        fastdds::rtps::CacheChange_t* change = changes_map[record.instance_handle];
+        fastdds::rtps::GUID_t guid = fastdds::rtps::iHandle2GUID(record.instance_handle);
+
+        ParticipantMap::iterator part_it = participants_.find(guid.guidPrefix);
+        if (part_it == participants_.end())
+        {
+            // Endpoint without participant, corrupted DDB
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Endpoint " << guid << " without participant");
+            return false;
+        }
+
+        DiscoveryEndpointInfo dei(change, record.topic, record.topic == virtual_topic_, server_guid_prefix_);
+        for (const auto& ack : record.ack_status)
+        {
+            dei.add_or_update_ack_participant(ack.first, ack.second);
+        }
+
+        if (DiscoveryJournalEntity::WRITER == record.entity)
+        {
+            writers_.insert(std::make_pair(guid, dei));
+            add_writer_to_topic_(guid, record.topic);
+            part_it->second.add_writer(guid);
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Writer " << guid << " created");
+        }
+        else
+        {
+            readers_.insert(std::make_pair(guid, dei));
+            add_reader_to_topic_(guid, record.topic);
+            part_it->second.add_reader(guid);
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Reader " << guid << " created");
+        }
+
+        if (change->kind != fastdds::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
+
+    // Set dirty topics to all, so next iteration every message pending is sent
+    set_dirty_topic_(virtual_topic_);
+
+    // Announce own server
+    server_acked_by_all(false);
+
+    return true;
+}
+
 void DiscoveryDataBase::clean_backup()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Compacting DDB journal backup");
+
+    // This will replace the last backup stored and every change received since then
+    std::vector<octet> snapshot;
+    to_journal(snapshot);
+    if (!backup_journal_.compact(snapshot))
+    {
+        // The journal has been kept, so at least store the changes received since the last pass
+        backup_journal_.sync();
+    }
+}
+
+void DiscoveryDataBase::sync_backup()
+{
+    backup_journal_.sync();
+}
 
-    // This will erase the last backup stored
-    backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+bool DiscoveryDataBase::backup_compaction_pending() const
+{
+    return backup_journal_.compaction_pending();
 }
 
 void DiscoveryDataBase::persistence_enable(
         std::string backup_file_name)
 {
     is_persistent_ = true;
-    backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_journal_.open(backup_file_name);
 }
 
 bool DiscoveryDataBase::is_participant_local(
@@ -20,11 +20,18 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 #define _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -36,14 +43,50 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
 #include <rtps/writer/ReaderProxy.hpp>
 #include <utils/DBQueue.hpp>
+#include <utils/thread.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 namespace ddb {
 
+//! Hash of GUID prefixes, mixing all their bytes.
+struct GuidPrefixHash
+{
+    std::size_t operator ()(
+            const fastdds::rtps::GuidPrefix_t& prefix) const noexcept
+    {
+        uint64_t h = 0xCBF29CE484222325ull;
+        for (std::size_t i = 0; i < fastdds::rtps::GuidPrefix_t::size; ++i)
+        {
+            h = (h ^ prefix.value[i]) * 0x100000001B3ull;
+        }
+        h ^= h >> 33u;
+        return static_cast<std::size_t>(h);
+    }
+
+};
+
+//! Hash of GUIDs, mixing all the bytes of their prefix and entity id.
+struct GuidHash
+{
+    std::size_t operator ()(
+            const fastdds::rtps::GUID_t& guid) const noexcept
+    {
+        uint64_t h = GuidPrefixHash()(guid.guidPrefix);
+        for (std::size_t i = 0; i < fastdds::rtps::EntityId_t::size; ++i)
+        {
+            h = (h ^ guid.entityId.value[i]) * 0x100000001B3ull;
+        }
+        h ^= h >> 33u;
+        return static_cast<std::size_t>(h);
+    }
+
+};
+
 /**
  * Class to manage the discovery data base
  *@ingroup DISCOVERY_MODULE
@@ -122,6 +165,21 @@ public:
 
     ~DiscoveryDataBase();
 
+    //! Set the maximum number of threads processing dirty topics in parallel
+    void processing_threads(
+            uint32_t threads)
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        processing_threads_ = threads > 0 ? threads : 1;
+    }
+
+    //! Maximum number of threads processing dirty topics in parallel
+    uint32_t processing_threads() const
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        return processing_threads_;
+    }
+
     ////////////
     // Functions to update queue from listener
     /* Add a new CacheChange_t to database queue
@@ -315,6 +373,22 @@ public:
     // This function must be called with the incoming datas blocked
     void clean_backup();
 
+    // Write the changes received since the last call to the backup and sync them to disk
+    // This function must be called with the incoming datas blocked
+    void sync_backup();
+
+    // Whether the changes received since the last clean_backup take more space in the backup than the database state
+    bool backup_compaction_pending() const;
+
+    // Serialize the state of the database into binary journal records
+    void to_journal(
+            std::vector<octet>& buffer) const;
+
+    // Load the state of the database from binary journal records
+    bool from_journal(
+            const std::vector<DiscoveryJournalRecord>& records,
+            std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*>& changes_map);
+
     // Lock the incoming of new data to the DDB queue. This locks the Listener as well
     void lock_incoming_data()
     {
@@ -354,6 +428,40 @@ public:
 
 protected:
 
+    using ParticipantMap = std::unordered_map<fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo, GuidPrefixHash>;
+    using EndpointMap = std::unordered_map<fastdds::rtps::GUID_t, DiscoveryEndpointInfo, GuidHash>;
+    using TopicMap = std::unordered_map<std::string, std::vector<fastdds::rtps::GUID_t>>;
+
+    //! Changes to send found while processing a dirty topic
+    struct DirtyTopicResult
+    {
+        //! Whether the topic can be removed from the dirty topics
+        bool is_clearable = true;
+        std::vector<fastdds::rtps::CacheChange_t*> pdp_to_send;
+        std::vector<fastdds::rtps::CacheChange_t*> edp_publications_to_send;
+        std::vector<fastdds::rtps::CacheChange_t*> edp_subscriptions_to_send;
+    };
+
+    // Look for the changes that have to be sent for a dirty topic. It only reads the database, so different topics
+    // can be processed in parallel
+    void process_dirty_topic_(
+            const std::string& topic,
+            DirtyTopicResult& result) const;
+
+    // Run task on partitions 1 to partitions - 1 in the workers, and on partition 0 in the calling thread.
+    // Returns once every partition has been processed. Workers are started the first time they are needed
+    void run_partitions_(
+            std::size_t partitions,
+            const std::function<void(std::size_t)>& task);
+
+    // Loop of the worker processing the partition index + 1 on every round, from first_round on
+    void worker_loop_(
+            std::size_t index,
+            uint32_t first_round);
+
+    // Stop and join the workers
+    void stop_workers_();
+
     // change a cacheChange by update or new disposal
     void update_change_and_unmatch_(
             fastdds::rtps::CacheChange_t* new_change,
@@ -445,22 +553,22 @@ protected:
     bool delete_participant_entity_(
             const fastdds::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantMap::iterator delete_participant_entity_(
+            ParticipantMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastdds::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_writer_entity_(
+            EndpointMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastdds::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_reader_entity_(
+            EndpointMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -525,24 +633,25 @@ protected:
     DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Covenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastdds::rtps::GUID_t>> writers_by_topic_;
+    TopicMap readers_by_topic_;
+    TopicMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastdds::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastdds::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointMap readers_;
+    EndpointMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
+    std::unordered_set<std::string> dirty_topics_index_;
 
     //! Collection of changes to take out of the server builtin writers
     std::vector<eprosima::fastdds::rtps::CacheChange_t*> disposals_;
@@ -551,6 +660,10 @@ protected:
     std::vector<eprosima::fastdds::rtps::CacheChange_t*> pdp_to_send_;
     std::vector<eprosima::fastdds::rtps::CacheChange_t*> edp_publications_to_send_;
     std::vector<eprosima::fastdds::rtps::CacheChange_t*> edp_subscriptions_to_send_;
+    //! Indexes of the collections above, to look changes up in constant time
+    std::unordered_set<eprosima::fastdds::rtps::CacheChange_t*> pdp_to_send_index_;
+    std::unordered_set<eprosima::fastdds::rtps::CacheChange_t*> edp_publications_to_send_index_;
+    std::unordered_set<eprosima::fastdds::rtps::CacheChange_t*> edp_subscriptions_to_send_index_;
 
     //! changes that are no longer associated to living endpoints and should be returned to it's pool
     std::vector<eprosima::fastdds::rtps::CacheChange_t*> changes_to_release_;
@@ -582,14 +695,45 @@ protected:
     // Whether the database is restoring a backup
     std::atomic<bool> processing_backup_;
 
+    // Maximum number of threads processing dirty topics in parallel
+    uint32_t processing_threads_;
+
+    // Minimum number of dirty topics for each thread processing them
+    static constexpr std::size_t dirty_topics_per_thread_ = 64u;
+
+    // Threads processing partitions of the dirty topics, kept for the whole life of the database
+    std::vector<eprosima::thread> workers_;
+
+    // Guards the state below, shared with the workers
+    std::mutex workers_mutex_;
+
+    // Notifies the workers that there is a new round of partitions, or that they must stop
+    std::condition_variable workers_cv_;
+
+    // Notifies process_dirty_topics() that the workers finished their partitions
+    std::condition_variable workers_done_cv_;
+
+    // Processes a partition of the dirty topics on the current round
+    std::function<void(std::size_t)> workers_task_;
+
+    // Incremented on every round, so each worker takes part in it once
+    uint32_t workers_round_ = 0;
+
+    // Number of partitions of the current round. The first one is processed by the calling thread
+    std::size_t workers_partitions_ = 0;
+
+    // Number of partitions of the current round not finished yet by the workers
+    std::size_t workers_pending_ = 0;
+
+    // Whether the workers must exit
+    bool workers_stop_ = false;
+
     // Whether the database is persistent, so it must store every cache it arrives
     bool is_persistent_;
 
-    // File to save every cacheChange that is updated to the ddb queues
-    std::string backup_file_name_;
-    // This file will keep open to write it fast every time a new cache arrives
-    // It needs a flush every time a new change is added
-    std::ofstream backup_file_;
+    // Journal to save every cacheChange that is updated to the ddb queues
+    // It is kept open to append every new cache fast, and synced to disk in batches
+    DiscoveryJournal backup_journal_;
 };
 
 
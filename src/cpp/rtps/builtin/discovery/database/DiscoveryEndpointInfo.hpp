@@ -21,6 +21,7 @@
 #define _FASTDDS_RTPS_DISCOVERY_ENDPOINT_INFO_H_
 
 #include <rtps/builtin/discovery/database/DiscoverySharedInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
 
@@ -81,6 +82,14 @@ public:
         j["topic"] = topic_;
     }
 
+    void to_journal(
+            std::vector<octet>& buffer,
+            DiscoveryJournalEntity entity) const
+    {
+        DiscoveryJournal::serialize_endpoint(buffer, entity, *change_, topic_,
+                &relevant_participants_builtin_ack_status_);
+    }
+
 private:
 
     std::string topic_;
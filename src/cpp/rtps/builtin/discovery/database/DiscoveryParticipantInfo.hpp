@@ -27,6 +27,7 @@
 
 #include <rtps/builtin/discovery/database/DiscoverySharedInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -129,6 +130,13 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    void to_journal(
+            std::vector<octet>& buffer) const
+    {
+        DiscoveryJournal::serialize_participant(buffer, *change_, participant_change_data_,
+                &relevant_participants_builtin_ack_status_);
+    }
+
 private:
 
     std::vector<GUID_t> readers_;
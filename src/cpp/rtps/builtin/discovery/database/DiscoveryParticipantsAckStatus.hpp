@@ -67,6 +67,11 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    const std::map<GuidPrefix_t, bool>& status() const
+    {
+        return relevant_participants_map_;
+    }
+
 private:
 
     std::map<GuidPrefix_t, bool> relevant_participants_map_;
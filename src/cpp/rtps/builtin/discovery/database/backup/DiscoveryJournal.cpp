@@ -0,0 +1,758 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryJournal.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif // ifdef _WIN32
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/Types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+namespace {
+
+/*
+ * Layout of a journal file. Values are stored in the byte order of the host that wrote them, which is recorded in
+ * the header, as CDR does.
+ *
+ *   header:  'F' 'D' 'D' 'J' | version (1) | endianness (1) | padding (2)
+ *   record:  body size (4) | checksum of the body (4) | body
+ *   body:    entity (1) | change kind (1) | flags (1) | padding (1)
+ *            writer GUID (16) | instance handle (16) | sequence number (8) | source timestamp (8)
+ *            reception timestamp (8) | sample identity (24) | related sample identity (24)
+ *            encapsulation (2) | padding (2) | payload length (4) | payload
+ *            participants: unicast count (4) | unicast locators | multicast count (4) | multicast locators
+ *            endpoints:    topic length (4) | topic
+ *            ack status count (4) | ack status entries: GUID prefix (12) | acked (1)
+ */
+
+const octet journal_magic[] = {'F', 'D', 'D', 'J'};
+constexpr octet journal_version = 1;
+constexpr std::size_t journal_header_size = 8;
+constexpr std::size_t record_header_size = 8;
+
+constexpr octet flag_is_read = 0x01;
+constexpr octet flag_is_client = 0x02;
+constexpr octet flag_is_local = 0x04;
+
+uint32_t checksum(
+        const octet* data,
+        std::size_t size)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void put_bytes(
+        std::vector<octet>& buffer,
+        const octet* data,
+        std::size_t size)
+{
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+template<typename T>
+void put(
+        std::vector<octet>& buffer,
+        const T& value)
+{
+    put_bytes(buffer, reinterpret_cast<const octet*>(&value), sizeof(T));
+}
+
+void put(
+        std::vector<octet>& buffer,
+        const GUID_t& guid)
+{
+    put_bytes(buffer, guid.guidPrefix.value, GuidPrefix_t::size);
+    put_bytes(buffer, guid.entityId.value, EntityId_t::size);
+}
+
+void put(
+        std::vector<octet>& buffer,
+        const SequenceNumber_t& sequence_number)
+{
+    put(buffer, sequence_number.high);
+    put(buffer, sequence_number.low);
+}
+
+void put(
+        std::vector<octet>& buffer,
+        const Time_t& time)
+{
+    put(buffer, time.seconds());
+    put(buffer, time.fraction());
+}
+
+void put(
+        std::vector<octet>& buffer,
+        const SampleIdentity& identity)
+{
+    put(buffer, identity.writer_guid());
+    put(buffer, identity.sequence_number());
+}
+
+void put(
+        std::vector<octet>& buffer,
+        const ResourceLimitedVector<Locator_t>& locators)
+{
+    put(buffer, static_cast<uint32_t>(locators.size()));
+    for (const Locator_t& locator : locators)
+    {
+        put(buffer, locator.kind);
+        put(buffer, locator.port);
+        put_bytes(buffer, locator.address, sizeof(locator.address));
+    }
+}
+
+void put_header(
+        std::vector<octet>& buffer)
+{
+    put_bytes(buffer, journal_magic, sizeof(journal_magic));
+    buffer.push_back(journal_version);
+    buffer.push_back(static_cast<octet>(DEFAULT_ENDIAN));
+    buffer.push_back(0);
+    buffer.push_back(0);
+}
+
+//! Start a record, returning the position of its header.
+std::size_t begin_record(
+        std::vector<octet>& buffer,
+        DiscoveryJournalEntity entity,
+        const CacheChange_t& change,
+        octet flags)
+{
+    std::size_t header = buffer.size();
+    buffer.resize(header + record_header_size);
+
+    buffer.push_back(static_cast<octet>(entity));
+    buffer.push_back(static_cast<octet>(change.kind));
+    buffer.push_back(static_cast<octet>(flags | (change.isRead ? flag_is_read : 0)));
+    buffer.push_back(0);
+    put(buffer, change.writerGUID);
+    put_bytes(buffer, change.instanceHandle.value, 16);
+    put(buffer, change.sequenceNumber);
+    put(buffer, change.sourceTimestamp);
+    put(buffer, change.reader_info.receptionTimestamp);
+    put(buffer, change.write_params.sample_identity());
+    put(buffer, change.write_params.related_sample_identity());
+    put(buffer, change.serializedPayload.encapsulation);
+    put(buffer, static_cast<uint16_t>(0));
+    put(buffer, change.serializedPayload.length);
+    put_bytes(buffer, change.serializedPayload.data, change.serializedPayload.length);
+    return header;
+}
+
+//! Complete a record, filling its header.
+void end_record(
+        std::vector<octet>& buffer,
+        std::size_t header,
+        const DiscoveryParticipantsAckStatus* ack_status)
+{
+    if (nullptr != ack_status)
+    {
+        put(buffer, static_cast<uint32_t>(ack_status->status().size()));
+        for (const auto& status : ack_status->status())
+        {
+            put_bytes(buffer, status.first.value, GuidPrefix_t::size);
+            buffer.push_back(status.second ? 1 : 0);
+        }
+    }
+    else
+    {
+        put(buffer, static_cast<uint32_t>(0));
+    }
+
+    const octet* body = buffer.data() + header + record_header_size;
+    uint32_t body_size = static_cast<uint32_t>(buffer.size() - header - record_header_size);
+    uint32_t body_checksum = checksum(body, body_size);
+    memcpy(&buffer[header], &body_size, sizeof(body_size));
+    memcpy(&buffer[header + sizeof(body_size)], &body_checksum, sizeof(body_checksum));
+}
+
+//! Sequential decoder of the body of a record. Every read fails once the end of the body has been reached.
+class RecordReader
+{
+public:
+
+    RecordReader(
+            const octet* data,
+            std::size_t size)
+        : pos_(data)
+        , end_(data + size)
+    {
+    }
+
+    bool get_bytes(
+            octet* data,
+            std::size_t size)
+    {
+        const octet* ptr = skip(size);
+        if (nullptr != ptr)
+        {
+            memcpy(data, ptr, size);
+        }
+        return nullptr != ptr;
+    }
+
+    template<typename T>
+    bool get(
+            T& value)
+    {
+        return get_bytes(reinterpret_cast<octet*>(&value), sizeof(T));
+    }
+
+    bool get(
+            GUID_t& guid)
+    {
+        return get_bytes(guid.guidPrefix.value, GuidPrefix_t::size) &&
+               get_bytes(guid.entityId.value, EntityId_t::size);
+    }
+
+    bool get(
+            SequenceNumber_t& sequence_number)
+    {
+        return get(sequence_number.high) && get(sequence_number.low);
+    }
+
+    bool get(
+            Time_t& time)
+    {
+        int32_t seconds = 0;
+        uint32_t fraction = 0;
+        bool ret = get(seconds) && get(fraction);
+        time.seconds(seconds);
+        time.fraction(fraction);
+        return ret;
+    }
+
+    bool get(
+            SampleIdentity& identity)
+    {
+        return get(identity.writer_guid()) && get(identity.sequence_number());
+    }
+
+    bool get(
+            RemoteLocatorList& locators)
+    {
+        uint32_t unicast = 0;
+        if (!get(unicast) || unicast > remaining() / locator_size)
+        {
+            return false;
+        }
+        std::vector<Locator_t> unicast_locators(unicast);
+        for (Locator_t& locator : unicast_locators)
+        {
+            if (!get(locator))
+            {
+                return false;
+            }
+        }
+
+        uint32_t multicast = 0;
+        if (!get(multicast) || multicast > remaining() / locator_size)
+        {
+            return false;
+        }
+        locators = RemoteLocatorList(unicast, multicast);
+        for (const Locator_t& locator : unicast_locators)
+        {
+            locators.add_unicast_locator(locator);
+        }
+        for (uint32_t i = 0; i < multicast; ++i)
+        {
+            Locator_t locator;
+            if (!get(locator))
+            {
+                return false;
+            }
+            locators.add_multicast_locator(locator);
+        }
+        return true;
+    }
+
+    bool get(
+            Locator_t& locator)
+    {
+        return get(locator.kind) && get(locator.port) && get_bytes(locator.address, sizeof(locator.address));
+    }
+
+    const octet* skip(
+            std::size_t size)
+    {
+        if (size > remaining())
+        {
+            return nullptr;
+        }
+        const octet* ptr = pos_;
+        pos_ += size;
+        return ptr;
+    }
+
+    std::size_t remaining() const
+    {
+        return static_cast<std::size_t>(end_ - pos_);
+    }
+
+private:
+
+    static constexpr std::size_t locator_size = sizeof(int32_t) + sizeof(uint32_t) + 16;
+
+    const octet* pos_;
+
+    const octet* end_;
+};
+
+bool decode_record(
+        const octet* body,
+        std::size_t size,
+        DiscoveryJournalRecord& record)
+{
+    RecordReader reader(body, size);
+
+    octet entity = 0;
+    octet kind = 0;
+    octet flags = 0;
+    octet padding = 0;
+    if (!reader.get(entity) || !reader.get(kind) || !reader.get(flags) || !reader.get(padding) ||
+            entity < static_cast<octet>(DiscoveryJournalEntity::PARTICIPANT) ||
+            entity > static_cast<octet>(DiscoveryJournalEntity::READER))
+    {
+        return false;
+    }
+    record.entity = static_cast<DiscoveryJournalEntity>(entity);
+    record.kind = static_cast<ChangeKind_t>(kind);
+    record.is_read = 0 != (flags & flag_is_read);
+    record.is_client = 0 != (flags & flag_is_client);
+    record.is_local = 0 != (flags & flag_is_local);
+
+    uint16_t encapsulation_padding = 0;
+    if (!reader.get(record.writer_guid) ||
+            !reader.get_bytes(record.instance_handle.value, 16) ||
+            !reader.get(record.sequence_number) ||
+            !reader.get(record.source_timestamp) ||
+            !reader.get(record.reception_timestamp) ||
+            !reader.get(record.sample_identity) ||
+            !reader.get(record.related_sample_identity) ||
+            !reader.get(record.encapsulation) ||
+            !reader.get(encapsulation_padding) ||
+            !reader.get(record.payload_length))
+    {
+        return false;
+    }
+    record.payload = reader.skip(record.payload_length);
+    if (nullptr == record.payload && 0 < record.payload_length)
+    {
+        return false;
+    }
+
+    if (DiscoveryJournalEntity::PARTICIPANT == record.entity)
+    {
+        if (!reader.get(record.metatraffic_locators))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        uint32_t topic_length = 0;
+        const octet* topic = nullptr;
+        if (!reader.get(topic_length) || (nullptr == (topic = reader.skip(topic_length)) && 0 < topic_length))
+        {
+            return false;
+        }
+        record.topic.assign(reinterpret_cast<const char*>(topic), topic_length);
+    }
+
+    uint32_t ack_status = 0;
+    if (!reader.get(ack_status) || ack_status > reader.remaining() / (GuidPrefix_t::size + 1))
+    {
+        return false;
+    }
+    record.ack_status.resize(ack_status);
+    for (auto& status : record.ack_status)
+    {
+        octet acked = 0;
+        if (!reader.get_bytes(status.first.value, GuidPrefix_t::size) || !reader.get(acked))
+        {
+            return false;
+        }
+        status.second = 0 != acked;
+    }
+
+    return 0 == reader.remaining();
+}
+
+bool sync_file(
+        std::FILE* file)
+{
+    if (0 != fflush(file))
+    {
+        return false;
+    }
+#ifdef _WIN32
+    return 0 == _commit(_fileno(file));
+#else
+    return 0 == fsync(fileno(file));
+#endif // ifdef _WIN32
+}
+
+} // namespace
+
+constexpr std::size_t DiscoveryJournal::sync_batch;
+constexpr std::size_t DiscoveryJournal::min_compaction_size;
+
+void DiscoveryJournalRecord::to_change(
+        CacheChange_t& change) const
+{
+    change.kind = kind;
+    change.writerGUID = writer_guid;
+    change.instanceHandle = instance_handle;
+    change.sequenceNumber = sequence_number;
+    change.isRead = is_read;
+    change.sourceTimestamp = source_timestamp;
+    change.reader_info.receptionTimestamp = reception_timestamp;
+    change.write_params.sample_identity(sample_identity);
+    change.write_params.related_sample_identity(related_sample_identity);
+    change.serializedPayload.encapsulation = encapsulation;
+    change.serializedPayload.length = payload_length;
+    if (0 < payload_length)
+    {
+        memcpy(change.serializedPayload.data, payload, payload_length);
+    }
+}
+
+DiscoveryJournal::~DiscoveryJournal()
+{
+    close();
+}
+
+bool DiscoveryJournal::open(
+        const std::string& file_name)
+{
+    close();
+
+    file_name_ = file_name;
+    file_ = std::fopen(file_name_.c_str(), "ab");
+    if (nullptr == file_)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot open discovery journal " << file_name_);
+        return false;
+    }
+
+    // A new file needs its header
+    std::fseek(file_, 0, SEEK_END);
+    if (0 == std::ftell(file_))
+    {
+        put_header(pending_);
+    }
+    return true;
+}
+
+void DiscoveryJournal::close()
+{
+    if (nullptr != file_)
+    {
+        sync();
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    pending_.clear();
+    pending_records_ = 0;
+    unsynced_ = false;
+}
+
+void DiscoveryJournal::append(
+        const CacheChange_t& change,
+        const DiscoveryParticipantChangeData& participant_change_data)
+{
+    std::size_t size = pending_.size();
+    serialize_participant(pending_, change, participant_change_data);
+    appended_size_ += pending_.size() - size;
+    if (++pending_records_ >= sync_batch)
+    {
+        write_pending_();
+    }
+}
+
+void DiscoveryJournal::append(
+        DiscoveryJournalEntity entity,
+        const CacheChange_t& change,
+        const std::string& topic)
+{
+    std::size_t size = pending_.size();
+    serialize_endpoint(pending_, entity, change, topic);
+    appended_size_ += pending_.size() - size;
+    if (++pending_records_ >= sync_batch)
+    {
+        write_pending_();
+    }
+}
+
+void DiscoveryJournal::sync()
+{
+    if (write_pending_() && unsynced_ && sync_file(file_))
+    {
+        unsynced_ = false;
+    }
+}
+
+bool DiscoveryJournal::compaction_pending() const
+{
+    return appended_size_ >= (std::max)(snapshot_size_, min_compaction_size);
+}
+
+bool DiscoveryJournal::compact(
+        const std::vector<octet>& snapshot)
+{
+    if (nullptr == file_)
+    {
+        return false;
+    }
+
+    std::string tmp_file_name = file_name_ + ".tmp";
+    std::FILE* tmp_file = std::fopen(tmp_file_name.c_str(), "wb");
+    if (nullptr == tmp_file)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot create discovery journal snapshot " << tmp_file_name);
+        return false;
+    }
+
+    std::vector<octet> header;
+    put_header(header);
+    bool ret = header.size() == std::fwrite(header.data(), 1, header.size(), tmp_file) &&
+            snapshot.size() == std::fwrite(snapshot.data(), 1, snapshot.size(), tmp_file) &&
+            sync_file(tmp_file);
+    ret = 0 == std::fclose(tmp_file) && ret;
+    if (!ret)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot write discovery journal snapshot " << tmp_file_name);
+        std::remove(tmp_file_name.c_str());
+        return false;
+    }
+
+    if (!replace_file_(tmp_file_name))
+    {
+        // The journal is kept as it was, and the records pending to be written are kept with it
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot replace discovery journal " << file_name_);
+        std::remove(tmp_file_name.c_str());
+        return false;
+    }
+
+    // The records pending to be written are already in the snapshot
+    pending_.clear();
+    pending_records_ = 0;
+    unsynced_ = false;
+    snapshot_size_ = snapshot.size();
+    appended_size_ = 0;
+
+    file_ = std::fopen(file_name_.c_str(), "ab");
+    if (nullptr == file_)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot open discovery journal " << file_name_);
+    }
+    return nullptr != file_;
+}
+
+bool DiscoveryJournal::replace_file_(
+        const std::string& new_file_name)
+{
+#ifdef _WIN32
+    // Open files cannot be replaced on Windows. MoveFileEx replaces the journal in a single step, so there is no
+    // moment without one, and leaves it untouched on failure.
+    std::fclose(file_);
+    file_ = nullptr;
+    if (0 == MoveFileExA(new_file_name.c_str(), file_name_.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        file_ = std::fopen(file_name_.c_str(), "ab");
+        return false;
+    }
+#else
+    // rename replaces the journal atomically. The old one is only closed once it has been replaced
+    if (0 != std::rename(new_file_name.c_str(), file_name_.c_str()))
+    {
+        return false;
+    }
+    std::fclose(file_);
+    file_ = nullptr;
+#endif // ifdef _WIN32
+    return true;
+}
+
+bool DiscoveryJournal::read(
+        const std::string& file_name,
+        std::vector<octet>& buffer,
+        std::vector<DiscoveryJournalRecord>& records)
+{
+    // Load the whole file with a single read, so records are decoded in place
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    std::streamoff size = file.tellg();
+    if (size < static_cast<std::streamoff>(journal_header_size))
+    {
+        return false;
+    }
+    buffer.resize(static_cast<std::size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), size))
+    {
+        return false;
+    }
+
+    if (0 != memcmp(buffer.data(), journal_magic, sizeof(journal_magic)) ||
+            journal_version != buffer[sizeof(journal_magic)] ||
+            static_cast<octet>(DEFAULT_ENDIAN) != buffer[sizeof(journal_magic) + 1])
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Unsupported discovery journal " << file_name);
+        return false;
+    }
+
+    // Position in records of the last record of each entity
+    std::map<InstanceHandle_t, std::size_t> entities;
+    records.clear();
+
+    std::size_t pos = journal_header_size;
+    while (buffer.size() - pos >= record_header_size)
+    {
+        uint32_t body_size = 0;
+        uint32_t body_checksum = 0;
+        memcpy(&body_size, &buffer[pos], sizeof(body_size));
+        memcpy(&body_checksum, &buffer[pos + sizeof(body_size)], sizeof(body_checksum));
+        pos += record_header_size;
+
+        DiscoveryJournalRecord record;
+        if (body_size > buffer.size() - pos ||
+                body_checksum != checksum(&buffer[pos], body_size) ||
+                !decode_record(&buffer[pos], body_size, record))
+        {
+            EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE, "Discarding damaged tail of discovery journal " << file_name);
+            break;
+        }
+        pos += body_size;
+
+        auto entity = entities.find(record.instance_handle);
+        if (entities.end() == entity)
+        {
+            entities.emplace(record.instance_handle, records.size());
+            records.push_back(std::move(record));
+        }
+        else if (!(record.sample_identity.writer_guid() == records[entity->second].sample_identity.writer_guid() &&
+                record.sample_identity.sequence_number() < records[entity->second].sample_identity.sequence_number()))
+        {
+            // A change received later replaces the stored one, unless it is an older change from the same writer
+            records[entity->second] = std::move(record);
+        }
+    }
+
+    // The endpoints of participants that are gone, or that have never been stored, are gone too
+    std::set<GuidPrefix_t> alive_participants;
+    for (const DiscoveryJournalRecord& record : records)
+    {
+        if (DiscoveryJournalEntity::PARTICIPANT == record.entity && ALIVE == record.kind)
+        {
+            alive_participants.insert(iHandle2GUID(record.instance_handle).guidPrefix);
+        }
+    }
+    records.erase(std::remove_if(records.begin(), records.end(),
+            [&alive_participants](const DiscoveryJournalRecord& record)
+            {
+                return DiscoveryJournalEntity::PARTICIPANT != record.entity &&
+                alive_participants.end() ==
+                alive_participants.find(iHandle2GUID(record.instance_handle).guidPrefix);
+            }), records.end());
+
+    return true;
+}
+
+void DiscoveryJournal::serialize_participant(
+        std::vector<octet>& buffer,
+        const CacheChange_t& change,
+        const DiscoveryParticipantChangeData& participant_change_data,
+        const DiscoveryParticipantsAckStatus* ack_status)
+{
+    octet flags = static_cast<octet>((participant_change_data.is_client() ? flag_is_client : 0) |
+                    (participant_change_data.is_local() ? flag_is_local : 0));
+    std::size_t header = begin_record(buffer, DiscoveryJournalEntity::PARTICIPANT, change, flags);
+    RemoteLocatorList locators = participant_change_data.metatraffic_locators();
+    put(buffer, locators.unicast);
+    put(buffer, locators.multicast);
+    end_record(buffer, header, ack_status);
+}
+
+void DiscoveryJournal::serialize_endpoint(
+        std::vector<octet>& buffer,
+        DiscoveryJournalEntity entity,
+        const CacheChange_t& change,
+        const std::string& topic,
+        const DiscoveryParticipantsAckStatus* ack_status)
+{
+    std::size_t header = begin_record(buffer, entity, change, 0);
+    put(buffer, static_cast<uint32_t>(topic.size()));
+    put_bytes(buffer, reinterpret_cast<const octet*>(topic.data()), topic.size());
+    end_record(buffer, header, ack_status);
+}
+
+bool DiscoveryJournal::write_pending_()
+{
+    if (nullptr == file_)
+    {
+        return false;
+    }
+
+    if (!pending_.empty())
+    {
+        if (pending_.size() != std::fwrite(pending_.data(), 1, pending_.size(), file_))
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Cannot write discovery journal " << file_name_);
+            return false;
+        }
+        pending_.clear();
+        pending_records_ = 0;
+        unsynced_ = true;
+    }
+    return true;
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,218 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryJournal.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_
+#define _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantsAckStatus.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+//! Kind of entity of the discovery database a journal record describes
+enum class DiscoveryJournalEntity : uint8_t
+{
+    PARTICIPANT = 1,
+    WRITER = 2,
+    READER = 3
+};
+
+/**
+ * Entity of the discovery database as stored in a binary journal record.
+ * The serialized payload is not copied: it points to the buffer the record has been decoded from.
+ *@ingroup DISCOVERY_MODULE
+ */
+struct DiscoveryJournalRecord
+{
+    DiscoveryJournalEntity entity = DiscoveryJournalEntity::PARTICIPANT;
+
+    // Change announcing the entity
+    ChangeKind_t kind = ALIVE;
+    GUID_t writer_guid;
+    InstanceHandle_t instance_handle;
+    SequenceNumber_t sequence_number;
+    bool is_read = false;
+    Time_t source_timestamp;
+    Time_t reception_timestamp;
+    SampleIdentity sample_identity;
+    SampleIdentity related_sample_identity;
+    uint16_t encapsulation = 0;
+    uint32_t payload_length = 0;
+    const octet* payload = nullptr;
+
+    // Participant data
+    RemoteLocatorList metatraffic_locators;
+    bool is_client = false;
+    bool is_local = false;
+
+    // Endpoint data
+    std::string topic;
+
+    // Acknowledgement status. Only the records of a snapshot have it
+    std::vector<std::pair<GuidPrefix_t, bool>> ack_status;
+
+    /**
+     * Copy the change stored in this record.
+     * @param change Change to fill, which must have already reserved @c payload_length bytes.
+     */
+    void to_change(
+            CacheChange_t& change) const;
+};
+
+/**
+ * Append-only binary backup of a discovery database.
+ *
+ * The file starts with a snapshot of the database, followed by every change received since the snapshot was taken.
+ * Each record holds the serialized payload of the change as received, so no conversion is needed to store or
+ * restore it. Appended records are buffered, and written and synced to disk in batches. Once the changes received
+ * since the snapshot take more space than the snapshot itself, the file is compacted into a new snapshot.
+ *@ingroup DISCOVERY_MODULE
+ */
+class DiscoveryJournal
+{
+
+public:
+
+    DiscoveryJournal() = default;
+
+    ~DiscoveryJournal();
+
+    /**
+     * Open the journal to append records to it.
+     * @param file_name Name of the journal file.
+     * @return true if the file could be opened.
+     */
+    bool open(
+            const std::string& file_name);
+
+    //! Write the pending records and close the journal.
+    void close();
+
+    bool is_open() const
+    {
+        return nullptr != file_;
+    }
+
+    //! Append the change of a participant, as received by the database.
+    void append(
+            const CacheChange_t& change,
+            const DiscoveryParticipantChangeData& participant_change_data);
+
+    //! Append the change of an endpoint, as received by the database.
+    void append(
+            DiscoveryJournalEntity entity,
+            const CacheChange_t& change,
+            const std::string& topic);
+
+    //! Write the pending records and sync them to disk.
+    void sync();
+
+    //! Whether the records appended since the last snapshot take more space than the snapshot.
+    bool compaction_pending() const;
+
+    /**
+     * Replace the contents of the journal with a new snapshot.
+     * The snapshot is written to a temporary file first, so a failure never leaves the journal without a snapshot.
+     * If the journal cannot be replaced, it is kept as it was, together with the records pending to be written.
+     * @param snapshot Records of the snapshot, as serialized by @c serialize_participant and @c serialize_endpoint.
+     * @return true if the journal has been compacted.
+     */
+    bool compact(
+            const std::vector<octet>& snapshot);
+
+    /**
+     * Read a journal file, keeping the last record of each entity.
+     * The records are stored in the order they have been appended to the journal.
+     * A truncated or damaged trailing record, as left by a crash in the middle of a write, is discarded.
+     * @param file_name Name of the journal file.
+     * @param buffer Buffer to load the file in. Records point to it, so it must outlive them.
+     * @param records Entities stored in the journal.
+     * @return false if the file does not exist or is not a journal.
+     */
+    static bool read(
+            const std::string& file_name,
+            std::vector<octet>& buffer,
+            std::vector<DiscoveryJournalRecord>& records);
+
+    //! Serialize the record of a participant into @c buffer.
+    static void serialize_participant(
+            std::vector<octet>& buffer,
+            const CacheChange_t& change,
+            const DiscoveryParticipantChangeData& participant_change_data,
+            const DiscoveryParticipantsAckStatus* ack_status = nullptr);
+
+    //! Serialize the record of an endpoint into @c buffer.
+    static void serialize_endpoint(
+            std::vector<octet>& buffer,
+            DiscoveryJournalEntity entity,
+            const CacheChange_t& change,
+            const std::string& topic,
+            const DiscoveryParticipantsAckStatus* ack_status = nullptr);
+
+    //! Number of records serialized before the pending ones are written to the file.
+    static constexpr std::size_t sync_batch = 64u;
+
+    //! Minimum size of the records appended since the last snapshot before compacting the journal.
+    static constexpr std::size_t min_compaction_size = 64u * 1024u;
+
+private:
+
+    bool write_pending_();
+
+    // Replace the journal file with new_file_name, closing the journal if it succeeds
+    bool replace_file_(
+            const std::string& new_file_name);
+
+    std::string file_name_;
+
+    std::FILE* file_ = nullptr;
+
+    // Records not yet written to the file
+    std::vector<octet> pending_;
+
+    std::size_t pending_records_ = 0;
+
+    // Whether there are written records not yet synced to disk
+    bool unsynced_ = false;
+
+    std::size_t snapshot_size_ = 0;
+
+    std::size_t appended_size_ = 0;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_ */
@@ -764,73 +764,76 @@ bool EDP::pairingReader(
     EPROSIMA_LOG_INFO(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
-    {
-        pit++;
-    }
+    // Only writers on the same topic can match
+    std::vector<WriterProxyData*> writers;
+    mp_PDP->writers_on_topic(rdata.topicName(), writers);
+
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_PDP->getRTPSParticipant()->getGuid().guidPrefix;
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    for (WriterProxyData* wdatait : writers)
     {
-        for (auto& pair : *(*pit)->m_writers)
+        if (!match_local_endpoints && wdatait->guid().guidPrefix == local_prefix)
+        {
+            continue;
+        }
+
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = R->getGuid();
+        const GUID_t& writer_guid = wdatait->guid();
+
+        if (valid)
         {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = R->getGuid();
-            const GUID_t& writer_guid = wdatait->guid();
-
-            if (valid)
-            {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, (*pit)->m_guid,
-                        *wdatait, R->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            GUID_t remote_participant_guid(writer_guid.guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(reader_guid, remote_participant_guid,
+                    *wdatait, R->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (R->matched_writer_add(*wdatait))
+            if (R->matched_writer_add(*wdatait))
+            {
+                static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid() << " match R:" << reader_guid << ". RLoc:" <<
+                        wdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->get_listener() != nullptr)
                 {
-                    static_cast<void>(reader_guid);  // Void cast to force usage if we don't have LOG_INFOs
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid() << " match R:" << reader_guid << ". RLoc:" <<
-                            wdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->get_listener()->on_reader_matched(R, info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->get_listener()->on_reader_matched(R, info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->get_listener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->get_listener() != nullptr)
-                {
-                    R->get_listener()->on_requested_incompatible_qos(R, incompatible_qos);
-                }
+                R->get_listener()->on_requested_incompatible_qos(R, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (R->matched_writer_is_matched(wdatait->guid())
-                        && R->matched_writer_remove(wdatait->guid()))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (R->matched_writer_is_matched(wdatait->guid())
+                    && R->matched_writer_remove(wdatait->guid()))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid());
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->get_listener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->get_listener()->on_reader_matched(R, info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->get_listener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->get_listener()->on_reader_matched(R, info);
                 }
             }
         }
@@ -849,84 +852,83 @@ bool EDP::pairingWriter(
     EPROSIMA_LOG_INFO(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-    if (!this->mp_PDP->getRTPSParticipant()->should_match_local_endpoints())
-    {
-        pit++;
-    }
+    // Only readers on the same topic can match
+    std::vector<ReaderProxyData*> readers;
+    mp_PDP->readers_on_topic(wdata.topicName(), readers);
 
-    for (; pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    bool match_local_endpoints = mp_PDP->getRTPSParticipant()->should_match_local_endpoints();
+    const GuidPrefix_t& local_prefix = mp_PDP->getRTPSParticipant()->getGuid().guidPrefix;
+
+    for (ReaderProxyData* rdatait : readers)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        const GUID_t& reader_guid = rdatait->guid();
+        if (reader_guid == c_Guid_Unknown ||
+                (!match_local_endpoints && reader_guid.guidPrefix == local_prefix))
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid();
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
 
-            if (valid)
-            {
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                        *rdatait, W->getAttributes().security_attributes()))
-                {
-                    EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            GUID_t remote_participant_guid(reader_guid.guidPrefix, c_EntityId_RTPSParticipant);
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), remote_participant_guid,
+                    *rdatait, W->getAttributes().security_attributes()))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-                if (W->matched_reader_add(*rdatait))
+            if (W->matched_reader_add(*rdatait))
+            {
+                EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
+                        rdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
                 {
-                    EPROSIMA_LOG_INFO(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
-                            rdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
-
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, 1);
-                        W->getListener()->onWriterMatched(W, pub_info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
+
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, 1);
+                    W->getListener()->onWriterMatched(W, pub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
-                {
-                    W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
-                }
+                W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
+            }
 
-                //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
-                {
+            //EPROSIMA_LOG_INFO(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, -1);
-                        W->getListener()->onWriterMatched(W, pub_info);
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, -1);
+                    W->getListener()->onWriterMatched(W, pub_info);
 
-                    }
                 }
             }
         }
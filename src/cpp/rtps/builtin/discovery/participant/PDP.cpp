@@ -19,8 +19,10 @@
 
 #include <rtps/builtin/discovery/participant/PDP.h>
 
+#include <algorithm>
 #include <mutex>
 #include <chrono>
+#include <string>
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
@@ -154,6 +156,34 @@ PDP::~PDP()
     delete mp_mutex;
 }
 
+/**
+ * Find the locator kinds on which a remote participant announced that it receives compressed messages.
+ *
+ * @param [in] participant_data Data of the remote participant.
+ * @param [out] kinds Locator kinds announced by the remote participant.
+ * @return true when the remote participant announced them.
+ */
+static bool find_compression_locator_kinds(
+        const ParticipantProxyData& participant_data,
+        std::string& kinds)
+{
+    auto property = std::find_if(
+        participant_data.m_properties.begin(),
+        participant_data.m_properties.end(),
+        [](const dds::ParameterProperty_t& property)
+        {
+            return property.first() == dds::parameter_property_compression_locator_kinds;
+        });
+
+    if (property == participant_data.m_properties.end())
+    {
+        return false;
+    }
+
+    kinds = property->second();
+    return true;
+}
+
 ParticipantProxyData* PDP::add_participant_proxy_data(
         const GUID_t& participant_guid,
         bool with_lease_duration,
@@ -203,6 +233,13 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
         ret_val->isAlive = true;
         // Notify discovery of remote participant
         getRTPSParticipant()->on_entity_discovery(participant_guid, ret_val->m_properties);
+
+        // Compress the user data sent to the remote participant if it is able to decompress it
+        std::string compression_kinds;
+        if (find_compression_locator_kinds(*ret_val, compression_kinds))
+        {
+            mp_RTPSParticipant->add_compression_peer(ret_val->default_locators.unicast, compression_kinds);
+        }
     }
     participant_proxies_.push_back(ret_val);
 
@@ -460,6 +497,10 @@ void PDP::disable()
         std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
         participants.insert(participants.end(), participant_proxies_.begin() + 1, participant_proxies_.end());
         participant_proxies_.erase(participant_proxies_.begin() + 1, participant_proxies_.end());
+        for (ParticipantProxyData* pdata : participants)
+        {
+            remove_from_topic_indexes(pdata);
+        }
     }
 
     // Unmatch all remote participants
@@ -718,6 +759,7 @@ bool PDP::removeReaderProxyData(
             if (rit != pit->m_readers->end())
             {
                 ReaderProxyData* pR = rit->second;
+                reader_topic_index_.remove(pR);
                 mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -764,6 +806,7 @@ bool PDP::removeWriterProxyData(
             if (wit != pit->m_writers->end())
             {
                 WriterProxyData* pW = wit->second;
+                writer_topic_index_.remove(pW);
                 mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
 
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -860,6 +903,9 @@ ReaderProxyData* PDP::addReaderProxyData(
                     return nullptr;
                 }
 
+                // The topic may have changed
+                reader_topic_index_.add(ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -912,6 +958,8 @@ ReaderProxyData* PDP::addReaderProxyData(
                 return nullptr;
             }
 
+            reader_topic_index_.add(ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -961,6 +1009,9 @@ WriterProxyData* PDP::addWriterProxyData(
                     return nullptr;
                 }
 
+                // The topic may have changed
+                writer_topic_index_.add(ret_val);
+
                 RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
                 if (listener)
                 {
@@ -1012,6 +1063,8 @@ WriterProxyData* PDP::addWriterProxyData(
                 return nullptr;
             }
 
+            writer_topic_index_.add(ret_val);
+
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
             if (listener)
             {
@@ -1193,6 +1246,7 @@ bool PDP::remove_remote_participant(
             {
                 pdata = *pit;
                 participant_proxies_.erase(pit);
+                remove_from_topic_indexes(pdata);
                 break;
             }
         }
@@ -1208,6 +1262,19 @@ bool PDP::remove_remote_participant(
     return false;
 }
 
+void PDP::remove_from_topic_indexes(
+        const ParticipantProxyData* pdata)
+{
+    for (const auto& reader : *pdata->m_readers)
+    {
+        reader_topic_index_.remove(reader.second);
+    }
+    for (const auto& writer : *pdata->m_writers)
+    {
+        writer_topic_index_.remove(writer.second);
+    }
+}
+
 void PDP::actions_on_remote_participant_removed(
         ParticipantProxyData* pdata,
         const GUID_t& partGUID,
@@ -1301,6 +1368,12 @@ void PDP::actions_on_remote_participant_removed(
             mp_RTPSParticipant->update_removed_participant(remote_participant_locators);
         }
 
+        std::string compression_kinds;
+        if (find_compression_locator_kinds(*pdata, compression_kinds))
+        {
+            mp_RTPSParticipant->remove_compression_peer(pdata->default_locators.unicast, compression_kinds);
+        }
+
         // Return reader proxy objects to pool
         for (auto pit : *pdata->m_readers)
         {
@@ -1380,6 +1453,20 @@ ParticipantProxyData* PDP::get_participant_proxy_data(
     return nullptr;
 }
 
+void PDP::readers_on_topic(
+        const fastcdr::string_255& topic_name,
+        std::vector<ReaderProxyData*>& readers) const
+{
+    reader_topic_index_.get(topic_name.to_string(), readers);
+}
+
+void PDP::writers_on_topic(
+        const fastcdr::string_255& topic_name,
+        std::vector<WriterProxyData*>& writers) const
+{
+    writer_topic_index_.get(topic_name.to_string(), writers);
+}
+
 std::list<eprosima::fastdds::rtps::RemoteServerAttributes>& PDP::remote_server_attributes()
 {
     return mp_builtin->m_DiscoveryServers;
@@ -1457,6 +1544,15 @@ void PDP::set_external_participant_properties_(
     auto ptype = participant_type.str();
     participant_data->m_properties.push_back(fastdds::dds::parameter_property_participant_type, ptype);
 
+    // Announce the locator kinds on which compressed messages are received, so other participants only compress the
+    // messages they send to this one when it is able to decompress them
+    std::string compression_kinds = mp_RTPSParticipant->compression_locator_kinds();
+    if (!compression_kinds.empty())
+    {
+        participant_data->m_properties.push_back(fastdds::dds::parameter_property_compression_locator_kinds,
+                compression_kinds);
+    }
+
     // Add physical properties if present
     // TODO: This should be done using propagate value, however this cannot be done without breaking compatibility
     std::vector<std::string> physical_property_names = {
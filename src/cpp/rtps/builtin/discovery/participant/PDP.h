@@ -25,6 +25,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
@@ -38,6 +39,7 @@
 #include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
 #include <statistics/rtps/monitor-service/interfaces/IProxyObserver.hpp>
+#include <rtps/builtin/data/ProxyTopicIndex.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IProxyQueryable.hpp>
 #include <utils/ProxyPool.hpp>
 
@@ -430,6 +432,26 @@ public:
     ParticipantProxyData* get_participant_proxy_data(
             const GuidPrefix_t& guid_prefix);
 
+    /**
+     * Get the reader proxies on a topic, including the ones of the local participant.
+     * Should be called with the PDP mutex taken.
+     * @param topic_name Name of the topic.
+     * @param [out] readers Vector where the reader proxies are appended.
+     */
+    void readers_on_topic(
+            const fastcdr::string_255& topic_name,
+            std::vector<ReaderProxyData*>& readers) const;
+
+    /**
+     * Get the writer proxies on a topic, including the ones of the local participant.
+     * Should be called with the PDP mutex taken.
+     * @param topic_name Name of the topic.
+     * @param [out] writers Vector where the writer proxies are appended.
+     */
+    void writers_on_topic(
+            const fastcdr::string_255& topic_name,
+            std::vector<WriterProxyData*>& writers) const;
+
     /**
      * Get the list of remote servers to which the client should connect
      * @return A reference to the list of RemoteServerAttributes
@@ -530,6 +552,10 @@ protected:
     size_t writer_proxies_number_;
     //!Pool of writer proxy data objects ready for reuse
     ResourceLimitedVector<WriterProxyData*> writer_proxies_pool_;
+    //!Reader proxies of all the participants, by topic
+    ProxyTopicIndex<ReaderProxyData> reader_topic_index_;
+    //!Writer proxies of all the participants, by topic
+    ProxyTopicIndex<WriterProxyData> writer_topic_index_;
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
     //! ProxyPool for temporary reader proxies
@@ -640,6 +666,15 @@ private:
     void set_external_participant_properties_(
             ParticipantProxyData* participant_data);
 
+    /**
+     * Removes the endpoints of a participant from the topic indexes.
+     * Should be called with the PDP mutex taken, when the participant is removed from participant_proxies_.
+     *
+     * @param pdata ParticipantProxyData being removed.
+     */
+    void remove_from_topic_indexes(
+            const ParticipantProxyData* pdata);
+
     /**
      * Performs all the necessary actions after removing a ParticipantProxyData from the
      * participant_proxies_ collection.
@@ -157,9 +157,19 @@ void PDPServer::pre_enable_actions()
     if (durability_ == TRANSIENT)
     {
         nlohmann::json backup_json;
+        std::vector<octet> journal_buffer;
+        std::vector<ddb::DiscoveryJournalRecord> journal_records;
         // If the DS is BACKUP, try to restore DDB from file
         discovery_db().backup_in_progress(true);
-        if (read_backup(backup_json, backup_queue))
+        if (ddb::DiscoveryJournal::read(get_ddb_journal_file_name(), journal_buffer, journal_records))
+        {
+            if (process_backup_journal_restore(journal_records))
+            {
+                EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
+            }
+        }
+        // Backups from previous versions are kept in json
+        else if (read_backup(backup_json, backup_queue))
         {
             if (process_backup_discovery_database_restore(backup_json))
             {
@@ -174,7 +184,9 @@ void PDPServer::pre_enable_actions()
 
         discovery_db().backup_in_progress(false);
 
-        discovery_db_.persistence_enable(get_ddb_queue_persistence_file_name());
+        discovery_db_.persistence_enable(get_ddb_journal_file_name());
+        // Start the journal from the restored state, dropping any damaged record left by the previous run
+        discovery_db_.clean_backup();
     }
     else
     {
@@ -797,6 +809,13 @@ std::string PDPServer::get_ddb_queue_persistence_file_name() const
     return filename.str();
 }
 
+std::string PDPServer::get_ddb_journal_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << "_journal.db";
+    return filename.str();
+}
+
 void PDPServer::announceParticipantState(
         bool new_change,
         bool dispose /* = false */,
@@ -1867,6 +1886,98 @@ bool PDPServer::process_backup_discovery_database_restore(
     return true;
 }
 
+bool PDPServer::process_backup_journal_restore(
+        const std::vector<ddb::DiscoveryJournalRecord>& records)
+{
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "Restoring DiscoveryDataBase from journal backup");
+
+    // We need every listener to resend the changes of every entity (ALIVE) in the DDB, so the PaticipantProxy
+    // is restored
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
+
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastdds::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    std::map<eprosima::fastdds::rtps::InstanceHandle_t, fastdds::rtps::CacheChange_t*> changes_map;
+    const GuidPrefix_t& server_prefix = endpoints->writer.writer_->getGuid().guidPrefix;
+
+    // Participants go first, so their proxies exist when the ones of their endpoints are created
+    for (ddb::DiscoveryJournalEntity entity : {ddb::DiscoveryJournalEntity::PARTICIPANT,
+                                               ddb::DiscoveryJournalEntity::WRITER,
+                                               ddb::DiscoveryJournalEntity::READER})
+    {
+        for (const ddb::DiscoveryJournalRecord& record : records)
+        {
+            if (record.entity != entity)
+            {
+                continue;
+            }
+
+            bool is_virtual = ddb::DiscoveryJournalEntity::PARTICIPANT != entity &&
+                    record.topic == discovery_db().virtual_topic();
+            fastdds::rtps::CacheChange_t* change_aux = nullptr;
+            if (is_virtual)
+            {
+                change_aux = new fastdds::rtps::CacheChange_t();
+                change_aux->serializedPayload.reserve(record.payload_length);
+            }
+            else
+            {
+                // Reserve memory for new change. There will not be changes from own server
+                BaseReader* reader = ddb::DiscoveryJournalEntity::PARTICIPANT == entity ?
+                        static_cast<BaseReader*>(endpoints->reader.reader_) :
+                        ddb::DiscoveryJournalEntity::WRITER == entity ?
+                        static_cast<BaseReader*>(edp->publications_reader_.first) :
+                        static_cast<BaseReader*>(edp->subscriptions_reader_.first);
+                if (!reader->reserve_cache(record.payload_length, change_aux))
+                {
+                    EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
+                    return false;
+                }
+            }
+
+            record.to_change(*change_aux);
+            changes_map.insert(std::make_pair(change_aux->instanceHandle, change_aux));
+
+            // call listener to create proxy info for other entities different than server
+            if (change_aux->write_params.sample_identity().writer_guid().guidPrefix == server_prefix ||
+                    change_aux->kind != fastdds::rtps::ALIVE ||
+                    is_virtual)
+            {
+                continue;
+            }
+
+            switch (entity)
+            {
+                case ddb::DiscoveryJournalEntity::PARTICIPANT:
+                    // If the change was stored as is_local we must pass it to listener with his own writer_guid
+                    if (record.is_local)
+                    {
+                        change_aux->writerGUID = change_aux->write_params.sample_identity().writer_guid();
+                        change_aux->sequenceNumber = change_aux->write_params.sample_identity().sequence_number();
+                        builtin_endpoints_->main_listener()->on_new_cache_change_added(
+                            endpoints->reader.reader_, change_aux);
+                    }
+                    break;
+                case ddb::DiscoveryJournalEntity::WRITER:
+                    edp_pub_listener->on_new_cache_change_added(edp->publications_reader_.first, change_aux);
+                    break;
+                case ddb::DiscoveryJournalEntity::READER:
+                    edp_sub_listener->on_new_cache_change_added(edp->subscriptions_reader_.first, change_aux);
+                    break;
+            }
+        }
+    }
+
+    // load database
+    return discovery_db_.from_journal(records, changes_map);
+}
+
 bool PDPServer::process_backup_restore_queue(
         std::vector<nlohmann::json>& /* new_changes */)
 {
@@ -2000,21 +2111,16 @@ bool PDPServer::process_backup_restore_queue(
 
 void PDPServer::process_backup_store()
 {
-    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in json backup");
-
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
-
-    // Set j with the json from database dump
-    nlohmann::json j;
-    discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
-
-    // Clear queue ddb backup
-    discovery_db_.clean_backup();
+    // Every change received is already in the journal, so the state of the DDB is only dumped when compacting it
+    if (discovery_db_.backup_compaction_pending())
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in journal backup");
+        discovery_db_.clean_backup();
+    }
+    else
+    {
+        discovery_db_.sync_backup();
+    }
 }
 
 void PDPServer::match_pdp_writer_nts_(
@@ -172,6 +172,9 @@ public:
     //! Get filename for discovery database file
     std::string get_ddb_queue_persistence_file_name() const;
 
+    //! Get filename for discovery database journal file
+    std::string get_ddb_journal_file_name() const;
+
     /*
      * Wakes up the DServerRoutineEvent for new matching or trimming
      * By default the server execute the routine instantly
@@ -279,6 +282,11 @@ protected:
     bool process_backup_restore_queue(
             std::vector<nlohmann::json>& new_changes);
 
+    // Same as process_backup_discovery_database_restore, from the entities stored in the binary journal
+    // This method must be called with the DDB variable backup_in_progress as true
+    bool process_backup_journal_restore(
+            const std::vector<ddb::DiscoveryJournalRecord>& records);
+
     // Reads the two backup files and stores each json objects in both arguments
     // The first argument has the json object to restore the DDB
     // The second argument has the json vector object to restore the changes that must be sent again to the queue
@@ -291,8 +299,8 @@ protected:
     // General file name for the prefix of every backup file
     std::ostringstream get_persistence_file_name_() const;
 
-    // Erase the last file and store the backup info of the actual state of the DDB
-    // Erase the content of the file with the changes in the queues
+    // Sync to disk the changes appended to the journal since the last call. Once they take more space than the
+    // actual state of the DDB, replace the journal with a snapshot of that state
     // This method must be called after the whole DDB routine process has been finished and with the DDB
     // queues empty. If not, there will be some information that could be lost. For this, the lock_incoming_data()
     // from DDB must be called during this process
@@ -58,9 +58,60 @@ void FlowControllerFactory::register_flow_controller (
         return;
     }
 
+    // Priorities and reservations have to be enforced among all the writers, so they need a single sender thread.
+    if (1 < flow_controller_descr.sender_threads &&
+            (FlowControllerSchedulerPolicy::HIGH_PRIORITY == flow_controller_descr.scheduler ||
+            FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION == flow_controller_descr.scheduler))
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                "Error registering FlowController " << flow_controller_descr.name <<
+                ". Its scheduler orders writers by priority, so it can only have one sender thread");
+        return;
+    }
+
     const ThreadSettings& sender_thread_settings = flow_controller_descr.sender_thread;
 
-    if (0 < flow_controller_descr.max_bytes_per_period)
+    if (0 < flow_controller_descr.max_bytes_per_period && 0 < flow_controller_descr.max_burst_bytes)
+    {
+        switch (flow_controller_descr.scheduler)
+        {
+            case FlowControllerSchedulerPolicy::FIFO:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerFifoSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerRoundRobinSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerHighPrioritySchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                                FlowControllerPriorityWithReservationSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                break;
+            default:
+                assert(false);
+        }
+    }
+    else if (0 < flow_controller_descr.max_bytes_per_period)
     {
         switch (flow_controller_descr.scheduler)
         {
@@ -1,11 +1,16 @@
 #ifndef _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "FlowController.hpp"
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
@@ -272,6 +277,51 @@ struct FlowControllerSyncPublishMode : public FlowControllerPureSyncPublishMode,
 
 };
 
+/*!
+ * Bytes that can be sent in the current period, shared by all the sender lanes of a flow controller.
+ * Each lane takes the bytes it sends out of it, so a single busy lane can use the whole bandwidth.
+ */
+struct FlowControllerPeriodBudget
+{
+    FlowControllerPeriodBudget(
+            int32_t max_bytes_per_period,
+            std::chrono::milliseconds period_ms)
+        : max_bytes_per_period(max_bytes_per_period)
+        , period_ms(period_ms)
+    {
+    }
+
+    /*!
+     * Start a new period if the current one has elapsed.
+     *
+     * @pre @c mutex is locked.
+     */
+    void update_nts(
+            const std::chrono::steady_clock::time_point& now)
+    {
+        if (now - period_start >= period_ms)
+        {
+            period_start = now;
+            consumed = 0;
+            ++period;
+        }
+    }
+
+    std::mutex mutex;
+
+    const int64_t max_bytes_per_period;
+
+    const std::chrono::milliseconds period_ms;
+
+    std::chrono::steady_clock::time_point period_start = std::chrono::steady_clock::now();
+
+    //! Bytes sent by all the lanes in the current period.
+    int64_t consumed = 0;
+
+    //! Number of the current period.
+    uint64_t period = 0;
+};
+
 //! Sends all samples asynchronously but with bandwidth limitation.
 struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublishMode
 {
@@ -285,9 +335,17 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         max_bytes_per_period = descriptor->max_bytes_per_period;
         period_ms = std::chrono::milliseconds(descriptor->period_ms);
+        budget_ = std::make_shared<FlowControllerPeriodBudget>(max_bytes_per_period, period_ms);
         group.set_sent_bytes_limitation(static_cast<uint32_t>(max_bytes_per_period));
     }
 
+    //! Take the bytes to send from the budget of @c other, so both are limited together.
+    void share_budget(
+            const FlowControllerLimitedAsyncPublishMode& other)
+    {
+        budget_ = other.budget_;
+    }
+
     bool fast_check_is_there_slot_for_change(
             CacheChange_t* change)
     {
@@ -307,7 +365,7 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         }
 
-        bool ret = (max_bytes_per_period - group.get_current_bytes_processed()) > size_to_check;
+        bool ret = account() > size_to_check;
 
         if (!ret)
         {
@@ -326,7 +384,13 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
     bool wait(
             std::unique_lock<fastdds::TimedMutex>& lock)
     {
-        auto lapse = std::chrono::steady_clock::now() - last_period_;
+        std::chrono::steady_clock::time_point period_start;
+        {
+            std::lock_guard<std::mutex> budget_lock(budget_->mutex);
+            period_start = budget_->period_start;
+        }
+
+        auto lapse = std::chrono::steady_clock::now() - period_start;
         bool reset_limit = true;
 
         if (lapse < period_ms)
@@ -339,9 +403,8 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         if (reset_limit)
         {
-            last_period_ = std::chrono::steady_clock::now();
             force_wait_ = false;
-            group.reset_current_bytes_processed();
+            start_period();
         }
 
         return reset_limit;
@@ -367,9 +430,260 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
 private:
 
+    /*!
+     * Take the bytes processed by the group since the last call out of the shared budget, starting a new period if
+     * the current one has elapsed. The group is then limited to the bytes left in the period.
+     *
+     * @return Bytes left in the current period.
+     */
+    int64_t account()
+    {
+        std::lock_guard<std::mutex> budget_lock(budget_->mutex);
+
+        uint32_t processed = group.get_current_bytes_processed();
+        budget_->consumed += processed - accounted_bytes_;
+        budget_->update_nts(std::chrono::steady_clock::now());
+        if (period_ != budget_->period)
+        {
+            // Bytes still buffered in the group remain in its count, and are taken from the new period too
+            period_ = budget_->period;
+            group.reset_current_bytes_processed();
+            accounted_bytes_ = 0;
+        }
+        else
+        {
+            accounted_bytes_ = processed;
+        }
+
+        int64_t left = budget_->max_bytes_per_period - budget_->consumed;
+        group.set_sent_bytes_limitation(accounted_bytes_ + static_cast<uint32_t>((std::max)(int64_t(0), left)));
+        return left;
+    }
+
+    /*!
+     * Called when the period of the group has elapsed. Bytes processed by the group since it last took them out of
+     * the budget belong to the elapsed period, so they are dropped with it.
+     */
+    void start_period()
+    {
+        std::lock_guard<std::mutex> budget_lock(budget_->mutex);
+
+        budget_->update_nts(std::chrono::steady_clock::now());
+        period_ = budget_->period;
+        group.reset_current_bytes_processed();
+        accounted_bytes_ = 0;
+
+        int64_t left = budget_->max_bytes_per_period - budget_->consumed;
+        group.set_sent_bytes_limitation(static_cast<uint32_t>((std::max)(int64_t(0), left)));
+    }
+
+    std::shared_ptr<FlowControllerPeriodBudget> budget_;
+
+    //! Bytes processed by the group already taken out of the budget.
+    uint32_t accounted_bytes_ = 0;
+
+    //! Period of the budget the group count belongs to.
+    uint64_t period_ = 0;
+
+    bool force_wait_ = false;
+};
+
+/*!
+ * Token bucket shared by all the sender lanes of a flow controller.
+ * Each lane takes the bytes it sends out of it, so a single busy lane can use the whole bandwidth.
+ * Lanes sending at the same time may overdraw it. The debt is paid back before any lane sends again, so the
+ * configured rate is kept.
+ */
+struct FlowControllerTokenBucket
+{
+    FlowControllerTokenBucket(
+            double bytes_per_ns,
+            uint32_t max_burst_bytes)
+        : bytes_per_ns(bytes_per_ns)
+        , max_burst_bytes(max_burst_bytes)
+        , tokens(max_burst_bytes)
+    {
+    }
+
+    /*!
+     * Add the tokens generated since the last refill.
+     *
+     * @pre @c mutex is locked.
+     */
+    void refill_nts(
+            const std::chrono::steady_clock::time_point& now)
+    {
+        double elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    now - last_refill).count());
+        last_refill = now;
+        tokens = (std::min)(static_cast<double>(max_burst_bytes), tokens + elapsed_ns * bytes_per_ns);
+    }
+
+    std::mutex mutex;
+
+    const double bytes_per_ns;
+
+    const uint32_t max_burst_bytes;
+
+    double tokens;
+
+    std::chrono::steady_clock::time_point last_refill = std::chrono::steady_clock::now();
+};
+
+//! Sends all samples asynchronously, pacing them with a token bucket.
+struct FlowControllerTokenBucketPublishMode : public FlowControllerAsyncPublishMode
+{
+    FlowControllerTokenBucketPublishMode(
+            RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerAsyncPublishMode(participant, descriptor)
+    {
+        assert(nullptr != descriptor);
+        assert(0 < descriptor->max_bytes_per_period);
+        assert(0 < descriptor->max_burst_bytes);
+
+        // The bucket is refilled continuously at the rate of max_bytes_per_period every period_ms
+        bytes_per_ns_ = static_cast<double>(descriptor->max_bytes_per_period) /
+                static_cast<double>(std::chrono::nanoseconds(std::chrono::milliseconds(descriptor->period_ms)).count());
+        max_burst_bytes = descriptor->max_burst_bytes;
+        bucket_ = std::make_shared<FlowControllerTokenBucket>(bytes_per_ns_, max_burst_bytes);
+        tokens_ = max_burst_bytes;
+        refill_period_ = std::chrono::nanoseconds(static_cast<int64_t>(max_burst_bytes / bytes_per_ns_));
+        group.set_sent_bytes_limitation(max_burst_bytes);
+    }
+
+    //! Take the bytes to send from the bucket of @c other, so both are paced together.
+    void share_budget(
+            const FlowControllerTokenBucketPublishMode& other)
+    {
+        bucket_ = other.bucket_;
+    }
+
+    bool fast_check_is_there_slot_for_change(
+            CacheChange_t* change)
+    {
+        // Not fragmented sample, the fast check is if the serialized payload fit.
+        uint32_t size_to_check = change->serializedPayload.length;
+
+        if (0 != change->getFragmentCount())
+        {
+            // For fragmented sample, the fast check is the minor fragments fit.
+            size_to_check = change->serializedPayload.length % change->getFragmentSize();
+
+            if (0 == size_to_check)
+            {
+                size_to_check = change->getFragmentSize();
+            }
+        }
+
+        refill();
+        // A full bucket lets through changes bigger than the burst, which would never fit otherwise.
+        bool ret = tokens_ > size_to_check || tokens_ >= max_burst_bytes;
+
+        if (!ret)
+        {
+            needed_tokens_ = (std::min)(static_cast<double>(max_burst_bytes), static_cast<double>(size_to_check) + 1);
+            force_wait_ = true;
+        }
+
+        return ret;
+    }
+
+    /*!
+     * Wait until there is a new change added (notified by other thread) or, when the bucket has not enough tokens for
+     * the next change, until it has been refilled enough.
+     *
+     * @return true if the time to refill the whole bucket has elapsed since the last time true was returned, so the
+     * bandwidth limitation of the scheduler has to be reset.
+     */
+    bool wait(
+            std::unique_lock<fastdds::TimedMutex>& lock)
+    {
+        if (!force_wait_)
+        {
+            cv.wait(lock);
+            return false;
+        }
+
+        refill();
+        if (tokens_ < needed_tokens_)
+        {
+            cv.wait_for(lock, std::chrono::nanoseconds(
+                        static_cast<int64_t>((needed_tokens_ - tokens_) / bytes_per_ns_) + 1));
+            refill();
+        }
+
+        if (tokens_ >= needed_tokens_)
+        {
+            force_wait_ = false;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_reset_ >= refill_period_)
+        {
+            last_reset_ = now;
+            return true;
+        }
+        return false;
+    }
+
+    bool force_wait() const
+    {
+        return force_wait_;
+    }
+
+    void process_deliver_retcode(
+            const DeliveryRetCode& ret_value)
+    {
+        if (DeliveryRetCode::EXCEEDED_LIMIT == ret_value)
+        {
+            // The message did not fit with its headers. Wait for at least as many tokens as there are now.
+            needed_tokens_ = (std::min)(static_cast<double>(max_burst_bytes), tokens_ * 2 + 1);
+            force_wait_ = true;
+        }
+    }
+
+    uint32_t max_burst_bytes = 0;
+
+private:
+
+    /*!
+     * Take the bytes processed by the group out of the shared bucket, and add the tokens generated since the last
+     * refill. The group is then limited to the tokens in the bucket.
+     */
+    void refill()
+    {
+        std::lock_guard<std::mutex> bucket_lock(bucket_->mutex);
+
+        // Bytes still buffered in the group were already taken out of the bucket, and they remain in the count of
+        // processed bytes until the limit is reset again.
+        uint32_t processed = group.get_current_bytes_processed();
+        bucket_->tokens -= static_cast<double>(processed - accounted_bytes_);
+        bucket_->refill_nts(std::chrono::steady_clock::now());
+        tokens_ = bucket_->tokens;
+
+        group.reset_current_bytes_processed();
+        accounted_bytes_ = group.get_current_bytes_processed();
+        group.set_sent_bytes_limitation(accounted_bytes_ + (std::max)(1u,
+                static_cast<uint32_t>((std::max)(0.0, tokens_))));
+    }
+
+    std::shared_ptr<FlowControllerTokenBucket> bucket_;
+
+    double bytes_per_ns_ = 0;
+
+    //! Tokens in the shared bucket on the last refill.
+    double tokens_ = 0;
+
+    double needed_tokens_ = 0;
+
+    uint32_t accounted_bytes_ = 0;
+
     bool force_wait_ = false;
 
-    std::chrono::steady_clock::time_point last_period_ = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds refill_period_ {0};
+
+    std::chrono::steady_clock::time_point last_reset_ = std::chrono::steady_clock::now();
 };
 
 
@@ -920,13 +1234,37 @@ private:
 
     uint32_t size_being_processed_ = 0;
 };
-
 template<typename PublishMode, typename SampleScheduling>
 class FlowControllerImpl : public FlowController
 {
     using publish_mode = PublishMode;
     using scheduler = SampleScheduling;
 
+    /*!
+     * Samples of a subset of the writers, and the asynchronous thread sending them.
+     * Each writer is always served by the same lane, so its samples keep their order.
+     * Every lane has its own scheduler, so the schedulers ordering writers by priority only run on one lane.
+     * The bandwidth limitation is shared by all of them.
+     */
+    struct SenderLane
+    {
+        SenderLane(
+                RTPSParticipantImpl* participant,
+                const FlowControllerDescriptor* descriptor)
+            : async_mode(participant, descriptor)
+        {
+        }
+
+        fastdds::TimedMutex mutex;
+
+        std::map<GUID_t, RTPSWriter*> writers;
+
+        scheduler sched;
+
+        // async_mode must be destroyed before sched.
+        publish_mode async_mode;
+    };
+
 public:
 
     FlowControllerImpl(
@@ -935,7 +1273,6 @@ public:
             uint32_t async_index,
             ThreadSettings thread_settings)
         : participant_(participant)
-        , async_mode(participant, descriptor)
         , participant_id_(0)
         , async_index_(async_index)
         , thread_settings_(thread_settings)
@@ -945,11 +1282,35 @@ public:
             participant_id_ = static_cast<uint32_t>(participant->getRTPSParticipantAttributes().participantID);
         }
 
+        uint32_t sender_threads = 1;
+        if (nullptr != descriptor && !std::is_same<FlowControllerPureSyncPublishMode, PublishMode>::value)
+        {
+            sender_threads = (std::max)(1u, descriptor->sender_threads);
+        }
+
+        if (1 < sender_threads && orders_by_priority())
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "FlowController " << descriptor->name <<
+                    " orders writers by priority, so it can only have one sender thread");
+            sender_threads = 1;
+        }
+
+        for (uint32_t i = 0; i < sender_threads; ++i)
+        {
+            lanes_.emplace_back(new SenderLane(participant, descriptor));
+            // All the lanes draw from the bandwidth of the first one
+            share_budget(*lanes_.back());
+        }
+
         uint32_t limitation = get_max_payload();
 
         if ((std::numeric_limits<uint32_t>::max)() != limitation)
         {
-            sched.set_bandwith_limitation(limitation);
+            for (auto& lane : lanes_)
+            {
+                lane->sched.set_bandwith_limitation(limitation);
+            }
         }
     }
 
@@ -974,11 +1335,12 @@ public:
     void register_writer(
             RTPSWriter* writer) override
     {
-        std::unique_lock<fastdds::TimedMutex> lock(mutex_);
-        auto ret = writers_.insert({ writer->getGuid(), writer});
+        SenderLane& lane = lane_of(writer->getGuid());
+        std::unique_lock<fastdds::TimedMutex> lock(lane.mutex);
+        auto ret = lane.writers.insert({ writer->getGuid(), writer});
         (void)ret;
         assert(ret.second);
-        register_writer_impl(writer);
+        register_writer_impl(lane, writer);
     }
 
     /*!
@@ -989,9 +1351,10 @@ public:
     void unregister_writer(
             RTPSWriter* writer) override
     {
-        std::unique_lock<fastdds::TimedMutex> lock(mutex_);
-        writers_.erase(writer->getGuid());
-        unregister_writer_impl(writer);
+        SenderLane& lane = lane_of(writer->getGuid());
+        std::unique_lock<fastdds::TimedMutex> lock(lane.mutex);
+        lane.writers.erase(writer->getGuid());
+        unregister_writer_impl(lane, writer);
     }
 
     /*
@@ -1052,21 +1415,64 @@ public:
 
 private:
 
+    //! Whether the scheduler orders all the writers by priority, so they cannot be spread over several lanes.
+    static constexpr bool orders_by_priority()
+    {
+        return std::is_same<FlowControllerHighPrioritySchedule, SampleScheduling>::value ||
+               std::is_same<FlowControllerPriorityWithReservationSchedule, SampleScheduling>::value;
+    }
+
+    //! Lane serving the writer with the given GUID.
+    SenderLane& lane_of(
+            const GUID_t& writer_guid)
+    {
+        if (1 == lanes_.size())
+        {
+            return *lanes_.front();
+        }
+
+        // FNV-1a over the GUID, so writers of the same participant are spread too
+        uint32_t hash = 2166136261u;
+        for (octet byte : writer_guid.guidPrefix.value)
+        {
+            hash = (hash ^ byte) * 16777619u;
+        }
+        for (octet byte : writer_guid.entityId.value)
+        {
+            hash = (hash ^ byte) * 16777619u;
+        }
+        return *lanes_[hash % lanes_.size()];
+    }
+
     /*!
-     * Initialize asynchronous thread.
+     * Initialize asynchronous threads.
      */
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     initialize_async_thread()
     {
-        bool expected = false;
-        if (async_mode.running.compare_exchange_strong(expected, true))
+        for (uint32_t i = 0; i < lanes_.size(); ++i)
         {
-            // Code for initializing the asynchronous thread.
-            async_mode.thread = create_thread([this]()
-                            {
-                                run();
-                            }, thread_settings_, "dds.asyn.%u.%u", participant_id_, async_index_);
+            SenderLane* lane = lanes_[i].get();
+            bool expected = false;
+            if (lane->async_mode.running.compare_exchange_strong(expected, true))
+            {
+                // Code for initializing the asynchronous thread.
+                auto run_lane = [this, lane]()
+                        {
+                            run(*lane);
+                        };
+                if (0 == i)
+                {
+                    lane->async_mode.thread = create_thread(run_lane, thread_settings_, "dds.asyn.%u.%u",
+                                    participant_id_, async_index_);
+                }
+                else
+                {
+                    lane->async_mode.thread = create_thread(run_lane, thread_settings_, "dds.asyn.%u.%u.%u",
+                                    participant_id_, async_index_, i);
+                }
+            }
         }
     }
 
@@ -1083,15 +1489,17 @@ private:
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     register_writer_impl(
+            SenderLane& lane,
             RTPSWriter* writer)
     {
-        std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
-        sched.register_writer(writer);
+        std::unique_lock<fastdds::TimedMutex> in_lock(lane.async_mode.changes_interested_mutex);
+        lane.sched.register_writer(writer);
     }
 
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     register_writer_impl(
+            SenderLane&,
             RTPSWriter*)
     {
         // Do nothing.
@@ -1100,15 +1508,17 @@ private:
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     unregister_writer_impl(
+            SenderLane& lane,
             RTPSWriter* writer)
     {
-        std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
-        sched.unregister_writer(writer);
+        std::unique_lock<fastdds::TimedMutex> in_lock(lane.async_mode.changes_interested_mutex);
+        lane.sched.unregister_writer(writer);
     }
 
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     unregister_writer_impl(
+            SenderLane&,
             RTPSWriter*)
     {
         // Do nothing.
@@ -1128,17 +1538,18 @@ private:
     {
         bool ret_value = false;
         assert(!change->writer_info.is_linked.load());
+        SenderLane& lane = lane_of(writer->getGuid());
         // Sync delivery failed. Try to store for asynchronous delivery.
 #if HAVE_STRICT_REALTIME
-        std::unique_lock<fastdds::TimedMutex> lock(async_mode.changes_interested_mutex, std::defer_lock);
+        std::unique_lock<fastdds::TimedMutex> lock(lane.async_mode.changes_interested_mutex, std::defer_lock);
         if (lock.try_lock_until(max_blocking_time))
 #else
         static_cast<void>(max_blocking_time);
-        std::unique_lock<fastdds::TimedMutex> lock(async_mode.changes_interested_mutex);
+        std::unique_lock<fastdds::TimedMutex> lock(lane.async_mode.changes_interested_mutex);
 #endif // if HAVE_STRICT_REALTIME{
         {
-            sched.add_new_sample(writer, change);
-            async_mode.cv.notify_one();
+            lane.sched.add_new_sample(writer, change);
+            lane.async_mode.cv.notify_one();
             ret_value = true;
         }
 
@@ -1230,16 +1641,17 @@ private:
 
         if (!change->writer_info.is_linked.load())
         {
+            SenderLane& lane = lane_of(writer->getGuid());
 #if HAVE_STRICT_REALTIME
-            std::unique_lock<fastdds::TimedMutex> lock(async_mode.changes_interested_mutex, std::defer_lock);
+            std::unique_lock<fastdds::TimedMutex> lock(lane.async_mode.changes_interested_mutex, std::defer_lock);
             if (lock.try_lock_until(max_blocking_time))
 #else
             static_cast<void>(max_blocking_time);
-            std::unique_lock<fastdds::TimedMutex> lock(async_mode.changes_interested_mutex);
+            std::unique_lock<fastdds::TimedMutex> lock(lane.async_mode.changes_interested_mutex);
 #endif // if HAVE_STRICT_REALTIME{
             {
-                sched.add_old_sample(writer, change);
-                async_mode.cv.notify_one();
+                lane.sched.add_old_sample(writer, change);
+                lane.async_mode.cv.notify_one();
                 ret_value = true;
             }
         }
@@ -1274,21 +1686,22 @@ private:
         bool ret_value = true;
         if (change->writer_info.is_linked.load())
         {
-            ++async_mode.writers_interested_in_remove;
+            SenderLane& lane = lane_of(change->writerGUID);
+            ++lane.async_mode.writers_interested_in_remove;
 #if HAVE_STRICT_REALTIME
-            std::unique_lock<fastdds::TimedMutex> lock(mutex_, std::defer_lock);
+            std::unique_lock<fastdds::TimedMutex> lock(lane.mutex, std::defer_lock);
             if (lock.try_lock_until(max_blocking_time))
 #else
             static_cast<void>(max_blocking_time);
-            std::unique_lock<fastdds::TimedMutex> lock(mutex_);
+            std::unique_lock<fastdds::TimedMutex> lock(lane.mutex);
 #endif // if HAVE_STRICT_REALTIME
             {
 #if HAVE_STRICT_REALTIME
-                std::unique_lock<fastdds::TimedMutex> interested_lock(async_mode.changes_interested_mutex,
+                std::unique_lock<fastdds::TimedMutex> interested_lock(lane.async_mode.changes_interested_mutex,
                         std::defer_lock);
                 if (interested_lock.try_lock_until(max_blocking_time))
 #else
-                std::unique_lock<fastdds::TimedMutex> interested_lock(async_mode.changes_interested_mutex);
+                std::unique_lock<fastdds::TimedMutex> interested_lock(lane.async_mode.changes_interested_mutex);
 #endif // if HAVE_STRICT_REALTIME
                 {
 
@@ -1321,7 +1734,7 @@ private:
                 ret_value = !change->writer_info.is_linked.load();
             }
 #endif // if HAVE_STRICT_REALTIME
-            --async_mode.writers_interested_in_remove;
+            --lane.async_mode.writers_interested_in_remove;
         }
 
         return ret_value;
@@ -1341,33 +1754,34 @@ private:
     }
 
     /*!
-     * Function run by the asynchronous thread.
+     * Function run by the asynchronous thread of a lane.
      */
-    void run()
+    void run(
+            SenderLane& lane)
     {
-        while (async_mode.running)
+        while (lane.async_mode.running)
         {
             // There are writers interested in removing a sample.
-            if (0 != async_mode.writers_interested_in_remove)
+            if (0 != lane.async_mode.writers_interested_in_remove)
             {
                 continue;
             }
 
-            std::unique_lock<fastdds::TimedMutex> lock(mutex_);
+            std::unique_lock<fastdds::TimedMutex> lock(lane.mutex);
             CacheChange_t* change_to_process = nullptr;
 
             //Check if we have to sleep.
             {
-                std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+                std::unique_lock<fastdds::TimedMutex> in_lock(lane.async_mode.changes_interested_mutex);
                 // Add interested changes into the queue.
-                sched.add_interested_changes_to_queue_nts();
+                lane.sched.add_interested_changes_to_queue_nts();
 
-                while (async_mode.running &&
-                        (async_mode.force_wait() || nullptr == (change_to_process = sched.get_next_change_nts())))
+                while (lane.async_mode.running &&
+                        (lane.async_mode.force_wait() || nullptr == (change_to_process = lane.sched.get_next_change_nts())))
                 {
                     // Release main mutex to allow registering/unregistering writers while this thread is waiting.
                     lock.unlock();
-                    bool ret = async_mode.wait(in_lock);
+                    bool ret = lane.async_mode.wait(in_lock);
 
                     in_lock.unlock();
                     lock.lock();
@@ -1375,9 +1789,9 @@ private:
 
                     if (ret)
                     {
-                        sched.trigger_bandwidth_limit_reset();
+                        lane.sched.trigger_bandwidth_limit_reset();
                     }
-                    sched.add_interested_changes_to_queue_nts();
+                    lane.sched.add_interested_changes_to_queue_nts();
                 }
             }
 
@@ -1385,15 +1799,15 @@ private:
             while (nullptr != change_to_process)
             {
                 // Fast check if next change will enter.
-                if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
+                if (!lane.async_mode.fast_check_is_there_slot_for_change(change_to_process))
                 {
                     break;
                 }
 
                 if (nullptr == current_writer || current_writer->getGuid() != change_to_process->writerGUID)
                 {
-                    auto writer_it = writers_.find(change_to_process->writerGUID);
-                    assert(writers_.end() != writer_it);
+                    auto writer_it = lane.writers.find(change_to_process->writerGUID);
+                    assert(lane.writers.end() != writer_it);
 
                     current_writer = writer_it->second;
                 }
@@ -1405,7 +1819,7 @@ private:
 
                 LocatorSelectorSender& locator_selector =
                         current_writer->get_async_locator_selector();
-                async_mode.group.sender(current_writer, &locator_selector);
+                lane.async_mode.group.sender(current_writer, &locator_selector);
                 locator_selector.lock();
 
                 // Remove previously from queue, because deliver_sample_nts could call FlowController::remove_sample()
@@ -1419,7 +1833,7 @@ private:
                 change_to_process->writer_info.is_linked.store(false);
 
                 DeliveryRetCode ret_delivery = current_writer->deliver_sample_nts(
-                    change_to_process, async_mode.group, locator_selector,
+                    change_to_process, lane.async_mode.group, locator_selector,
                     std::chrono::steady_clock::now() + std::chrono::hours(24));
 
                 if (DeliveryRetCode::DELIVERED != ret_delivery)
@@ -1431,20 +1845,20 @@ private:
                     change_to_process->writer_info.previous = previous;
                     change_to_process->writer_info.next = next;
 
-                    async_mode.process_deliver_retcode(ret_delivery);
+                    lane.async_mode.process_deliver_retcode(ret_delivery);
 
                     locator_selector.unlock();
                     current_writer->getMutex().unlock();
-                    // Unlock mutex_ and try again.
+                    // Unlock the lane's mutex and try again.
                     break;
                 }
 
                 locator_selector.unlock();
                 current_writer->getMutex().unlock();
 
-                sched.work_done();
+                lane.sched.work_done();
 
-                if (0 != async_mode.writers_interested_in_remove)
+                if (0 != lane.async_mode.writers_interested_in_remove)
                 {
                     // There are writers that want to remove samples.
                     break;
@@ -1452,46 +1866,67 @@ private:
 
                 // Add interested changes into the queue.
                 {
-                    std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
-                    sched.add_interested_changes_to_queue_nts();
+                    std::unique_lock<fastdds::TimedMutex> in_lock(lane.async_mode.changes_interested_mutex);
+                    lane.sched.add_interested_changes_to_queue_nts();
                 }
 
-                change_to_process = sched.get_next_change_nts();
+                change_to_process = lane.sched.get_next_change_nts();
             }
 
-            async_mode.group.sender(nullptr, nullptr);
+            lane.async_mode.group.sender(nullptr, nullptr);
         }
     }
 
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value ||
+            std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, void>::type
+    share_budget(
+            SenderLane& lane)
+    {
+        lane.async_mode.share_budget(lanes_.front()->async_mode);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value &&
+            !std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, void>::type
+    share_budget(
+            SenderLane&)
+    {
+        // Nothing to share without bandwidth limitation.
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
+    get_max_payload_impl()
+    {
+        // A sample can never take more tokens than the bucket holds.
+        return lanes_.front()->async_mode.max_burst_bytes;
+    }
+
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
     {
-        return static_cast<uint32_t>(async_mode.max_bytes_per_period);
+        return static_cast<uint32_t>(lanes_.front()->async_mode.max_bytes_per_period);
     }
 
     template<typename PubMode = PublishMode>
-    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value &&
+            !std::is_base_of<FlowControllerTokenBucketPublishMode, PubMode>::value, uint32_t>::type
     constexpr get_max_payload_impl() const
     {
         return (std::numeric_limits<uint32_t>::max)();
     }
 
-    fastdds::TimedMutex mutex_;
-
     RTPSParticipantImpl* participant_ = nullptr;
 
-    std::map<GUID_t, RTPSWriter*> writers_;
-
-    scheduler sched;
-
-    // async_mode must be destroyed before sched.
-    publish_mode async_mode;
+    //! One lane per sender thread. Synchronous controllers have a single lane.
+    std::vector<std::unique_ptr<SenderLane>> lanes_;
 
     uint32_t participant_id_ = 0;
     uint32_t async_index_ = 0;
 
-    //! Thread settings for the sender thread
+    //! Thread settings for the sender threads
     ThreadSettings thread_settings_;
 };
 
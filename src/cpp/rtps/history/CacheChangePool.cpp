@@ -31,6 +31,8 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+constexpr uint32_t CacheChangePool::max_spare_reservations;
+
 CacheChangePool::~CacheChangePool()
 {
     EPROSIMA_LOG_INFO(RTPS_UTILS, "ChangePool destructor");
@@ -91,7 +93,7 @@ void CacheChangePool::init(
     }
 }
 
-void CacheChangePool::return_cache_to_pool(
+void CacheChangePool::reset_change(
         CacheChange_t* ch)
 {
     ch->kind = ALIVE;
@@ -109,8 +111,6 @@ void CacheChangePool::return_cache_to_pool(
     ch->write_params.related_sample_identity(SampleIdentity::unknown());
     ch->setFragmentSize(0);
     ch->vendor_id = c_VendorId_Unknown;
-    assert(free_caches_.end() == std::find(free_caches_.begin(), free_caches_.end(), ch));
-    free_caches_.push_back(ch);
 }
 
 bool CacheChangePool::allocateGroup(
@@ -122,11 +122,12 @@ bool CacheChangePool::allocateGroup(
 
     EPROSIMA_LOG_INFO(RTPS_UTILS, "Allocating group of cache changes of size: " << group_size);
 
+    uint32_t limit = size_limit();
     uint32_t desired_size = current_pool_size_ + group_size;
-    if (desired_size > max_pool_size_)
+    if (desired_size > limit || desired_size < current_pool_size_)
     {
-        desired_size = max_pool_size_;
-        group_size = max_pool_size_ - current_pool_size_;
+        desired_size = limit;
+        group_size = limit - current_pool_size_;
     }
 
     if (group_size <= 0)
@@ -169,7 +170,7 @@ CacheChange_t* CacheChangePool::allocateSingle()
     assert(memory_mode_ == DYNAMIC_RESERVE_MEMORY_MODE ||
             memory_mode_ == DYNAMIC_REUSABLE_MEMORY_MODE);
 
-    if (current_pool_size_ < max_pool_size_)
+    if (current_pool_size_ < size_limit())
     {
         ++current_pool_size_;
         ch = create_change();
@@ -186,11 +187,19 @@ CacheChange_t* CacheChangePool::allocateSingle()
     return ch;
 }
 
+uint32_t CacheChangePool::size_limit() const
+{
+    // Saturate, as pools without a maximum size use the maximum value
+    uint32_t limit = max_pool_size_ + spare_reservations_;
+    return limit < max_pool_size_ ? max_pool_size_ : limit;
+}
+
 bool CacheChangePool::reserve_cache(
         CacheChange_t*& cache_change)
 {
     cache_change = nullptr;
 
+    std::lock_guard<std::mutex> lock(mutex_);
     if (free_caches_.empty())
     {
         switch (memory_mode_)
@@ -226,38 +235,86 @@ bool CacheChangePool::release_cache(
         case PREALLOCATED_MEMORY_MODE:
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
         case DYNAMIC_REUSABLE_MEMORY_MODE:
-            return_cache_to_pool(cache_change);
+        {
+            // The change is not reachable from the pool yet, so it is cleared before taking the lock
+            reset_change(cache_change);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            assert(free_caches_.end() == std::find(free_caches_.begin(), free_caches_.end(), cache_change));
+            free_caches_.push_back(cache_change);
             break;
+        }
 
         case DYNAMIC_RESERVE_MEMORY_MODE:
-            // Find pointer in CacheChange vector, remove element, then delete it
-            std::vector<CacheChange_t*>::iterator target =
-                    std::find(all_caches_.begin(), all_caches_.end(), cache_change);
-            if (target != all_caches_.end())
+        {
             {
-                // Copy last element into the element being removed
-                if (target != --all_caches_.end())
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                // Find pointer in CacheChange vector, remove element, then delete it
+                std::vector<CacheChange_t*>::iterator target =
+                        std::find(all_caches_.begin(), all_caches_.end(), cache_change);
+                if (target != all_caches_.end())
                 {
-                    *target = std::move(all_caches_.back());
+                    // Copy last element into the element being removed
+                    if (target != --all_caches_.end())
+                    {
+                        *target = std::move(all_caches_.back());
+                    }
+
+                    // Then drop last element
+                    all_caches_.pop_back();
+                }
+                else
+                {
+                    EPROSIMA_LOG_INFO(RTPS_UTILS, "Tried to release a CacheChange that is not logged in the Pool");
+                    return false;
                 }
 
-                // Then drop last element
-                all_caches_.pop_back();
-            }
-            else
-            {
-                EPROSIMA_LOG_INFO(RTPS_UTILS, "Tried to release a CacheChange that is not logged in the Pool");
-                return false;
+                --current_pool_size_;
             }
 
             destroy_change(cache_change);
-            --current_pool_size_;
             break;
+        }
+    }
+
+    return true;
+}
+
+bool CacheChangePool::reserve_spare_cache(
+        CacheChange_t*& cache_change)
+{
+    cache_change = nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_caches_.empty() || max_spare_reservations <= spare_reservations_)
+    {
+        return false;
     }
 
+    spare_reservations_.fetch_add(1u);
+    cache_change = free_caches_.back();
+    free_caches_.pop_back();
     return true;
 }
 
+void CacheChangePool::keep_spare_cache(
+        CacheChange_t* cache_change)
+{
+    static_cast<void>(cache_change);
+
+    uint32_t previous_reservations = spare_reservations_.fetch_sub(1u);
+    static_cast<void>(previous_reservations);
+    assert(0 < previous_reservations);
+}
+
+void CacheChangePool::release_spare_cache(
+        CacheChange_t* cache_change)
+{
+    keep_spare_cache(cache_change);
+    release_cache(cache_change);
+}
+
 } /* namespace rtps */
 } /* namespace fastdds */
 } /* namespace eprosima */
@@ -27,8 +27,10 @@
 
 #include <vector>
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <mutex>
 
 namespace eprosima {
 namespace fastdds {
@@ -37,6 +39,10 @@ namespace rtps {
 /**
  * Class CacheChangePool, used by the HistoryCache to pre-reserve a number of CacheChange_t to avoid dynamically
  * reserving memory in the middle of execution loops.
+ *
+ * The pool is guarded by its own mutex, held only while its lists are modified, so changes can be reserved and
+ * released without holding the mutex of the history or endpoint using it. Readers use reserve_spare_cache to reserve
+ * the change for a received sample before taking their own mutex.
  * @ingroup COMMON_MODULE
  */
 class CacheChangePool : public IChangePool
@@ -77,15 +83,52 @@ public:
     bool release_cache(
             CacheChange_t* cache_change) override;
 
+    /**
+     * Reserve a free change for a sample which may still be rejected, before taking the mutex of the endpoint.
+     *
+     * Only changes already on the free list are handed out, and at most @c max_spare_reservations are outstanding.
+     * The pool may grow over its maximum size by the number of outstanding spare changes, so they never make
+     * reserve_cache fail.
+     *
+     * @param [out] cache_change   Pointer to the reserved change.
+     *
+     * @return Whether a change was reserved.
+     */
+    bool reserve_spare_cache(
+            CacheChange_t*& cache_change);
+
+    /**
+     * Keep a change obtained from reserve_spare_cache for an accepted sample.
+     * From then on it is like any change obtained from reserve_cache, and it is returned with release_cache.
+     * It does not take the mutex of the pool, so it can be called while holding the mutex of the endpoint.
+     *
+     * @param [in] cache_change   Pointer to the spare change.
+     */
+    void keep_spare_cache(
+            CacheChange_t* cache_change);
+
+    /**
+     * Return a change obtained from reserve_spare_cache which was not used.
+     *
+     * @param [in] cache_change   Pointer to the spare change.
+     */
+    void release_spare_cache(
+            CacheChange_t* cache_change);
+
+    //! Maximum number of changes obtained from reserve_spare_cache which may be outstanding at once.
+    static constexpr uint32_t max_spare_reservations = 8u;
+
     //!Get the size of the cache vector; all of them (reserved and not reserved).
     size_t get_allCachesSize()
     {
+        std::lock_guard<std::mutex> lock(mutex_);
         return all_caches_.size();
     }
 
     //!Get the number of free caches.
     size_t get_freeCachesSize()
     {
+        std::lock_guard<std::mutex> lock(mutex_);
         return free_caches_.size();
     }
 
@@ -116,16 +159,25 @@ private:
     uint32_t max_pool_size_ = 0;
     MemoryManagementPolicy_t memory_mode_ = MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
 
+    //! Number of outstanding changes obtained from reserve_spare_cache. Only increased with the mutex taken.
+    std::atomic<uint32_t> spare_reservations_{0};
+
     std::vector<CacheChange_t*> free_caches_;
     std::vector<CacheChange_t*> all_caches_;
 
+    //! Guards the lists and sizes of the pool.
+    std::mutex mutex_;
+
     bool allocateGroup(
             uint32_t num_caches);
 
     CacheChange_t* allocateSingle();
 
-    //! Returns a CacheChange to the free caches pool
-    void return_cache_to_pool(
+    //! Maximum number of changes, which allows for the outstanding spare changes over the configured one.
+    uint32_t size_limit() const;
+
+    //! Clears the fields of a CacheChange which is going to be returned to the pool
+    static void reset_change(
             CacheChange_t* ch);
 
 };
@@ -24,12 +24,40 @@
 #include "./TopicPayloadPool_impl/Dynamic.hpp"
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+namespace {
+
+//! Maximum number of shards of free payloads of a pool
+constexpr size_t max_shards = 16;
+
+//! Index of the calling thread, used to choose its shard on every pool
+size_t thread_index()
+{
+    static std::atomic<size_t> next_thread_index {0};
+    thread_local size_t index = next_thread_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace
+
+TopicPayloadPool::TopicPayloadPool()
+{
+    // One shard per hardware thread, rounded down to a power of two
+    size_t hardware_threads = std::thread::hardware_concurrency();
+    while (shards_count_ * 2 <= hardware_threads && shards_count_ < max_shards)
+    {
+        shards_count_ *= 2;
+    }
+    shards_.reset(new Shard[shards_count_]);
+}
+
 bool TopicPayloadPool::get_payload(
         uint32_t size,
         SerializedPayload_t& payload)
@@ -43,34 +71,53 @@ bool TopicPayloadPool::do_get_payload(
         bool resizeable)
 {
     PayloadNode* payload_node = nullptr;
+    Shard& shard = own_shard();
+    bool reuses = reuses_payloads();
+
+    if (reuses && 0 != shard.free_count.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        payload_node = shard.pop();
+    }
+
+    if (reuses && payload_node == nullptr)
+    {
+        payload_node = refill(shard);
+    }
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    if (payload_node == nullptr)
     {
-        payload_node = allocate(size); //Allocates a single payload
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Some payload may have been released since the shards were visited
+        if (reuses)
+        {
+            payload_node = pop_any_free_payload();
+        }
         if (payload_node == nullptr)
         {
-            lock.unlock();
-            payload.data = nullptr;
-            payload.max_size = 0;
-            payload.payload_owner = nullptr;
-            return false;
+            payload_node = allocate(size); //Allocates a single payload
         }
     }
-    else
+
+    if (payload_node == nullptr)
     {
-        payload_node = free_payloads_.back();
-        free_payloads_.pop_back();
+        payload.data = nullptr;
+        payload.max_size = 0;
+        payload.payload_owner = nullptr;
+        return false;
     }
 
-    // Resize if needed
+    // Resize if needed. The node is not reachable from the free lists, so no lock is needed.
     if (resizeable && size > payload_node->data_size())
     {
         if (!payload_node->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload_node);
-            lock.unlock();
+            {
+                std::lock_guard<std::mutex> shard_lock(shard.mutex);
+                shard.push(payload_node);
+            }
             EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Failed to resize the payload");
 
             payload.data = nullptr;
@@ -80,7 +127,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload_node->reference();
     payload.data = payload_node->data();
     payload.max_size = payload_node->data_size();
@@ -127,9 +173,9 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(payload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload_node = all_payloads_.at(PayloadNode::data_index(payload.data));
-        free_payloads_.push_back(payload_node);
+        Shard& shard = own_shard();
+        std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        shard.push(PayloadNode::node(payload.data));
     }
 
     payload.length = 0;
@@ -243,7 +289,7 @@ void TopicPayloadPool::reserve (
 
         if (payload != nullptr)
         {
-            free_payloads_.push_back(payload);
+            push_free_payload(payload);
         }
     }
 }
@@ -255,8 +301,11 @@ bool TopicPayloadPool::shrink (
 
     while (max_num_payloads < all_payloads_.size())
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
+        PayloadNode* payload = pop_any_free_payload();
+        if (payload == nullptr)
+        {
+            return false;
+        }
 
         // Find data in allPayloads, remove element, then delete it
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
@@ -268,6 +317,76 @@ bool TopicPayloadPool::shrink (
     return true;
 }
 
+TopicPayloadPool::Shard& TopicPayloadPool::own_shard()
+{
+    return shards_[thread_index() & (shards_count_ - 1)];
+}
+
+void TopicPayloadPool::push_free_payload(
+        PayloadNode* payload)
+{
+    Shard& shard = shards_[next_shard_++ & (shards_count_ - 1)];
+    std::lock_guard<std::mutex> shard_lock(shard.mutex);
+    shard.push(payload);
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::refill(
+        Shard& shard)
+{
+    size_t shard_index = static_cast<size_t>(&shard - shards_.get());
+
+    for (size_t i = 1; i < shards_count_; ++i)
+    {
+        // Both shards are locked at once, so the moved payloads are always reachable by the rest of threads
+        Shard& other = shards_[(shard_index + i) & (shards_count_ - 1)];
+        if (0 == other.free_count.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        std::lock(shard.mutex, other.mutex);
+        std::lock_guard<std::mutex> shard_lock(shard.mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> other_lock(other.mutex, std::adopt_lock);
+
+        PayloadNode* payload = other.pop();
+        if (payload != nullptr)
+        {
+            size_t count = other.free_payloads.size() / 2;
+            shard.free_payloads.insert(shard.free_payloads.end(), other.free_payloads.end() - count,
+                    other.free_payloads.end());
+            other.free_payloads.resize(other.free_payloads.size() - count);
+            shard.free_count.store(shard.free_payloads.size(), std::memory_order_relaxed);
+            other.free_count.store(other.free_payloads.size(), std::memory_order_relaxed);
+            return payload;
+        }
+    }
+
+    return nullptr;
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::pop_any_free_payload()
+{
+    // Locking the shards one at a time could miss a payload that a refill moves from a shard not visited yet to
+    // one already visited, making a preallocated pool fail with free payloads in it.
+    for (size_t i = 0; i < shards_count_; ++i)
+    {
+        shards_[i].mutex.lock();
+    }
+
+    PayloadNode* payload = nullptr;
+    for (size_t i = 0; i < shards_count_ && payload == nullptr; ++i)
+    {
+        payload = shards_[i].pop();
+    }
+
+    for (size_t i = 0; i < shards_count_; ++i)
+    {
+        shards_[i].mutex.unlock();
+    }
+
+    return payload;
+}
+
 std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         const BasicPoolConfig& config)
 {
@@ -42,7 +42,7 @@ class TopicPayloadPool : public ITopicPayloadPool
 
 public:
 
-    TopicPayloadPool() = default;
+    TopicPayloadPool();
 
     virtual ~TopicPayloadPool()
     {
@@ -124,7 +124,13 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        size_t available = 0;
+        for (size_t i = 0; i < shards_count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            available += shards_[i].free_payloads.size();
+        }
+        return available;
     }
 
     static std::unique_ptr<ITopicPayloadPool> get(
@@ -157,6 +163,7 @@ protected:
 
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
+            info().node = this;
             data_size(size);
         }
 
@@ -222,6 +229,12 @@ protected:
             return info().data;
         }
 
+        static PayloadNode* node(
+                octet* data)
+        {
+            return info(data).node;
+        }
+
         void reference()
         {
             info().ref_counter.fetch_add(1, std::memory_order_relaxed);
@@ -251,6 +264,7 @@ protected:
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
             uint32_t data_index = 0;
+            PayloadNode* node = nullptr;
             octet data[1];
         };
 
@@ -351,13 +365,97 @@ protected:
 
     virtual MemoryManagementPolicy_t memory_policy() const = 0;
 
+    /**
+     * Free list of payloads, guarded by its own mutex.
+     *
+     * Free payloads are spread over several shards, so threads getting and releasing payloads of the same topic
+     * at the same time do not contend on a single mutex.
+     * Each thread works on its own shard, and refills it from the rest when it runs out of free payloads.
+     */
+    struct Shard
+    {
+        //! Adds a free payload. @pre @c mutex is locked.
+        void push(
+                PayloadNode* payload)
+        {
+            free_payloads.push_back(payload);
+            free_count.store(free_payloads.size(), std::memory_order_relaxed);
+        }
+
+        //! Takes the last free payload, or nullptr if there are none. @pre @c mutex is locked.
+        PayloadNode* pop()
+        {
+            if (free_payloads.empty())
+            {
+                return nullptr;
+            }
+
+            PayloadNode* payload = free_payloads.back();
+            free_payloads.pop_back();
+            free_count.store(free_payloads.size(), std::memory_order_relaxed);
+            return payload;
+        }
+
+        mutable std::mutex mutex;
+        std::vector<PayloadNode*> free_payloads;
+        /**
+         * Size of @c free_payloads, readable without locking @c mutex.
+         * It is only a hint to skip locking empty shards: decisions that must see every free payload are taken
+         * with the shards locked.
+         */
+        std::atomic<size_t> free_count{0};
+        //! Keeps the mutexes of consecutive shards on different cache lines.
+        char padding[64];
+    };
+
+    //! Shard of the calling thread.
+    Shard& own_shard();
+
+    /**
+     * Adds a free payload to the shards, spreading them evenly.
+     *
+     * @pre @c mutex_ is locked.
+     */
+    void push_free_payload(
+            PayloadNode* payload);
+
+    /**
+     * Takes a free payload from the first of the rest of shards which has any, moving half of its remaining free
+     * payloads to @c shard at once, so the next calls find them on @c shard.
+     *
+     * @return The free payload taken, or nullptr if there were none.
+     */
+    PayloadNode* refill(
+            Shard& shard);
+
+    //! Whether released payloads are kept for reuse. Otherwise the shards are always empty and are not visited.
+    bool reuses_payloads() const
+    {
+        return DYNAMIC_RESERVE_MEMORY_MODE != memory_policy();
+    }
+
+    /**
+     * Takes any free payload from the shards.
+     *
+     * All the shards are locked before looking at any of them, so a payload moved between shards by a concurrent
+     * @c refill cannot be missed.
+     *
+     * @pre @c mutex_ is locked.
+     * @return The free payload, or nullptr if there are no free payloads.
+     */
+    PayloadNode* pop_any_free_payload();
+
     uint32_t max_pool_size_             = 0;  //< Maximum size of the pool
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
+    std::unique_ptr<Shard[]> shards_;         //< Payloads that are free, spread over several shards
+    size_t shards_count_                = 1;  //< Number of shards, always a power of two
+    size_t next_shard_                  = 0;  //< Next shard where a reserved payload is added
+
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
+    //! Guards all_payloads_ and the sizes of the pool. When both are needed, it is locked before any shard.
     std::mutex mutex_;
 
 };
@@ -52,16 +52,8 @@ MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
     : participant_(participant)
-    , source_version_(c_ProtocolVersion)
-    , source_vendor_id_(c_VendorId_Unknown)
-    , source_guid_prefix_(c_GuidPrefix_Unknown)
-    , dest_guid_prefix_(c_GuidPrefix_Unknown)
-    , have_timestamp_(false)
-    , timestamp_(c_TimeInvalid)
 #if HAVE_SECURITY
-    , crypto_msg_(participant->is_secure() ? rec_buffer_size : 0)
-    , crypto_submsg_(participant->is_secure() ? rec_buffer_size : 0)
-    , crypto_payload_(participant->is_secure() ? rec_buffer_size : 0)
+    , crypto_buffer_size_(participant->is_secure() ? rec_buffer_size : 0)
 #endif // if HAVE_SECURITY
 {
     (void)rec_buffer_size;
@@ -75,7 +67,8 @@ MessageReceiver::MessageReceiver(
             this,
             std::placeholders::_1,
             std::placeholders::_2,
-            std::placeholders::_3);
+            std::placeholders::_3,
+            std::placeholders::_4);
 
         process_data_fragment_message_function_ = std::bind(
             &MessageReceiver::process_data_fragment_message_with_security,
@@ -85,7 +78,8 @@ MessageReceiver::MessageReceiver(
             std::placeholders::_3,
             std::placeholders::_4,
             std::placeholders::_5,
-            std::placeholders::_6);
+            std::placeholders::_6,
+            std::placeholders::_7);
     }
     else
     {
@@ -95,7 +89,8 @@ MessageReceiver::MessageReceiver(
         this,
         std::placeholders::_1,
         std::placeholders::_2,
-        std::placeholders::_3);
+        std::placeholders::_3,
+        std::placeholders::_4);
 
     process_data_fragment_message_function_ = std::bind(
         &MessageReceiver::process_data_fragment_message_without_security,
@@ -105,7 +100,8 @@ MessageReceiver::MessageReceiver(
         std::placeholders::_3,
         std::placeholders::_4,
         std::placeholders::_5,
-        std::placeholders::_6);
+        std::placeholders::_6,
+        std::placeholders::_7);
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
@@ -119,13 +115,63 @@ MessageReceiver::~MessageReceiver()
     assert(associated_readers_.empty());
 }
 
+MessageReceiver::ReceptionContext::ReceptionContext(
+        uint32_t crypto_buffer_size)
+#if HAVE_SECURITY
+    : crypto_msg(crypto_buffer_size)
+    , crypto_submsg(crypto_buffer_size)
+    , crypto_payload(crypto_buffer_size)
+#endif // if HAVE_SECURITY
+{
+    static_cast<void>(crypto_buffer_size);
+    reset();
+}
+
+void MessageReceiver::ReceptionContext::reset()
+{
+    source_version = c_ProtocolVersion;
+    source_vendor_id = c_VendorId_Unknown;
+    source_guid_prefix = c_GuidPrefix_Unknown;
+    dest_guid_prefix = c_GuidPrefix_Unknown;
+    have_timestamp = false;
+    timestamp = c_TimeInvalid;
+}
+
+MessageReceiver::ReceptionContext* MessageReceiver::acquire_context()
+{
+    {
+        std::lock_guard<std::mutex> guard(contexts_mtx_);
+        if (!free_contexts_.empty())
+        {
+            ReceptionContext* context = free_contexts_.back().release();
+            free_contexts_.pop_back();
+            return context;
+        }
+    }
+
+    // First time this many messages are processed concurrently
+#if HAVE_SECURITY
+    return new ReceptionContext(crypto_buffer_size_);
+#else
+    return new ReceptionContext(0);
+#endif // if HAVE_SECURITY
+}
+
+void MessageReceiver::release_context(
+        ReceptionContext* context)
+{
+    std::lock_guard<std::mutex> guard(contexts_mtx_);
+    free_contexts_.emplace_back(context);
+}
+
  #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 void MessageReceiver::process_data_message_with_security(
+        ReceptionContext& context,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         bool was_decoded)
 {
-    auto process_message = [was_decoded, &change, this](BaseReader* reader)
+    auto process_message = [was_decoded, &change, &context, this](BaseReader* reader)
             {
                 if (!was_decoded && reader->getAttributes().security_attributes().is_submessage_protected)
                 {
@@ -144,13 +190,13 @@ void MessageReceiver::process_data_message_with_security(
                 }
 
                 if (!participant_->security_manager().decode_serialized_payload(change.serializedPayload,
-                        crypto_payload_, reader->getGuid(), change.writerGUID))
+                        context.crypto_payload, reader->getGuid(), change.writerGUID))
                 {
                     return;
                 }
 
-                std::swap(change.serializedPayload.data, crypto_payload_.data);
-                std::swap(change.serializedPayload.length, crypto_payload_.length);
+                std::swap(change.serializedPayload.data, context.crypto_payload.data);
+                std::swap(change.serializedPayload.length, context.crypto_payload.length);
 
                 octet* original_payload_data = change.serializedPayload.data;
                 uint32_t original_payload_length = change.serializedPayload.length;
@@ -162,14 +208,15 @@ void MessageReceiver::process_data_message_with_security(
                     change.serializedPayload.data = original_payload_data;
                     change.serializedPayload.length = original_payload_length;
                 }
-                std::swap(change.serializedPayload.data, crypto_payload_.data);
-                std::swap(change.serializedPayload.length, crypto_payload_.length);
+                std::swap(change.serializedPayload.data, context.crypto_payload.data);
+                std::swap(change.serializedPayload.length, context.crypto_payload.length);
             };
 
     findAllReaders(reader_id, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_with_security(
+        ReceptionContext& context,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         uint32_t sample_size,
@@ -177,7 +224,8 @@ void MessageReceiver::process_data_fragment_message_with_security(
         uint16_t fragments_in_submessage,
         bool was_decoded)
 {
-    auto process_message = [was_decoded, &change, sample_size, fragment_starting_num, fragments_in_submessage, this](
+    auto process_message = [was_decoded, &change, &context, sample_size, fragment_starting_num,
+                    fragments_in_submessage, this](
         BaseReader* reader)
             {
                 if (!was_decoded && reader->getAttributes().security_attributes().is_submessage_protected)
@@ -197,16 +245,16 @@ void MessageReceiver::process_data_fragment_message_with_security(
                 }
 
                 if (!participant_->security_manager().decode_serialized_payload(change.serializedPayload,
-                        crypto_payload_, reader->getGuid(), change.writerGUID))
+                        context.crypto_payload, reader->getGuid(), change.writerGUID))
                 {
                     return;
                 }
 
-                std::swap(change.serializedPayload.data, crypto_payload_.data);
-                std::swap(change.serializedPayload.length, crypto_payload_.length);
+                std::swap(change.serializedPayload.data, context.crypto_payload.data);
+                std::swap(change.serializedPayload.length, context.crypto_payload.length);
                 reader->process_data_frag_msg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
-                std::swap(change.serializedPayload.data, crypto_payload_.data);
-                std::swap(change.serializedPayload.length, crypto_payload_.length);
+                std::swap(change.serializedPayload.data, context.crypto_payload.data);
+                std::swap(change.serializedPayload.length, context.crypto_payload.length);
             };
 
     findAllReaders(reader_id, process_message);
@@ -215,6 +263,7 @@ void MessageReceiver::process_data_fragment_message_with_security(
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
 void MessageReceiver::process_data_message_without_security(
+        ReceptionContext& /*context*/,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         bool /*was_decoded*/)
@@ -228,6 +277,7 @@ void MessageReceiver::process_data_message_without_security(
 }
 
 void MessageReceiver::process_data_fragment_message_without_security(
+        ReceptionContext& /*context*/,
         const EntityId_t& reader_id,
         CacheChange_t& change,
         uint32_t sample_size,
@@ -327,16 +377,6 @@ void MessageReceiver::removeEndpoint(
     }
 }
 
-void MessageReceiver::reset()
-{
-    source_version_ = c_ProtocolVersion;
-    source_vendor_id_ = c_VendorId_Unknown;
-    source_guid_prefix_ = c_GuidPrefix_Unknown;
-    dest_guid_prefix_ = c_GuidPrefix_Unknown;
-    have_timestamp_ = false;
-    timestamp_ = c_TimeInvalid;
-}
-
 void MessageReceiver::processCDRMsg(
         const Locator_t& source_locator,
         const Locator_t& reception_locator,
@@ -348,6 +388,17 @@ void MessageReceiver::processCDRMsg(
         return;
     }
 
+    ReceptionContext* context = acquire_context();
+    process_message(*context, source_locator, reception_locator, msg);
+    release_context(context);
+}
+
+void MessageReceiver::process_message(
+        ReceptionContext& context,
+        const Locator_t& source_locator,
+        const Locator_t& reception_locator,
+        CDRMessage_t* msg)
+{
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     GuidPrefix_t participantGuidPrefix;
 #else
@@ -356,54 +407,50 @@ void MessageReceiver::processCDRMsg(
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
     security::SecurityManager& security = participant_->security_manager();
-    CDRMessage_t* auxiliary_buffer = &crypto_msg_;
+    CDRMessage_t* auxiliary_buffer = &context.crypto_msg;
     int decode_ret = 0;
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
     bool ignore_submessages = false;
 
-    {
-        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
-        reset();
+    context.reset();
 
-        dest_guid_prefix_ = participantGuidPrefix;
+    context.dest_guid_prefix = participantGuidPrefix;
 
-        msg->pos = 0; //Start reading at 0
+    msg->pos = 0; //Start reading at 0
 
-        //Once everything is set, the reading begins:
-        if (!checkRTPSHeader(msg))
-        {
-            return;
-        }
+    //Once everything is set, the reading begins:
+    if (!checkRTPSHeader(context, msg))
+    {
+        return;
+    }
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+    ignore_submessages = participant_->is_participant_ignored(context.source_guid_prefix);
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
-        if (!ignore_submessages)
-        {
-            notify_network_statistics(source_locator, reception_locator, msg);
-        }
+    if (!ignore_submessages)
+    {
+        notify_network_statistics(context, source_locator, reception_locator, msg);
+    }
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, source_guid_prefix_);
+    decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, context.source_guid_prefix);
 
-        if (decode_ret < 0)
-        {
-            return;
-        }
+    if (decode_ret < 0)
+    {
+        return;
+    }
 
-        if (decode_ret == 0)
-        {
-            // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
-            // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
-            // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
-            msg = auxiliary_buffer;
-            auxiliary_buffer = &crypto_submsg_;
-        }
-#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    if (decode_ret == 0)
+    {
+        // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg.
+        // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg.
+        // This way each decoded sub-message will be processed using the crypto_submsg buffer.
+        msg = auxiliary_buffer;
+        auxiliary_buffer = &context.crypto_submsg;
     }
+#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
     // Loop until there are no more submessages
     // Each submessage processing method choses the lock kind required
@@ -417,7 +464,7 @@ void MessageReceiver::processCDRMsg(
         bool current_message_was_decoded = false;
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        decode_ret = security.decode_rtps_submessage(*msg, *auxiliary_buffer, source_guid_prefix_);
+        decode_ret = security.decode_rtps_submessage(*msg, *auxiliary_buffer, context.source_guid_prefix);
 
         if (decode_ret < 0)
         {
@@ -451,7 +498,7 @@ void MessageReceiver::processCDRMsg(
             {
                 case DATA:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Data Submsg ignored, DST is another RTPSParticipant");
                     }
@@ -459,11 +506,12 @@ void MessageReceiver::processCDRMsg(
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Data Submsg received, processing.");
                         EntityId_t writerId = c_EntityId_Unknown;
-                        valid = proc_Submsg_Data(submessage, &submsgh, writerId, current_message_was_decoded);
+                        valid = proc_Submsg_Data(context, submessage, &submsgh, writerId,
+                                current_message_was_decoded);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
                         if (valid && writerId == c_EntityId_SPDPWriter)
                         {
-                            ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+                            ignore_submessages = participant_->is_participant_ignored(context.source_guid_prefix);
                         }
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
@@ -471,7 +519,7 @@ void MessageReceiver::processCDRMsg(
                     break;
                 }
                 case DATA_FRAG:
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "DataFrag Submsg ignored, DST is another RTPSParticipant");
@@ -479,12 +527,12 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DataFrag Submsg received, processing.");
-                        valid = proc_Submsg_DataFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_DataFrag(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 case GAP:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "Gap Submsg ignored, DST is another RTPSParticipant...");
@@ -492,13 +540,13 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Gap Submsg received, processing...");
-                        valid = proc_Submsg_Gap(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Gap(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 }
                 case ACKNACK:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "Acknack Submsg ignored, DST is another RTPSParticipant...");
@@ -506,13 +554,13 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack Submsg received, processing...");
-                        valid = proc_Submsg_Acknack(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Acknack(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 }
                 case NACK_FRAG:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "NackFrag Submsg ignored, DST is another RTPSParticipant...");
@@ -520,26 +568,26 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "NackFrag Submsg received, processing...");
-                        valid = proc_Submsg_NackFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_NackFrag(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 }
                 case HEARTBEAT:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "HB Submsg ignored, DST is another RTPSParticipant...");
                     }
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Heartbeat Submsg received, processing...");
-                        valid = proc_Submsg_Heartbeat(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_Heartbeat(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 }
                 case HEARTBEAT_FRAG:
                 {
-                    if (dest_guid_prefix_ != participantGuidPrefix)
+                    if (context.dest_guid_prefix != participantGuidPrefix)
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN,
                                 IDSTRING "HBFrag Submsg ignored, DST is another RTPSParticipant...");
@@ -547,7 +595,7 @@ void MessageReceiver::processCDRMsg(
                     else
                     {
                         EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "HeartbeatFrag Submsg received, processing...");
-                        valid = proc_Submsg_HeartbeatFrag(submessage, &submsgh, current_message_was_decoded);
+                        valid = proc_Submsg_HeartbeatFrag(context, submessage, &submsgh, current_message_was_decoded);
                     }
                     break;
                 }
@@ -556,19 +604,19 @@ void MessageReceiver::processCDRMsg(
                     break;
                 case INFO_DST:
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoDST message received, processing...");
-                    valid = proc_Submsg_InfoDST(submessage, &submsgh);
+                    valid = proc_Submsg_InfoDST(context, submessage, &submsgh);
                     break;
                 case INFO_SRC:
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoSRC message received, processing...");
-                    valid = proc_Submsg_InfoSRC(submessage, &submsgh);
+                    valid = proc_Submsg_InfoSRC(context, submessage, &submsgh);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-                    ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+                    ignore_submessages = participant_->is_participant_ignored(context.source_guid_prefix);
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
                     break;
                 case INFO_TS:
                 {
                     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "InfoTS Submsg received, processing...");
-                    valid = proc_Submsg_InfoTS(submessage, &submsgh);
+                    valid = proc_Submsg_InfoTS(context, submessage, &submsgh);
                     break;
                 }
                 case INFO_REPLY:
@@ -588,11 +636,12 @@ void MessageReceiver::processCDRMsg(
     }
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-    participant_->assert_remote_participant_liveliness(source_guid_prefix_);
+    participant_->assert_remote_participant_liveliness(context.source_guid_prefix);
 #endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
 bool MessageReceiver::checkRTPSHeader(
+        ReceptionContext& context,
         CDRMessage_t* msg)
 {
     //check and proccess the RTPS Header
@@ -608,9 +657,9 @@ bool MessageReceiver::checkRTPSHeader(
     //CHECK AND SET protocol version
     if (msg->buffer[msg->pos] == c_ProtocolVersion.m_major)
     {
-        source_version_.m_major = msg->buffer[msg->pos];
+        context.source_version.m_major = msg->buffer[msg->pos];
         msg->pos++;
-        source_version_.m_minor = msg->buffer[msg->pos];
+        context.source_version.m_minor = msg->buffer[msg->pos];
         msg->pos++;
     }
     else
@@ -620,13 +669,13 @@ bool MessageReceiver::checkRTPSHeader(
     }
 
     //Set source vendor id
-    source_vendor_id_[0] = msg->buffer[msg->pos];
+    context.source_vendor_id[0] = msg->buffer[msg->pos];
     msg->pos++;
-    source_vendor_id_[1] = msg->buffer[msg->pos];
+    context.source_vendor_id[1] = msg->buffer[msg->pos];
     msg->pos++;
     //set source guid prefix
-    CDRMessage::readData(msg, source_guid_prefix_.value, GuidPrefix_t::size);
-    have_timestamp_ = false;
+    CDRMessage::readData(msg, context.source_guid_prefix.value, GuidPrefix_t::size);
+    context.have_timestamp = false;
     return true;
 }
 
@@ -736,6 +785,7 @@ void MessageReceiver::findAllReaders(
 }
 
 bool MessageReceiver::proc_Submsg_Data(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         EntityId_t& writerID,
@@ -792,7 +842,7 @@ bool MessageReceiver::proc_Submsg_Data(
     //We ask the reader for a cachechange to store the information.
     CacheChange_t ch;
     ch.kind = ALIVE;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    ch.writerGUID.guidPrefix = context.source_guid_prefix;
     valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     writerID = ch.writerGUID.entityId;
@@ -900,16 +950,16 @@ bool MessageReceiver::proc_Submsg_Data(
     }
 
     // Set sourcetimestamp
-    if (have_timestamp_)
+    if (context.have_timestamp)
     {
-        ch.sourceTimestamp = timestamp_;
+        ch.sourceTimestamp = context.timestamp;
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible Reader entities: " <<
             associated_readers_.size());
 
     //Look for the correct reader to add the change
-    process_data_message_function_(readerID, ch, was_decoded);
+    process_data_message_function_(context, readerID, ch, was_decoded);
 
     IPayloadPool* payload_pool = ch.serializedPayload.payload_owner;
     if (payload_pool)
@@ -926,6 +976,7 @@ bool MessageReceiver::proc_Submsg_Data(
 }
 
 bool MessageReceiver::proc_Submsg_DataFrag(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -975,7 +1026,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     //FOUND THE READER.
     //We ask the reader for a cachechange to store the information.
     CacheChange_t ch;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    ch.writerGUID.guidPrefix = context.source_guid_prefix;
     valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     //Get sequence number
@@ -1087,15 +1138,15 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     }
 
     // Set sourcetimestamp
-    if (have_timestamp_)
+    if (context.have_timestamp)
     {
-        ch.sourceTimestamp = timestamp_;
+        ch.sourceTimestamp = context.timestamp;
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible Reader entities: " <<
             associated_readers_.size());
-    process_data_fragment_message_function_(readerID, ch, sampleSize, fragmentStartingNum, fragmentsInSubmessage,
-            was_decoded);
+    process_data_fragment_message_function_(context, readerID, ch, sampleSize, fragmentStartingNum,
+            fragmentsInSubmessage, was_decoded);
     ch.serializedPayload.data = nullptr;
     ch.inline_qos.data = nullptr;
 
@@ -1105,6 +1156,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
 }
 
 bool MessageReceiver::proc_Submsg_Heartbeat(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -1126,9 +1178,9 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = dest_guid_prefix_;
+    readerGUID.guidPrefix = context.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.guidPrefix = context.source_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
     SequenceNumber_t firstSN;
     SequenceNumber_t lastSN;
@@ -1156,7 +1208,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 
     //Look for the correct reader and writers:
     findAllReaders(readerGUID.entityId,
-            [was_decoded, &writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag, this](
+            [was_decoded, &writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag, &context, this](
                 BaseReader* reader)
             {
                 // Only used when HAVE_SECURITY is defined
@@ -1166,7 +1218,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 #endif  // HAVE_SECURITY
                 {
                     reader->process_heartbeat_msg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag,
-                    source_vendor_id_);
+                    context.source_vendor_id);
                 }
             });
 
@@ -1174,6 +1226,7 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
 }
 
 bool MessageReceiver::proc_Submsg_Acknack(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -1196,9 +1249,9 @@ bool MessageReceiver::proc_Submsg_Acknack(
     }
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = source_guid_prefix_;
+    readerGUID.guidPrefix = context.source_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = dest_guid_prefix_;
+    writerGUID.guidPrefix = context.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
 
     SequenceNumberSet_t SNSet = CDRMessage::readSequenceNumberSet(msg);
@@ -1217,7 +1270,8 @@ bool MessageReceiver::proc_Submsg_Acknack(
 #endif  // HAVE_SECURITY
         {
             bool result;
-            if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result, source_vendor_id_))
+            if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result,
+                    context.source_vendor_id))
             {
                 if (!result)
                 {
@@ -1233,6 +1287,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
 }
 
 bool MessageReceiver::proc_Submsg_Gap(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -1252,9 +1307,9 @@ bool MessageReceiver::proc_Submsg_Gap(
 
     GUID_t writerGUID;
     GUID_t readerGUID;
-    readerGUID.guidPrefix = dest_guid_prefix_;
+    readerGUID.guidPrefix = context.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = source_guid_prefix_;
+    writerGUID.guidPrefix = context.source_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
     SequenceNumber_t gapStart;
     CDRMessage::readSequenceNumber(msg, &gapStart);
@@ -1265,7 +1320,7 @@ bool MessageReceiver::proc_Submsg_Gap(
     }
 
     findAllReaders(readerGUID.entityId,
-            [was_decoded, &writerGUID, &gapStart, &gapList, this](BaseReader* reader)
+            [was_decoded, &writerGUID, &gapStart, &gapList, &context, this](BaseReader* reader)
             {
                 // Only used when HAVE_SECURITY is defined
                 static_cast<void>(was_decoded);
@@ -1273,7 +1328,7 @@ bool MessageReceiver::proc_Submsg_Gap(
                 if (was_decoded || !reader->getAttributes().security_attributes().is_submessage_protected)
 #endif  // HAVE_SECURITY
                 {
-                    reader->process_gap_msg(writerGUID, gapStart, gapList, source_vendor_id_);
+                    reader->process_gap_msg(writerGUID, gapStart, gapList, context.source_vendor_id);
                 }
             });
 
@@ -1281,11 +1336,10 @@ bool MessageReceiver::proc_Submsg_Gap(
 }
 
 bool MessageReceiver::proc_Submsg_InfoTS(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool timeFlag = (smh->flags & BIT(1)) != 0;
     //Assign message endianness
@@ -1299,23 +1353,22 @@ bool MessageReceiver::proc_Submsg_InfoTS(
     }
     if (!timeFlag)
     {
-        have_timestamp_ = true;
-        CDRMessage::readTimestamp(msg, &timestamp_);
+        context.have_timestamp = true;
+        CDRMessage::readTimestamp(msg, &context.timestamp);
     }
     else
     {
-        have_timestamp_ = false;
+        context.have_timestamp = false;
     }
 
     return true;
 }
 
 bool MessageReceiver::proc_Submsg_InfoDST(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0u;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1331,18 +1384,17 @@ bool MessageReceiver::proc_Submsg_InfoDST(
     CDRMessage::readData(msg, guidP.value, GuidPrefix_t::size);
     if (guidP != c_GuidPrefix_Unknown)
     {
-        dest_guid_prefix_ = guidP;
-        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DST RTPSParticipant is now: " << dest_guid_prefix_);
+        context.dest_guid_prefix = guidP;
+        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "DST RTPSParticipant is now: " << context.dest_guid_prefix);
     }
     return true;
 }
 
 bool MessageReceiver::proc_Submsg_InfoSRC(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1358,17 +1410,18 @@ bool MessageReceiver::proc_Submsg_InfoSRC(
     {
         //AVOID FIRST 4 BYTES:
         msg->pos += 4;
-        CDRMessage::readOctet(msg, &source_version_.m_major);
-        CDRMessage::readOctet(msg, &source_version_.m_minor);
-        CDRMessage::readData(msg, &source_vendor_id_[0], 2);
-        CDRMessage::readData(msg, source_guid_prefix_.value, GuidPrefix_t::size);
-        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "SRC RTPSParticipant is now: " << source_guid_prefix_);
+        CDRMessage::readOctet(msg, &context.source_version.m_major);
+        CDRMessage::readOctet(msg, &context.source_version.m_minor);
+        CDRMessage::readData(msg, &context.source_vendor_id[0], 2);
+        CDRMessage::readData(msg, context.source_guid_prefix.value, GuidPrefix_t::size);
+        EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "SRC RTPSParticipant is now: " << context.source_guid_prefix);
         return true;
     }
     return false;
 }
 
 bool MessageReceiver::proc_Submsg_NackFrag(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -1391,9 +1444,9 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 
     GUID_t readerGUID;
     GUID_t writerGUID;
-    readerGUID.guidPrefix = source_guid_prefix_;
+    readerGUID.guidPrefix = context.source_guid_prefix;
     CDRMessage::readEntityId(msg, &readerGUID.entityId);
-    writerGUID.guidPrefix = dest_guid_prefix_;
+    writerGUID.guidPrefix = context.dest_guid_prefix;
     CDRMessage::readEntityId(msg, &writerGUID.entityId);
 
     SequenceNumber_t writerSN;
@@ -1417,7 +1470,8 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 #endif  // HAVE_SECURITY
         {
             bool result;
-            if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result, source_vendor_id_))
+            if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result,
+                    context.source_vendor_id))
             {
                 if (!result)
                 {
@@ -1433,6 +1487,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
 }
 
 bool MessageReceiver::proc_Submsg_HeartbeatFrag(
+        ReceptionContext& context,
         CDRMessage_t* msg,
         SubmessageHeader_t* smh,
         bool was_decoded) const
@@ -1446,10 +1501,12 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(
 }
 
 void MessageReceiver::notify_network_statistics(
+        const ReceptionContext& context,
         const Locator_t& source_locator,
         const Locator_t& reception_locator,
         CDRMessage_t* msg) const
 {
+    static_cast<void>(context);
     static_cast<void>(source_locator);
     static_cast<void>(reception_locator);
     static_cast<void>(msg);
@@ -1458,7 +1515,7 @@ void MessageReceiver::notify_network_statistics(
     using namespace eprosima::fastdds::statistics;
     using namespace eprosima::fastdds::statistics::rtps;
 
-    if ((c_VendorId_eProsima != source_vendor_id_) ||
+    if ((c_VendorId_eProsima != context.source_vendor_id) ||
             (LOCATOR_KIND_SHM == source_locator.kind))
     {
         return;
@@ -1488,7 +1545,7 @@ void MessageReceiver::notify_network_statistics(
             read_statistics_submessage(msg, data);
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
             participant_->on_network_statistics(
-                source_guid_prefix_, source_locator, reception_locator, data, msg_length);
+                context.source_guid_prefix, source_locator, reception_locator, data, msg_length);
 #endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
             break;
         }
@@ -21,7 +21,10 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <fastdds/rtps/common/CDRMessage_t.h>
 #include <fastdds/rtps/common/Guid.h>
@@ -96,35 +99,61 @@ private:
     std::unordered_map<EntityId_t, std::vector<BaseReader*>> associated_readers_;
 
     RTPSParticipantImpl* participant_;
-    //!Protocol version of the message
-    ProtocolVersion_t source_version_;
-    //!VendorID that created the message
-    fastdds::rtps::VendorId_t source_vendor_id_;
-    //!GuidPrefix of the entity that created the message
-    GuidPrefix_t source_guid_prefix_;
-    //!GuidPrefix of the entity that receives the message. GuidPrefix of the RTPSParticipant.
-    GuidPrefix_t dest_guid_prefix_;
-    //!Has the message timestamp?
-    bool have_timestamp_;
-    //!Timestamp associated with the message
-    Time_t timestamp_;
+
+    /**
+     * State gathered while processing a single RTPS message.
+     * Kept apart from the receiver so several threads can process messages concurrently.
+     */
+    struct ReceptionContext
+    {
+        explicit ReceptionContext(
+                uint32_t crypto_buffer_size);
+
+        //!Reset the context to process a new message.
+        void reset();
+
+        //!Protocol version of the message
+        ProtocolVersion_t source_version;
+        //!VendorID that created the message
+        fastdds::rtps::VendorId_t source_vendor_id;
+        //!GuidPrefix of the entity that created the message
+        GuidPrefix_t source_guid_prefix;
+        //!GuidPrefix of the entity that receives the message. GuidPrefix of the RTPSParticipant.
+        GuidPrefix_t dest_guid_prefix;
+        //!Has the message timestamp?
+        bool have_timestamp;
+        //!Timestamp associated with the message
+        Time_t timestamp;
+
+#if HAVE_SECURITY
+        //!Buffer to process the decoded RTPS message
+        CDRMessage_t crypto_msg;
+        //!Buffer to process each decoded RTPS sub-message
+        CDRMessage_t crypto_submsg;
+        //!Buffer to process a decoded payload
+        SerializedPayload_t crypto_payload;
+#endif // if HAVE_SECURITY
+    };
+
+    //!Protects free_contexts_
+    std::mutex contexts_mtx_;
+    //!Contexts not being used by any reception thread
+    std::vector<std::unique_ptr<ReceptionContext>> free_contexts_;
 
 #if HAVE_SECURITY
-    //!Buffer to process the decoded RTPS message
-    CDRMessage_t crypto_msg_;
-    //!Buffer to process each decoded RTPS sub-message
-    CDRMessage_t crypto_submsg_;
-    //!Buffer to process a decoded payload
-    SerializedPayload_t crypto_payload_;
+    //!Size of the crypto buffers of each context
+    uint32_t crypto_buffer_size_;
 #endif // if HAVE_SECURITY
 
     //! Function used to process a received message
     std::function<void(
+                ReceptionContext&,
                 const EntityId_t&,
                 CacheChange_t&,
                 bool)> process_data_message_function_;
     //! Function used to process a received fragment message
     std::function<void(
+                ReceptionContext&,
                 const EntityId_t&,
                 CacheChange_t&,
                 uint32_t,
@@ -132,8 +161,19 @@ private:
                 uint16_t,
                 bool)> process_data_fragment_message_function_;
 
-    //!Reset the MessageReceiver to process a new message.
-    void reset();
+    //!Take a context from the pool, creating a new one if none is available.
+    ReceptionContext* acquire_context();
+
+    //!Return a context to the pool.
+    void release_context(
+            ReceptionContext* context);
+
+    //!Process a message whose length has already been checked.
+    void process_message(
+            ReceptionContext& context,
+            const Locator_t& source_locator,
+            const Locator_t& reception_locator,
+            CDRMessage_t* msg);
 
     /**
      * Check the RTPSHeader of a received message.
@@ -141,6 +181,7 @@ private:
      * @return True if correct.
      */
     bool checkRTPSHeader(
+            ReceptionContext& context,
             CDRMessage_t* msg);
     /**
      * Read the submessage header of a message.
@@ -175,6 +216,7 @@ private:
      * -Modify the message receiver state if necessary.
      * -Add information to the history.
      * -Return an error if the message is malformed.
+     * @param[in,out] context  State of the message being processed
      * @param[in,out] msg      Pointer to the message
      * @param[in] smh          Pointer to the submessage header
      * @param[out] WriterID    Writer EntityID (only for DATA messages)
@@ -192,40 +234,50 @@ private:
      * @return
      */
     bool proc_Submsg_Data(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             EntityId_t& writerID,
             bool was_decoded) const;
     bool proc_Submsg_DataFrag(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
     bool proc_Submsg_Heartbeat(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
     bool proc_Submsg_Acknack(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
     bool proc_Submsg_Gap(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
     bool proc_Submsg_InfoTS(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
     bool proc_Submsg_InfoDST(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
     bool proc_Submsg_InfoSRC(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh);
     bool proc_Submsg_NackFrag(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
     bool proc_Submsg_HeartbeatFrag(
+            ReceptionContext& context,
             CDRMessage_t* msg,
             SubmessageHeader_t* smh,
             bool was_decoded) const;
@@ -235,6 +287,7 @@ private:
     /**
      * @name Variants of received data message processing functions.
      *
+     * @param[in] context      State of the message being processed
      * @param[in] reader_id    The ID of the reader to which the changes is addressed
      * @param[in] change       The CacheChange with the received data to process
      * @param[in] was_decoded  Whether the submessage being processed came from decoding a secured submessage
@@ -242,12 +295,14 @@ private:
     ///@{
  #if HAVE_SECURITY
     void process_data_message_with_security(
+            ReceptionContext& context,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             bool was_decoded);
 #endif // HAVE_SECURITY
 
     void process_data_message_without_security(
+            ReceptionContext& context,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             bool was_decoded);
@@ -256,6 +311,7 @@ private:
     /**
      * @name Variants of received data fragment message processing functions.
      *
+     * @param[in] context   State of the message being processed
      * @param[in] reader_id The ID of the reader to which the changes is addressed
      * @param[in] change    The CacheChange with the received data to process
      *
@@ -268,6 +324,7 @@ private:
     ///@{
  #if HAVE_SECURITY
     void process_data_fragment_message_with_security(
+            ReceptionContext& context,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             uint32_t sample_size,
@@ -277,6 +334,7 @@ private:
 #endif // HAVE_SECURITY
 
     void process_data_fragment_message_without_security(
+            ReceptionContext& context,
             const EntityId_t& reader_id,
             CacheChange_t& change,
             uint32_t sample_size,
@@ -288,6 +346,7 @@ private:
     /**
      * Looks for the statistics specific submessage and notifies statistics related to the received message.
      *
+     * @param [in] context State of the message being processed.
      * @param [in] source_locator Locator indicating the sending address.
      * @param [in] reception_locator Locator indicating the listening address.
      * @param [in] msg Pointer to the message
@@ -295,6 +354,7 @@ private:
      * @pre The message header has already been read and validated.
      */
     void notify_network_statistics(
+            const ReceptionContext& context,
             const Locator_t& source_locator,
             const Locator_t& reception_locator,
             CDRMessage_t* msg) const;
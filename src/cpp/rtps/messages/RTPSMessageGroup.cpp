@@ -116,6 +116,9 @@ bool RTPSMessageGroup::append_submessage()
     // Note that case 1 and 2 might be intercalated, combining submessages with and without payloads if the RTPSMessageGroup
     // is shared between different writers
 
+    bool copy_pending_buffer = copy_pending_buffer_;
+    copy_pending_buffer_ = false;
+
     uint32_t pos_header = header_msg_->pos;
     uint32_t length_submsg = submessage_msg_->length;
     if (header_msg_->pos == RTPSMESSAGE_HEADER_SIZE && header_msg_->length == RTPSMESSAGE_HEADER_SIZE)
@@ -133,6 +136,19 @@ bool RTPSMessageGroup::append_submessage()
         return false;
     }
 
+    if (copy_pending_buffer && nullptr != pending_buffer_.buffer)
+    {
+        // The pending buffer does not outlive this submessage (i.e. an encoded payload), so it is copied once right
+        // after the submessage header instead of being gathered
+        if (!append_pending_buffer())
+        {
+            return false;
+        }
+        length_submsg += pending_buffer_.size + pending_padding_;
+        pending_buffer_ = NetworkBuffer();
+        pending_padding_ = 0;
+    }
+
 #if HAVE_SECURITY
     // If the RTPS message is protected, the whole message will be encrypted at once
     // so we need to keep the whole message in a single buffer
@@ -162,6 +178,27 @@ bool RTPSMessageGroup::append_submessage()
     return true;
 }
 
+bool RTPSMessageGroup::append_pending_buffer()
+{
+    uint32_t extra_size = 0;
+
+#if HAVE_SECURITY
+    extra_size += participant_->calculate_extra_size_for_rtps_message();
+#endif  // HAVE_SECURITY
+
+#ifdef FASTDDS_STATISTICS
+    extra_size += eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif  // FASTDDS_STATISTICS
+
+    header_msg_->max_size -= extra_size;
+    bool ret_val = CDRMessage::addData(header_msg_, static_cast<const octet*>(pending_buffer_.buffer),
+                    pending_buffer_.size) &&
+            CDRMessage::addData(header_msg_, padding_, pending_padding_);
+    header_msg_->max_size += extra_size;
+
+    return ret_val;
+}
+
 bool sort_changes_group (
         CacheChange_t* c1,
         CacheChange_t* c2)
@@ -576,12 +613,15 @@ bool RTPSMessageGroup::add_data(
     inline_qos = (change.inline_qos.length > 0 && nullptr != change.inline_qos.data) ? &qos_writer : nullptr;
 
     bool copy_data = false;
+    bool copy_encoded_payload = false;
 #if HAVE_SECURITY
     uint32_t from_buffer_position = submessage_msg_->pos;
     bool protect_payload = endpoint_->getAttributes().security_attributes().is_payload_protected;
     bool protect_submessage = endpoint_->getAttributes().security_attributes().is_submessage_protected;
     bool protect_rtps = participant_->security_attributes().is_rtps_protected;
-    copy_data = protect_payload || protect_submessage || protect_rtps;
+    // A payload only protected by itself is encoded on encrypt_msg_, and copied from there into header_msg_
+    copy_data = protect_submessage || protect_rtps;
+    copy_encoded_payload = protect_payload && !copy_data;
 #endif // if HAVE_SECURITY
     const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
 
@@ -651,10 +691,12 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
+    copy_pending_buffer_ = copy_encoded_payload;
+
     if (insert_submessage(is_big_submessage))
     {
         // If gather-send is possible, get payload
-        if (!copy_data)
+        if (!copy_data && !copy_encoded_payload)
         {
             get_payload(change);
         }
@@ -695,12 +737,15 @@ bool RTPSMessageGroup::add_data_frag(
     inline_qos = (change.inline_qos.length > 0 && nullptr != change.inline_qos.data) ? &qos_writer : nullptr;
 
     bool copy_data = false;
+    bool copy_encoded_payload = false;
 #if HAVE_SECURITY
     uint32_t from_buffer_position = submessage_msg_->pos;
     bool protect_payload = endpoint_->getAttributes().security_attributes().is_payload_protected;
     bool protect_submessage = endpoint_->getAttributes().security_attributes().is_submessage_protected;
     bool protect_rtps = participant_->security_attributes().is_rtps_protected;
-    copy_data = protect_payload || protect_submessage || protect_rtps;
+    // A payload only protected by itself is encoded on encrypt_msg_, and copied from there into header_msg_
+    copy_data = protect_submessage || protect_rtps;
+    copy_encoded_payload = protect_payload && !copy_data;
 #endif // if HAVE_SECURITY
     const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
 
@@ -770,10 +815,12 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    copy_pending_buffer_ = copy_encoded_payload;
+
     if (insert_submessage(false))
     {
         // If gather-send is possible, get payload
-        if (!copy_data)
+        if (!copy_data && !copy_encoded_payload)
         {
             get_payload(change);
         }
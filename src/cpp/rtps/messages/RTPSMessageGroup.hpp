@@ -301,11 +301,20 @@ private:
      *
      * If gather-send operation is not possible (i.e. Security), the submessage received will contain
      * the header AND the data payload. The whole submessage will be copied into header_msg_.
+     * When only the payload is protected, the submessage only contains the header and pending_buffer_ points to the
+     * encoded payload, which is copied into header_msg_ right after the submessage.
      *
      * @return True if the submessage was successfully appended, false if the copy operation failed.
      */
     bool append_submessage();
 
+    /**
+     * Copies pending_buffer_ and its padding at the end of header_msg_.
+     *
+     * @return True if there was enough space, false otherwise.
+     */
+    bool append_pending_buffer();
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -369,6 +378,9 @@ private:
     // Size of the pending padding
     uint8_t pending_padding_ = 0;
 
+    // Whether pending_buffer_ has to be copied into header_msg_ instead of being gathered
+    bool copy_pending_buffer_ = false;
+
     // Fixed padding to be used whenever needed
     const octet padding_[3] = {0, 0, 0};
 };
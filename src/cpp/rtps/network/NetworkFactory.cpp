@@ -25,6 +25,7 @@
 #include <fastdds/utils/IPLocator.h>
 
 #include <rtps/transport/TCPTransportInterface.h>
+#include <rtps/transport/compression/CompressionPeers.hpp>
 
 using namespace std;
 
@@ -546,6 +547,47 @@ void NetworkFactory::remove_participant_associated_send_resources(
     }
 }
 
+std::string NetworkFactory::compression_locator_kinds() const
+{
+    std::vector<int32_t> kinds;
+    for (auto& transport : mRegisteredTransports)
+    {
+        if (nullptr != dynamic_cast<CompressionPeers*>(transport.get()))
+        {
+            kinds.push_back(transport->kind());
+        }
+    }
+    return CompressionPeers::format_kinds(kinds);
+}
+
+void NetworkFactory::add_compression_peer(
+        const LocatorList_t& remote_participant_locators,
+        const std::string& kinds) const
+{
+    for (auto& transport : mRegisteredTransports)
+    {
+        CompressionPeers* compression_peers = dynamic_cast<CompressionPeers*>(transport.get());
+        if (compression_peers)
+        {
+            compression_peers->add_peer(remote_participant_locators, kinds);
+        }
+    }
+}
+
+void NetworkFactory::remove_compression_peer(
+        const LocatorList_t& remote_participant_locators,
+        const std::string& kinds) const
+{
+    for (auto& transport : mRegisteredTransports)
+    {
+        CompressionPeers* compression_peers = dynamic_cast<CompressionPeers*>(transport.get());
+        if (compression_peers)
+        {
+            compression_peers->remove_peer(remote_participant_locators, kinds);
+        }
+    }
+}
+
 std::vector<TransportNetmaskFilterInfo> NetworkFactory::netmask_filter_info() const
 {
     std::vector<TransportNetmaskFilterInfo> ret;
@@ -15,8 +15,9 @@
 #ifndef _RTPS_NETWORK_NETWORKFACTORY_H_
 #define _RTPS_NETWORK_NETWORKFACTORY_H_
 
-#include <vector>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/LocatorList.hpp>
@@ -315,6 +316,33 @@ public:
             const LocatorList_t& remote_participant_locators,
             const LocatorList_t& participant_initial_peers) const;
 
+    /**
+     * Locator kinds on which the compression transports receive compressed messages.
+     *
+     * @return The kinds separated by commas, or an empty string when there is no compression transport.
+     */
+    std::string compression_locator_kinds() const;
+
+    /**
+     * Let the compression transports compress the messages sent to a remote participant.
+     *
+     * @param remote_participant_locators List of unicast locators of the remote participant.
+     * @param kinds Locator kinds on which the remote participant receives compressed messages, as announced by it.
+     */
+    void add_compression_peer(
+            const LocatorList_t& remote_participant_locators,
+            const std::string& kinds) const;
+
+    /**
+     * Stop compressing the messages sent to a remote participant.
+     *
+     * @param remote_participant_locators List of unicast locators of the remote participant.
+     * @param kinds Locator kinds on which the remote participant receives compressed messages, as announced by it.
+     */
+    void remove_compression_peer(
+            const LocatorList_t& remote_participant_locators,
+            const std::string& kinds) const;
+
     /**
      * Returns transports' netmask filter information (transport's netmask filter kind and allowlist).
      */
@@ -116,7 +116,7 @@ void ReceiverResource::OnDataReceived(
 {
     (void)localLocator;
 
-    std::lock_guard<std::mutex> _(mtx);
+    std::unique_lock<std::mutex> lock(mtx);
 
     MessageReceiver* rcv = receiver;
 
@@ -131,8 +131,12 @@ void ReceiverResource::OnDataReceived(
         msg.max_size = size;
         msg.reserved_size = size;
 
-        // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
+        // The receiver keeps the state of each message in its own reception context, so channels sharing this
+        // resource can process messages concurrently. disable() waits for active_callbacks_ before the receiver
+        // is destroyed.
+        lock.unlock();
         rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+        lock.lock();
 
         // allow disabling
         if (--active_callbacks_ == 0)
@@ -449,6 +449,21 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     mp_userParticipant->mp_impl = this;
     uint32_t id_for_thread = static_cast<uint32_t>(m_att.participantID);
     const fastdds::rtps::ThreadSettings& thr_config = m_att.timed_events_thread;
+    const std::string* timed_events_scheduler =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.timed_events_scheduler");
+    if (nullptr != timed_events_scheduler)
+    {
+        if (0 == timed_events_scheduler->compare("timing_wheel"))
+        {
+            mp_event_thr.use_timing_wheel(true);
+        }
+        else if (0 != timed_events_scheduler->compare("sorted"))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Unkown value '" << *timed_events_scheduler <<
+                    "' for property 'fastdds.timed_events_scheduler'. Setting value to 'sorted'");
+        }
+    }
     mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
 
     if (!networkFactoryHasRegisteredTransports())
@@ -3266,6 +3281,25 @@ void RTPSParticipantImpl::update_removed_participant(
     }
 }
 
+std::string RTPSParticipantImpl::compression_locator_kinds() const
+{
+    return m_network_Factory.compression_locator_kinds();
+}
+
+void RTPSParticipantImpl::add_compression_peer(
+        const LocatorList_t& remote_participant_locators,
+        const std::string& kinds)
+{
+    m_network_Factory.add_compression_peer(remote_participant_locators, kinds);
+}
+
+void RTPSParticipantImpl::remove_compression_peer(
+        const LocatorList_t& remote_participant_locators,
+        const std::string& kinds)
+{
+    m_network_Factory.remove_compression_peer(remote_participant_locators, kinds);
+}
+
 } /* namespace rtps */
 } /* namespace fastdds */
 } /* namespace eprosima */
@@ -28,6 +28,7 @@
 #include <list>
 #include <mutex>
 #include <set>
+#include <string>
 #include <sys/types.h>
 #include <vector>
 
@@ -1312,6 +1313,33 @@ public:
     void update_removed_participant(
             const LocatorList_t& remote_participant_locators);
 
+    /**
+     * Locator kinds on which this participant receives messages compressed by a compression transport.
+     *
+     * @return The kinds separated by commas, or an empty string when the participant has no compression transport.
+     */
+    std::string compression_locator_kinds() const;
+
+    /**
+     * Method called on the discovery of a participant announcing that it receives compressed messages.
+     *
+     * @param remote_participant_locators Set of unicast locators of the discovered participant.
+     * @param kinds Locator kinds on which the discovered participant receives compressed messages.
+     */
+    void add_compression_peer(
+            const LocatorList_t& remote_participant_locators,
+            const std::string& kinds);
+
+    /**
+     * Method called on the removal of a participant which announced that it receives compressed messages.
+     *
+     * @param remote_participant_locators Set of unicast locators of the participant removed.
+     * @param kinds Locator kinds on which the participant removed received compressed messages.
+     */
+    void remove_compression_peer(
+            const LocatorList_t& remote_participant_locators,
+            const std::string& kinds);
+
 };
 } // namespace rtps
 } /* namespace rtps */
@@ -473,6 +473,7 @@ void BaseReader::init(
 {
     payload_pool_ = payload_pool;
     change_pool_ = change_pool;
+    spare_change_pool_ = dynamic_cast<CacheChangePool*>(change_pool.get());
     fixed_payload_size_ = 0;
     if (history_->m_att.memoryPolicy == PREALLOCATED_MEMORY_MODE)
     {
@@ -499,7 +500,8 @@ void BaseReader::setup_datasharing(
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.data_sharing_listener_thread,
                         att.matched_writers_allocation,
-                        this));
+                        this,
+                        att.data_sharing_listener_spin_budget_us));
 
             // We can start the listener here, as no writer can be matched already,
             // so no notification will occur until the non-virtual instance is constructed.
@@ -47,6 +47,7 @@ namespace fastdds {
 namespace rtps {
 
 struct CacheChange_t;
+class CacheChangePool;
 class IDataSharingListener;
 struct ReaderHistoryState;
 class ReaderListener;
@@ -435,6 +436,9 @@ protected:
     /// Trusted writer (for Builtin)
     fastdds::rtps::EntityId_t trusted_writer_entity_id_;
 
+    /// The change pool when it is a CacheChangePool, so received samples can reserve a change before taking mp_mutex.
+    fastdds::rtps::CacheChangePool* spare_change_pool_ = nullptr;
+
 private:
 
     /**
@@ -0,0 +1,437 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceivedChangesWindow.hpp
+ */
+
+#ifndef FASTDDS_RTPS_READER__RECEIVEDCHANGESWINDOW_HPP
+#define FASTDDS_RTPS_READER__RECEIVEDCHANGESWINDOW_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+#include <foonathan/memory/container.hpp>
+#include <foonathan/memory/memory_pool.hpp>
+
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+#include <utils/collections/node_size_helpers.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Set of the sequence numbers received from a writer above its first missing one.
+ *
+ * Sequence numbers close to the first missing one are kept on a ring bitmap anchored at it, so adding a change and
+ * building the ACKNACK bitmap are bit operations on whole words.
+ * The ring grows up to a maximum size, and sequence numbers that do not fit on it are kept on a set until the window
+ * moves forward enough to hold them.
+ */
+class ReceivedChangesWindow
+{
+    using pool_allocator_t =
+            foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
+    using set_helper = utilities::collections::set_size_helper<SequenceNumber_t>;
+
+public:
+
+    //! Number of bits on the ring when constructed, enough to build a complete ACKNACK bitmap.
+    static constexpr uint32_t initial_bits = 256u;
+    //! Maximum number of bits on the ring.
+    static constexpr uint32_t max_bits = 65536u;
+
+    /**
+     * @param spill_initial  Number of sequence numbers the set for changes outside the ring is preallocated for.
+     */
+    explicit ReceivedChangesWindow(
+            size_t spill_initial)
+        : words_(initial_bits / 32u, 0u)
+        , mask_(initial_bits - 1u)
+        , spill_pool_(set_helper::node_size, set_helper::min_pool_size<pool_allocator_t>(spill_initial))
+        , spill_(spill_pool_)
+    {
+    }
+
+    /**
+     * Remove all the received sequence numbers and anchor the window on a new first missing one.
+     *
+     * @param base  First sequence number not received.
+     */
+    void clear(
+            const SequenceNumber_t& base)
+    {
+        std::fill(words_.begin(), words_.end(), 0u);
+        spill_.clear();
+        base_ = base.to64long();
+    }
+
+    /**
+     * @return The sequence number the window is anchored at.
+     */
+    SequenceNumber_t base() const
+    {
+        return SequenceNumber_t(base_);
+    }
+
+    /**
+     * Add a sequence number.
+     *
+     * @param seq  Sequence number to add. Should not be lower than the base of the window.
+     *
+     * @return false if the sequence number was already present, true otherwise.
+     */
+    bool insert(
+            const SequenceNumber_t& seq)
+    {
+        uint64_t pos = seq.to64long();
+        assert(pos >= base_);
+
+        uint64_t offset = pos - base_;
+        if (offset >= capacity())
+        {
+            if (offset >= max_bits)
+            {
+                return spill_.insert(seq).second;
+            }
+            grow(offset + 1u);
+        }
+
+        uint32_t& word = words_[word_index(pos)];
+        uint32_t bit = bit_mask(pos);
+        if (word & bit)
+        {
+            return false;
+        }
+        word |= bit;
+        return true;
+    }
+
+    /**
+     * @param seq  Sequence number to look for.
+     *
+     * @return Whether the sequence number is present.
+     */
+    bool contains(
+            const SequenceNumber_t& seq) const
+    {
+        uint64_t pos = seq.to64long();
+        if (pos < base_)
+        {
+            return false;
+        }
+        if (pos - base_ < capacity())
+        {
+            return is_set(pos);
+        }
+        return spill_.find(seq) != spill_.end();
+    }
+
+    /**
+     * Count the sequence numbers present on a range.
+     *
+     * @param from  First sequence number of the range.
+     * @param to    Sequence number following the last one of the range.
+     *
+     * @return Number of sequence numbers present on [from, to).
+     */
+    uint64_t count(
+            const SequenceNumber_t& from,
+            const SequenceNumber_t& to) const
+    {
+        uint64_t first = (std::max)(from.to64long(), base_);
+        uint64_t last = to.to64long();
+        if (first >= last)
+        {
+            return 0u;
+        }
+
+        uint64_t ret = 0u;
+        uint64_t window_end = base_ + capacity();
+        if (first < window_end)
+        {
+            for_each_word((std::min)(last, window_end) - first, first, [this, &ret](size_t index, uint32_t mask)
+                    {
+                        ret += popcount(words_[index] & mask);
+                    });
+        }
+        for (auto it = spill_.begin(); it != spill_.end() && *it < to; ++it)
+        {
+            if (*it >= from)
+            {
+                ++ret;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * Move the window forward, removing the sequence numbers it leaves behind.
+     *
+     * @param new_base  New sequence number for the window to be anchored at.
+     *
+     * @return Number of sequence numbers removed.
+     */
+    uint64_t advance(
+            const SequenceNumber_t& new_base)
+    {
+        uint64_t new_pos = new_base.to64long();
+        if (new_pos <= base_)
+        {
+            return 0u;
+        }
+
+        uint64_t ret = count(base(), new_base);
+        uint64_t n_bits = (std::min)(new_pos - base_, static_cast<uint64_t>(capacity()));
+        clear_bits(base_, n_bits);
+        spill_.erase(spill_.begin(), spill_.lower_bound(new_base));
+        base_ = new_pos;
+        collect_spill();
+        return ret;
+    }
+
+    /**
+     * Move the window past the sequence numbers present right at its base.
+     *
+     * @return Number of sequence numbers the window has moved.
+     */
+    uint64_t pop_front()
+    {
+        uint64_t ret = 0u;
+        do
+        {
+            uint64_t moved = 0u;
+            while (moved < capacity())
+            {
+                // Bits from the base to the end of its word, MSB first
+                uint32_t shift = static_cast<uint32_t>(base_ & 31u);
+                uint32_t bits = words_[word_index(base_)] << shift;
+                uint32_t available = 32u - shift;
+                uint32_t run = (std::min)(leading_ones(bits), available);
+                if (0u == run)
+                {
+                    break;
+                }
+
+                clear_bits(base_, run);
+                base_ += run;
+                moved += run;
+                if (run < available)
+                {
+                    break;
+                }
+            }
+            ret += moved;
+        } while (0u < collect_spill() && is_set(base_));
+
+        return ret;
+    }
+
+    /**
+     * Fill a set with the sequence numbers not present from the base of the window up to a limit.
+     *
+     * @param [out] missing  Set to fill. Its base should be the base of the window.
+     * @param [in]  to       Sequence number following the last one to check.
+     */
+    void missing(
+            SequenceNumberSet_t& missing,
+            const SequenceNumber_t& to) const
+    {
+        assert(missing.base() == base());
+
+        uint64_t last = to.to64long();
+        if (last <= base_)
+        {
+            return;
+        }
+
+        // The ring is never smaller than a complete bitmap, so no missing change can be on the spill set
+        uint32_t num_bits = static_cast<uint32_t>((std::min)(last - base_, static_cast<uint64_t>(initial_bits)));
+        uint32_t bitmap[initial_bits / 32u] = {};
+        uint32_t num_words = (num_bits + 31u) / 32u;
+        for (uint32_t i = 0; i < num_words; ++i)
+        {
+            uint64_t pos = base_ + (i * 32u);
+            uint32_t shift = static_cast<uint32_t>(pos & 31u);
+            size_t index = word_index(pos);
+            uint32_t bits = words_[index] << shift;
+            if (0u != shift)
+            {
+                bits |= words_[(index + 1u) % words_.size()] >> (32u - shift);
+            }
+            bitmap[i] = ~bits;
+        }
+
+        missing.bitmap_set(num_bits, bitmap);
+    }
+
+private:
+
+    size_t capacity() const
+    {
+        return words_.size() * 32u;
+    }
+
+    size_t word_index(
+            uint64_t pos) const
+    {
+        return static_cast<size_t>(pos & mask_) >> 5u;
+    }
+
+    static uint32_t bit_mask(
+            uint64_t pos)
+    {
+        return 1u << (31u - static_cast<uint32_t>(pos & 31u));
+    }
+
+    bool is_set(
+            uint64_t pos) const
+    {
+        return 0u != (words_[word_index(pos)] & bit_mask(pos));
+    }
+
+    /**
+     * Call a functor for each word holding a range of bits, with the mask of the bits of the range on it.
+     * The range should not be longer than the ring.
+     */
+    template<typename Functor>
+    void for_each_word(
+            uint64_t n_bits,
+            uint64_t pos,
+            const Functor& f) const
+    {
+        assert(n_bits <= capacity());
+        while (0u < n_bits)
+        {
+            uint32_t bit = static_cast<uint32_t>(pos & 31u);
+            uint32_t n = static_cast<uint32_t>((std::min)(static_cast<uint64_t>(32u - bit), n_bits));
+            uint32_t mask = (32u == n) ? 0xFFFFFFFFu : (((1u << n) - 1u) << (32u - bit - n));
+            f(word_index(pos), mask);
+            n_bits -= n;
+            pos += n;
+        }
+    }
+
+    void clear_bits(
+            uint64_t pos,
+            uint64_t n_bits)
+    {
+        for_each_word(n_bits, pos, [this](size_t index, uint32_t mask)
+                {
+                    words_[index] &= ~mask;
+                });
+    }
+
+    /**
+     * Grow the ring to hold a number of bits, which should not exceed the maximum size.
+     */
+    void grow(
+            uint64_t required_bits)
+    {
+        assert(required_bits <= max_bits);
+        size_t new_capacity = capacity();
+        while (new_capacity < required_bits)
+        {
+            new_capacity *= 2u;
+        }
+
+        // Positions depend on the size of the ring, so bits should be placed again
+        std::vector<uint32_t> old_words(new_capacity / 32u, 0u);
+        old_words.swap(words_);
+        size_t old_mask = mask_;
+        mask_ = new_capacity - 1u;
+        for (uint64_t pos = base_; pos < base_ + old_words.size() * 32u; ++pos)
+        {
+            size_t index = static_cast<size_t>(pos & old_mask);
+            if (old_words[index >> 5u] & bit_mask(pos))
+            {
+                words_[word_index(pos)] |= bit_mask(pos);
+            }
+        }
+
+        collect_spill();
+    }
+
+    /**
+     * Move into the ring the sequence numbers on the spill set that fit on it.
+     *
+     * @return Number of sequence numbers moved.
+     */
+    size_t collect_spill()
+    {
+        size_t ret = 0u;
+        auto it = spill_.begin();
+        for (; it != spill_.end() && it->to64long() - base_ < capacity(); ++it)
+        {
+            uint64_t pos = it->to64long();
+            words_[word_index(pos)] |= bit_mask(pos);
+            ++ret;
+        }
+        spill_.erase(spill_.begin(), it);
+        return ret;
+    }
+
+    static uint32_t popcount(
+            uint32_t bits)
+    {
+#if _MSC_VER
+        return static_cast<uint32_t>(__popcnt(bits));
+#else
+        return static_cast<uint32_t>(__builtin_popcount(bits));
+#endif // if _MSC_VER
+    }
+
+    static uint32_t leading_ones(
+            uint32_t bits)
+    {
+        uint32_t zeros = ~bits;
+        if (0u == zeros)
+        {
+            return 32u;
+        }
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanReverse(&bit, zeros);
+        return 31u ^ bit;
+#else
+        return static_cast<uint32_t>(__builtin_clz(zeros));
+#endif // if _MSC_VER
+    }
+
+    //! Ring bitmap, with the most significant bit of each word being the lowest sequence number
+    std::vector<uint32_t> words_;
+    //! Mask to get the position of a sequence number on the ring
+    size_t mask_;
+    //! First sequence number not received
+    uint64_t base_ = 0u;
+    //! Memory pool allocator for spill_
+    pool_allocator_t spill_pool_;
+    //! Sequence numbers too far from the base to be on the ring
+    foonathan::memory::set<SequenceNumber_t, pool_allocator_t> spill_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_READER__RECEIVEDCHANGESWINDOW_HPP
@@ -33,6 +33,7 @@
 #include <rtps/builtin/liveliness/WLP.hpp>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
+#include <rtps/history/CacheChangePool.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/reader/StatelessReader.hpp>
 #include <rtps/writer/LivelinessManager.hpp>
@@ -556,6 +557,19 @@ bool StatelessReader::process_data_msg(
 {
     assert(change);
 
+    // Reserve a spare change before taking the reader lock, so the pool is not accessed while holding it.
+    // The pool bounds the outstanding spare changes, and an unused one is returned after releasing the lock.
+    auto release_spare_change = [this](CacheChange_t* spare_change)
+            {
+                spare_change_pool_->release_spare_cache(spare_change);
+            };
+    std::unique_ptr<CacheChange_t, decltype(release_spare_change)> spare_change{nullptr, release_spare_change};
+    CacheChange_t* reserved_change = nullptr;
+    if (nullptr != spare_change_pool_ && spare_change_pool_->reserve_spare_cache(reserved_change))
+    {
+        spare_change.reset(reserved_change);
+    }
+
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
     if (acceptMsgFrom(change->writerGUID, change->kind))
@@ -592,9 +606,13 @@ bool StatelessReader::process_data_msg(
                 return true;
             }
 
-            // Ask the pool for a cache change
-            CacheChange_t* change_to_add = nullptr;
-            if (!change_pool_->reserve_cache(change_to_add))
+            // Use the spare change reserved before, or ask the pool for a cache change
+            CacheChange_t* change_to_add = spare_change.release();
+            if (nullptr != change_to_add)
+            {
+                spare_change_pool_->keep_spare_cache(change_to_add);
+            }
+            else if (!change_pool_->reserve_cache(change_to_add))
             {
                 EPROSIMA_LOG_WARNING(RTPS_MSG_IN,
                         IDSTRING "Reached the maximum number of samples allowed by this reader's QoS. Rejecting change for reader: " <<
@@ -64,8 +64,6 @@ WriterProxy::~WriterProxy()
     delete(heartbeat_response_);
 }
 
-using set_helper = utilities::collections::set_size_helper<SequenceNumber_t>;
-
 WriterProxy::WriterProxy(
         StatefulReader* reader,
         const RemoteLocatorsAllocationAttributes& loc_alloc,
@@ -76,10 +74,7 @@ WriterProxy::WriterProxy(
     , last_heartbeat_count_(0)
     , heartbeat_final_flag_(false)
     , is_alive_(false)
-    , changes_pool_(
-        set_helper::node_size,
-        set_helper::min_pool_size<pool_allocator_t>(changes_allocation.initial))
-    , changes_received_(changes_pool_)
+    , changes_received_(changes_allocation.initial)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , guid_prefix_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , is_on_same_process_(false)
@@ -195,7 +190,6 @@ void WriterProxy::clear()
     heartbeat_final_flag_.store(false);
     guid_as_vector_.clear();
     guid_prefix_as_vector_.clear();
-    changes_received_.clear();
     is_on_same_process_ = false;
     loaded_from_storage(SequenceNumber_t());
 }
@@ -206,6 +200,7 @@ void WriterProxy::loaded_from_storage(
     last_notified_ = seq_num;
     changes_from_writer_low_mark_ = seq_num;
     max_sequence_number_ = seq_num;
+    changes_received_.clear(seq_num + 1);
 }
 
 void WriterProxy::missing_changes_update(
@@ -241,22 +236,10 @@ int32_t WriterProxy::lost_changes_update(
     if (seq_num > (changes_from_writer_low_mark_ + 1))
     {
         // Remove all received changes with a sequence lower than seq_num
-        ChangeIterator it = std::lower_bound(changes_received_.begin(), changes_received_.end(), seq_num);
-        if (!changes_received_.empty())
-        {
-            uint64_t tmp = (*changes_received_.begin()).to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            auto distance = std::distance(changes_received_.begin(), it);
-            tmp += seq_num.to64long() - (*changes_received_.begin()).to64long() - distance;
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
-        }
-        else
-        {
-            uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
-        }
-        changes_received_.erase(changes_received_.begin(), it);
+        uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
+        tmp -= changes_received_.advance(seq_num);
+        current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
+                std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
 
         // Update low mark
         changes_from_writer_low_mark_ = seq_num - 1;
@@ -301,38 +284,22 @@ bool WriterProxy::received_change_set(
         return false;
     }
 
-    // If will be the last element, insert it at the end.
-    if (seq_num > max_sequence_number_)
+    // Check if it is next to the last acknowledged
+    if (changes_from_writer_low_mark_ + 1 == seq_num)
     {
-        // If it is the next to be acknowledeg, not insert
-        if (seq_num == changes_from_writer_low_mark_ + 1)
-        {
-            changes_from_writer_low_mark_ = seq_num;
-        }
-        else
-        {
-            changes_received_.insert(changes_received_.end(), seq_num);
-        }
-        max_sequence_number_ = seq_num;
+        changes_from_writer_low_mark_ = seq_num;
+        changes_received_.advance(seq_num + 1);
+        cleanup();
     }
-    else
+    // Check if already received
+    else if (!changes_received_.insert(seq_num))
     {
-        // Check if it is next to the last acknowledged
-        if (changes_from_writer_low_mark_ + 1 == seq_num)
-        {
-            changes_from_writer_low_mark_ = seq_num;
-            cleanup();
-        }
-        else
-        {
-            // Check if already received
-            if (changes_received_.find(seq_num) != changes_received_.end())
-            {
-                return false;
-            }
+        return false;
+    }
 
-            changes_received_.insert(seq_num);
-        }
+    if (seq_num > max_sequence_number_)
+    {
+        max_sequence_number_ = seq_num;
     }
 
     return true;
@@ -347,22 +314,7 @@ SequenceNumberSet_t WriterProxy::missing_changes() const
     SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
     SequenceNumber_t max_missing = std::min(first_missing + 256UL, max_sequence_number_ + 1);
     SequenceNumberSet_t sns(first_missing);
-
-    for (SequenceNumber_t seq : changes_received_)
-    {
-        seq = std::min(seq, max_missing);
-        sns.add_range(first_missing, seq);
-        first_missing = seq + 1;
-        if (first_missing >= max_missing)
-        {
-            break;
-        }
-    }
-
-    if (first_missing < max_missing)
-    {
-        sns.add_range(first_missing, max_missing);
-    }
+    changes_received_.missing(sns, max_missing);
 
     return sns;
 }
@@ -379,8 +331,7 @@ bool WriterProxy::change_was_received(
         return true;
     }
 
-    ChangeIterator chit = changes_received_.find(seq_num);
-    return chit != changes_received_.end();
+    return changes_received_.contains(seq_num);
 }
 
 const SequenceNumber_t WriterProxy::available_changes_max() const
@@ -394,17 +345,11 @@ const SequenceNumber_t WriterProxy::available_changes_max() const
 
 void WriterProxy::cleanup()
 {
-    ChangeIterator chit = changes_received_.begin();
-
     // Jump over all consecutive received changes starting on the next to low_mark
-    while (chit != changes_received_.end() && *chit == changes_from_writer_low_mark_ + 1)
+    if (0u < changes_received_.pop_front())
     {
-        chit++;
-        changes_from_writer_low_mark_++;
+        changes_from_writer_low_mark_ = changes_received_.base() - 1;
     }
-
-    // Remove all those changes
-    changes_received_.erase(changes_received_.begin(), chit);
 }
 
 bool WriterProxy::are_there_missing_changes() const
@@ -428,26 +373,11 @@ size_t WriterProxy::unknown_missing_changes_up_to(
     if (seq_num > changes_from_writer_low_mark_)
     {
         SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
-        SequenceNumberSet_t sns(first_missing);
-        SequenceNumberDiff d_fun;
-
-        for (SequenceNumber_t seq : changes_received_)
-        {
-            seq = std::min(seq, seq_num);
-            if (first_missing < seq)
-            {
-                returnedValue += d_fun(seq, first_missing);
-            }
-            first_missing = seq + 1;
-            if (first_missing >= seq_num)
-            {
-                break;
-            }
-        }
-
         if (first_missing < seq_num)
         {
-            returnedValue += d_fun(seq_num, first_missing);
+            SequenceNumberDiff d_fun;
+            returnedValue = d_fun(seq_num, first_missing) -
+                    static_cast<uint32_t>(changes_received_.count(first_missing, seq_num));
         }
     }
 
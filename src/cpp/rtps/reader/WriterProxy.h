@@ -30,10 +30,8 @@
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/common/LocatorSelectorEntry.hpp>
 
-#include <foonathan/memory/container.hpp>
-#include <foonathan/memory/memory_pool.hpp>
+#include <rtps/reader/ReceivedChangesWindow.hpp>
 
-#include <set>
 #include <vector>
 
 // Testing purpose
@@ -387,13 +385,8 @@ private:
     //!Is the writer alive
     bool is_alive_;
 
-    using pool_allocator_t =
-            foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
-
-    //! Memory pool allocator for changes_received_
-    pool_allocator_t changes_pool_;
-    //! Vector containing the sequence number of the received ChangeFromWriter_t objects.
-    foonathan::memory::set<SequenceNumber_t, pool_allocator_t> changes_received_;
+    //! Sequence numbers received above changes_from_writer_low_mark_ + 1, the base of the window.
+    ReceivedChangesWindow changes_received_;
     //! Sequence number of the highest available change
     SequenceNumber_t changes_from_writer_low_mark_;
     //! Highest sequence number informed by writer
@@ -421,8 +414,6 @@ private:
     //! Current state of this Writer Proxy
     std::atomic<StateCode> state_;
 
-    using ChangeIterator = decltype(changes_received_)::iterator;
-
 #if !defined(NDEBUG) && defined(FASTDDS_SOURCE) && defined(__unix__)
     int get_mutex_owner() const;
 
@@ -18,6 +18,7 @@
 
 #include <rtps/resources/ResourceEvent.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -104,6 +105,17 @@ void ResourceEvent::unregister_timer(
         should_notify = true;
     }
 
+    if (use_timing_wheel_)
+    {
+        if (timing_wheel_.remove(event))
+        {
+            should_notify = true;
+        }
+
+        // Do not trigger it if it is on the batch being processed
+        std::replace(expired_timers_.begin(), expired_timers_.end(), event, static_cast<TimedEventImpl*>(nullptr));
+    }
+
     // Remove from active
     it = std::find(active_timers_.begin(), active_timers_.end(), event);
     if (it != active_timers_.end())
@@ -202,6 +214,8 @@ void ResourceEvent::event_service()
 
         // Wait for the first timer to be triggered
         std::chrono::steady_clock::time_point next_trigger =
+                use_timing_wheel_ ?
+                (std::min)(current_time_ + std::chrono::seconds(1), timing_wheel_.next_expiry()) :
                 active_timers_.empty() ?
                 current_time_ + std::chrono::seconds(1) :
                 active_timers_[0]->next_trigger_time();
@@ -239,6 +253,12 @@ void ResourceEvent::update_current_time()
 
 void ResourceEvent::do_timer_actions()
 {
+    if (use_timing_wheel_)
+    {
+        do_timing_wheel_actions();
+        return;
+    }
+
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
@@ -310,6 +330,48 @@ void ResourceEvent::do_timer_actions()
     }
 }
 
+void ResourceEvent::do_timing_wheel_actions()
+{
+    std::chrono::steady_clock::time_point cancel_time =
+            current_time_ + std::chrono::hours(24);
+
+    // Process pending orders
+    {
+        std::lock_guard<TimedMutex> lock(mutex_);
+        for (TimedEventImpl* tp : pending_timers_)
+        {
+            timing_wheel_.remove(tp);
+
+            // Update timer info
+            if (tp->update(current_time_, cancel_time))
+            {
+                timing_wheel_.insert(tp);
+            }
+        }
+        pending_timers_.clear();
+    }
+
+    // Trigger expired timers. Those unregistered by a callback are set to nullptr on the batch.
+    timing_wheel_.advance(current_time_, expired_timers_);
+    for (size_t i = 0; i < expired_timers_.size(); ++i)
+    {
+        TimedEventImpl* tp = expired_timers_[i];
+        if (nullptr == tp)
+        {
+            continue;
+        }
+
+        tp->trigger(current_time_, cancel_time);
+
+        // Activate it again if the callback asked for a restart
+        if (nullptr != expired_timers_[i] && tp->next_trigger_time() < cancel_time)
+        {
+            timing_wheel_.insert(tp);
+        }
+    }
+    expired_timers_.clear();
+}
+
 void ResourceEvent::init_thread(
         const fastdds::rtps::ThreadSettings& thread_cfg,
         const char* name_fmt,
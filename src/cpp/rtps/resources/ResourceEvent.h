@@ -31,6 +31,8 @@
 #include <fastdds/utils/TimedMutex.hpp>
 #include <fastdds/utils/TimedConditionVariable.hpp>
 
+#include <rtps/resources/TimingWheel.hpp>
+
 namespace eprosima {
 
 class thread;
@@ -68,6 +70,21 @@ public:
 
     void stop_thread();
 
+    /*!
+     * @brief Selects how the active timers are kept.
+     *
+     * By default, active timers are kept on a vector sorted by trigger time.
+     * A hierarchical timing wheel adds and cancels timers in constant time, and collects the expired ones in batches,
+     * at the cost of rounding trigger times up to the next 100 microseconds.
+     * This method has to be called before init_thread().
+     * @param use_timing_wheel Whether to keep the active timers on a timing wheel.
+     */
+    void use_timing_wheel(
+            bool use_timing_wheel)
+    {
+        use_timing_wheel_ = use_timing_wheel;
+    }
+
     /*!
      * @brief This method informs that a TimedEventImpl has been created.
      *
@@ -139,6 +156,15 @@ private:
     //! Prevents iterator invalidation when active_timers are manipulated inside loops
     std::atomic<bool> skip_checking_active_timers_;
 
+    //! Whether active timers are kept on timing_wheel_ instead of active_timers_.
+    bool use_timing_wheel_ = false;
+
+    //! Registered events waiting completion, when use_timing_wheel_.
+    TimingWheel<TimedEventImpl> timing_wheel_;
+
+    //! Events being triggered by the execution thread, when use_timing_wheel_.
+    std::vector<TimedEventImpl*> expired_timers_;
+
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
 
@@ -166,11 +192,15 @@ private:
     //! Method called by the internal thread to process due actions.
     void do_timer_actions();
 
+    //! Method called by the internal thread to process due actions, when use_timing_wheel_.
+    void do_timing_wheel_actions();
+
     //! Ensures internal collections can accommodate current total number of timers.
     void resize_collections()
     {
         pending_timers_.reserve(timers_count_);
         active_timers_.reserve(timers_count_);
+        expired_timers_.reserve(timers_count_);
     }
 
 };
@@ -24,6 +24,7 @@
 
 #include <fastdds/rtps/common/Time_t.h>
 #include <rtps/resources/TimedEvent.h>
+#include <rtps/resources/TimingWheel.hpp>
 
 #include <atomic>
 #include <functional>
@@ -143,6 +144,15 @@ public:
             std::chrono::steady_clock::time_point current_time,
             std::chrono::steady_clock::time_point cancel_time);
 
+    /*!
+     * @brief Returns the links of the event on the timing wheel of ResourceEvent.
+     * @warning This method has to be called from ResourceEvent's internal thread.
+     */
+    TimingWheelHook<TimedEventImpl>& timing_wheel_hook()
+    {
+        return timing_wheel_hook_;
+    }
+
 private:
 
     //! Expiration time in microseconds of the event.
@@ -156,6 +166,9 @@ private:
 
     //! Current state of this event
     std::atomic<StateCode> state_;
+
+    //! Links of this event on the timing wheel of ResourceEvent, when it uses one
+    TimingWheelHook<TimedEventImpl> timing_wheel_hook_;
 };
 
 } // namespace rtps
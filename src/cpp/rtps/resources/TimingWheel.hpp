@@ -0,0 +1,394 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimingWheel.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_RESOURCES_TIMINGWHEEL_HPP_
+#define _FASTDDS_RTPS_RESOURCES_TIMINGWHEEL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Links of an event on a TimingWheel.
+ * Events kept on a TimingWheel hold one of these, accessible through a method called timing_wheel_hook().
+ */
+template<class Event>
+struct TimingWheelHook
+{
+    //! Previous event on the same bucket
+    Event* prev = nullptr;
+    //! Next event on the same bucket
+    Event* next = nullptr;
+    //! Tick on which the event expires
+    uint64_t expiry_tick = 0;
+    //! Bucket the event is on
+    uint32_t bucket = 0;
+    //! Whether the event is on a wheel
+    bool linked = false;
+};
+
+/**
+ * Hierarchical timing wheel.
+ *
+ * Events are kept on intrusive lists, on buckets of 4 levels of 256 slots of increasing duration.
+ * Adding and removing an event are constant time operations, and advancing the wheel moves the events on the slots
+ * of a level to the level below when the level below completes a turn.
+ * Events are never reported before their trigger time, and at most one tick after it.
+ *
+ * @tparam Event Type of the events, providing timing_wheel_hook() and next_trigger_time().
+ */
+template<class Event>
+class TimingWheel
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    //! Duration of a tick of the wheel
+    static constexpr std::chrono::microseconds tick_duration{100};
+
+    TimingWheel()
+        : origin_(clock::now())
+    {
+        buckets_.fill(nullptr);
+        counts_.fill(0u);
+    }
+
+    TimingWheel(
+            const TimingWheel&) = delete;
+
+    TimingWheel& operator =(
+            const TimingWheel&) = delete;
+
+    bool empty() const
+    {
+        return 0u == size_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * Add an event, to be reported when its next trigger time is reached.
+     * @param event Event to add, which should not be on the wheel.
+     */
+    void insert(
+            Event* event)
+    {
+        TimingWheelHook<Event>& hook = event->timing_wheel_hook();
+        assert(!hook.linked);
+
+        uint64_t tick = ceil_tick(event->next_trigger_time());
+        hook.expiry_tick = tick < current_tick_ ? current_tick_ : tick;
+        place(event);
+        ++size_;
+    }
+
+    /**
+     * Remove an event.
+     * @param event Event to remove.
+     * @return Whether the event was on the wheel.
+     */
+    bool remove(
+            Event* event)
+    {
+        if (!event->timing_wheel_hook().linked)
+        {
+            return false;
+        }
+
+        unlink(event);
+        --size_;
+        return true;
+    }
+
+    /**
+     * Advance the wheel up to a point in time, removing the events that expire until then.
+     * @param now      Point in time to advance to.
+     * @param expired  Vector where the expired events are appended, in order of expiry tick.
+     */
+    void advance(
+            const clock::time_point& now,
+            std::vector<Event*>& expired)
+    {
+        uint64_t target = floor_tick(now);
+        while (current_tick_ <= target)
+        {
+            if (0u == size_)
+            {
+                current_tick_ = target + 1u;
+                break;
+            }
+
+            if (0u == counts_[0])
+            {
+                // Nothing to collect until the current slot of the lowest level with events ends
+                move_to((std::min)(target + 1u, next_turn()));
+                continue;
+            }
+
+            Event* event = detach(slot_of(current_tick_, 0u));
+            while (nullptr != event)
+            {
+                Event* next = event->timing_wheel_hook().next;
+                event->timing_wheel_hook().linked = false;
+                --size_;
+                expired.push_back(event);
+                event = next;
+            }
+            move_to(current_tick_ + 1u);
+        }
+    }
+
+    /**
+     * Get the point in time at which the wheel should be advanced next.
+     * It is the expiry of the next event when it is on the first level, or the start of the next turn of the lowest
+     * level with events otherwise.
+     * @return Point in time to advance the wheel to, or clock::time_point::max() when the wheel is empty.
+     */
+    clock::time_point next_expiry() const
+    {
+        if (0u == size_)
+        {
+            return clock::time_point::max();
+        }
+
+        uint64_t tick = next_turn();
+        if (0u < counts_[0])
+        {
+            for (uint64_t t = current_tick_; t < tick; ++t)
+            {
+                if (nullptr != buckets_[slot_of(t, 0u)])
+                {
+                    tick = t;
+                    break;
+                }
+            }
+        }
+
+        return origin_ + std::chrono::duration_cast<clock::duration>(tick_duration * tick);
+    }
+
+private:
+
+    static constexpr uint32_t slot_bits = 8u;
+    static constexpr uint32_t num_slots = 1u << slot_bits;
+    static constexpr uint64_t slot_mask = num_slots - 1u;
+    static constexpr uint32_t num_levels = 4u;
+    //! Bucket for the events beyond the last level, placed again when the last level completes a turn
+    static constexpr uint32_t overflow_bucket = num_levels * num_slots;
+
+    uint64_t floor_tick(
+            const clock::time_point& time) const
+    {
+        if (time <= origin_)
+        {
+            return 0u;
+        }
+        return static_cast<uint64_t>((time - origin_) / tick_duration);
+    }
+
+    uint64_t ceil_tick(
+            const clock::time_point& time) const
+    {
+        if (time <= origin_)
+        {
+            return 0u;
+        }
+        clock::duration tick = std::chrono::duration_cast<clock::duration>(tick_duration);
+        return static_cast<uint64_t>(((time - origin_) + tick - clock::duration(1)) / tick);
+    }
+
+    static uint32_t slot_of(
+            uint64_t tick,
+            uint32_t level)
+    {
+        return (level * num_slots) + static_cast<uint32_t>((tick >> (level * slot_bits)) & slot_mask);
+    }
+
+    static uint32_t level_of(
+            uint32_t bucket)
+    {
+        return bucket / num_slots;
+    }
+
+    /**
+     * Get the next tick on which the events of the lowest level with events may need to be collected or placed again.
+     * That is the end of the current turn of the first level when it has events, or the end of the current slot of
+     * the lowest level with events otherwise.
+     */
+    uint64_t next_turn() const
+    {
+        uint32_t level = 0u;
+        while (level < num_levels && 0u == counts_[level])
+        {
+            ++level;
+        }
+        uint64_t turn_mask = (uint64_t(1) << ((std::max)(level, 1u) * slot_bits)) - 1u;
+        return (current_tick_ | turn_mask) + 1u;
+    }
+
+    /**
+     * Get whether a tick is the first one of a turn of a level.
+     */
+    static bool starts_turn(
+            uint64_t tick,
+            uint32_t level)
+    {
+        return 0u == (tick & ((uint64_t(1) << ((level + 1u) * slot_bits)) - 1u));
+    }
+
+    /**
+     * Link an event on the lowest level whose current turn includes its expiry tick.
+     */
+    void place(
+            Event* event)
+    {
+        TimingWheelHook<Event>& hook = event->timing_wheel_hook();
+        hook.bucket = overflow_bucket;
+        for (uint32_t level = 0; level < num_levels; ++level)
+        {
+            uint32_t shift = (level + 1u) * slot_bits;
+            if ((hook.expiry_tick >> shift) == (current_tick_ >> shift))
+            {
+                hook.bucket = slot_of(hook.expiry_tick, level);
+                break;
+            }
+        }
+
+        Event*& head = buckets_[hook.bucket];
+        hook.prev = nullptr;
+        hook.next = head;
+        if (nullptr != head)
+        {
+            head->timing_wheel_hook().prev = event;
+        }
+        head = event;
+        hook.linked = true;
+        ++counts_[level_of(hook.bucket)];
+    }
+
+    void unlink(
+            Event* event)
+    {
+        TimingWheelHook<Event>& hook = event->timing_wheel_hook();
+        if (nullptr != hook.prev)
+        {
+            hook.prev->timing_wheel_hook().next = hook.next;
+        }
+        else
+        {
+            buckets_[hook.bucket] = hook.next;
+        }
+        if (nullptr != hook.next)
+        {
+            hook.next->timing_wheel_hook().prev = hook.prev;
+        }
+
+        hook.prev = nullptr;
+        hook.next = nullptr;
+        hook.linked = false;
+        --counts_[level_of(hook.bucket)];
+    }
+
+    /**
+     * Take all the events of a bucket.
+     * @return First event of the list, whose events are still marked as linked.
+     */
+    Event* detach(
+            uint32_t bucket)
+    {
+        Event* head = buckets_[bucket];
+        buckets_[bucket] = nullptr;
+        for (Event* event = head; nullptr != event; event = event->timing_wheel_hook().next)
+        {
+            --counts_[level_of(bucket)];
+        }
+        return head;
+    }
+
+    /**
+     * Move to a tick, placing again the events of the slots of the levels whose turn starts on it, from the top level.
+     */
+    void move_to(
+            uint64_t tick)
+    {
+        current_tick_ = tick;
+        if (!starts_turn(current_tick_, 0u))
+        {
+            return;
+        }
+
+        uint32_t top_level = 1u;
+        while (top_level < num_levels && starts_turn(current_tick_, top_level))
+        {
+            ++top_level;
+        }
+
+        if (num_levels == top_level)
+        {
+            replace(overflow_bucket);
+        }
+        for (uint32_t level = (std::min)(top_level, num_levels - 1u); 0u < level; --level)
+        {
+            replace(slot_of(current_tick_, level));
+        }
+    }
+
+    void replace(
+            uint32_t bucket)
+    {
+        Event* event = detach(bucket);
+        while (nullptr != event)
+        {
+            Event* next = event->timing_wheel_hook().next;
+            place(event);
+            event = next;
+        }
+    }
+
+    //! Point in time of tick 0
+    clock::time_point origin_;
+    //! First tick not processed yet, whose events are already on the first level
+    uint64_t current_tick_ = 0u;
+    //! Number of events on the wheel
+    size_t size_ = 0u;
+    //! First event of each bucket
+    std::array<Event*, overflow_bucket + 1u> buckets_;
+    //! Number of events on each level, with the overflow bucket counted on an extra one
+    std::array<size_t, num_levels + 1u> counts_;
+};
+
+template<class Event>
+constexpr std::chrono::microseconds TimingWheel<Event>::tick_duration;
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif //_FASTDDS_RTPS_RESOURCES_TIMINGWHEEL_HPP_
@@ -15,12 +15,15 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 
+#include <functional>
+
 #include <asio.hpp>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastdds/rtps/transport/TransportReceiverInterface.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <rtps/transport/ChannelResource.h>
 #include <rtps/transport/tcp/RTCPMessageManager.h>
+#include <rtps/transport/tcp/TCPMessageAssembler.h>
 
 
 namespace eprosima {
@@ -74,9 +77,17 @@ protected:
     std::mutex read_mutex_;
     std::recursive_mutex pending_logical_mutex_;
     std::atomic<eConnectionStatus> connection_status_;
+    // Only used when the channel is served by the reactor threads of the transport.
+    // Assembles the incoming messages of the current connection.
+    TCPMessageAssembler message_assembler_;
+    // Identifies the current connection, so reads completed for a previous one are discarded.
+    std::atomic<uint32_t> reactor_connection_id_{0};
 
 public:
 
+    //! Handler of the completion of an asynchronous read.
+    using ReadHandler = std::function<void (const asio::error_code&, std::size_t)>;
+
     void add_logical_port(
             uint16_t port,
             RTCPMessageManager* rtcp_manager);
@@ -137,6 +148,19 @@ public:
             std::size_t size,
             asio::error_code& ec) = 0;
 
+    /**
+     * Starts reading the bytes available on the TCP channel, without waiting for the buffer to be filled.
+     * The handler will be called from one of the threads running the io_service of the channel.
+     *
+     * @param buffer Where the bytes read will be stored. Must be valid until the handler is called.
+     * @param size Maximum number of bytes to read.
+     * @param handler Handler called with the result of the read and the number of bytes read.
+     */
+    virtual void async_read_some(
+            octet* buffer,
+            std::size_t size,
+            ReadHandler handler) = 0;
+
     /**
      * Sends the provided TCP header and data over the TCP channel.
      * Used solely during TCP connection negotiations.
@@ -138,6 +138,26 @@ uint32_t TCPChannelResourceBasic::read(
     return 0;
 }
 
+void TCPChannelResourceBasic::async_read_some(
+        octet* buffer,
+        std::size_t size,
+        ReadHandler handler)
+{
+    std::unique_lock<std::mutex> read_lock(read_mutex_);
+
+    if (eConnecting < connection_status_)
+    {
+        socket_->async_read_some(asio::buffer(buffer, size), std::move(handler));
+    }
+    else
+    {
+        service_.post([handler]()
+                {
+                    handler(asio::error::not_connected, 0);
+                });
+    }
+}
+
 size_t TCPChannelResourceBasic::send(
         const octet* header,
         size_t header_size,
@@ -157,8 +177,9 @@ size_t TCPChannelResourceBasic::send(
             return 0;
         }
 
-        // Use a list of const_buffers to send the message
-        std::list<asio::const_buffer> asio_buffers;
+        // Gather the header and the buffers of the message, without copying them
+        std::vector<asio::const_buffer> asio_buffers;
+        asio_buffers.reserve(buffers.size() + 1);
         if (header_size > 0)
         {
             asio_buffers.push_back(asio::buffer(header, header_size));
@@ -196,6 +196,26 @@ uint32_t TCPChannelResourceSecure::read(
     return static_cast<uint32_t>(bytes_read);
 }
 
+void TCPChannelResourceSecure::async_read_some(
+        octet* buffer,
+        std::size_t size,
+        ReadHandler handler)
+{
+    auto socket = secure_socket_;
+
+    strand_read_.post([buffer, size, handler, socket]()
+            {
+                if (socket->lowest_layer().is_open())
+                {
+                    socket->async_read_some(asio::buffer(buffer, size), handler);
+                }
+                else
+                {
+                    handler(asio::error::not_connected, 0);
+                }
+            });
+}
+
 size_t TCPChannelResourceSecure::send(
         const octet* header,
         size_t header_size,
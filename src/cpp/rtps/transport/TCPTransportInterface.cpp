@@ -95,6 +95,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , check_crc(true)
     , apply_security(false)
     , non_blocking_send(false)
+    , reactor_threads(0)
 {
 }
 
@@ -116,6 +117,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
     , non_blocking_send(t.non_blocking_send)
+    , reactor_threads(t.reactor_threads)
 {
 }
 
@@ -138,6 +140,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
     non_blocking_send = t.non_blocking_send;
+    reactor_threads = t.reactor_threads;
     return *this;
 }
 
@@ -159,6 +162,7 @@ bool TCPTransportDescriptor::operator ==(
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->reactor_threads == t.reactor_threads &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -243,6 +247,15 @@ void TCPTransportInterface::clean()
         io_service_.stop();
         io_service_thread_.join();
     }
+
+    for (auto& reactor_thread : io_service_reactor_threads_)
+    {
+        if (reactor_thread.joinable())
+        {
+            reactor_thread.join();
+        }
+    }
+    io_service_reactor_threads_.clear();
 }
 
 Locator TCPTransportInterface::remote_endpoint_to_locator(
@@ -535,6 +548,13 @@ bool TCPTransportInterface::init(
             };
     io_service_thread_ = create_thread(ioServiceFunction, configuration()->accept_thread, "dds.tcp_accept");
 
+    // Connections are read without blocking by a pool of threads running io_service_ along with the accept thread
+    for (uint32_t i = 0; i < configuration()->reactor_threads; ++i)
+    {
+        io_service_reactor_threads_.push_back(create_thread(ioServiceFunction,
+                configuration()->default_reception_threads(), "dds.tcp_rx.%u", i));
+    }
+
     if (0 < configuration()->keep_alive_frequency_ms)
     {
         auto ioServiceTimersFunction = [&]()
@@ -1077,6 +1097,13 @@ void TCPTransportInterface::keep_alive()
 void TCPTransportInterface::create_listening_thread(
         const std::shared_ptr<TCPChannelResource>& channel)
 {
+    if (!io_service_reactor_threads_.empty() && !configuration()->apply_security)
+    {
+        // The channel is served by the reactor threads instead
+        start_reactor_operation(channel);
+        return;
+    }
+
     std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
     auto fn = [this, channel_weak_ptr, rtcp_manager_weak_ptr]()
@@ -1088,15 +1115,13 @@ void TCPTransportInterface::create_listening_thread(
     channel->thread(create_thread(fn, thr_config, "dds.tcp.%u", port));
 }
 
-void TCPTransportInterface::perform_listen_operation(
-        std::weak_ptr<TCPChannelResource> channel_weak,
-        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+std::shared_ptr<TCPChannelResource> TCPTransportInterface::prepare_listen_operation(
+        const std::weak_ptr<TCPChannelResource>& channel_weak,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        Locator& remote_locator)
 {
-    Locator remote_locator;
-    uint16_t logicalPort(0);
-    std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
     std::shared_ptr<TCPChannelResource> channel;
-    rtcp_message_manager = rtcp_manager.lock();
+    std::shared_ptr<RTCPMessageManager> rtcp_message_manager = rtcp_manager.lock();
 
     // RTCP Control Message
     if (rtcp_message_manager)
@@ -1121,11 +1146,23 @@ void TCPTransportInterface::perform_listen_operation(
         rtcp_message_manager.reset();
         rtcp_message_manager_cv_.notify_one();
     }
-    else
+
+    return channel;
+}
+
+void TCPTransportInterface::perform_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+{
+    Locator remote_locator;
+
+    if (rtcp_manager.expired())
     {
         return;
     }
 
+    std::shared_ptr<TCPChannelResource> channel = prepare_listen_operation(channel_weak, rtcp_manager, remote_locator);
+
     while (channel && TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
     {
         // Blocking receive.
@@ -1136,32 +1173,152 @@ void TCPTransportInterface::perform_listen_operation(
             continue;
         }
 
-        if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+        deliver_received_message(channel, msg, remote_locator);
+    }
+
+    EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+void TCPTransportInterface::deliver_received_message(
+        const std::shared_ptr<TCPChannelResource>& channel,
+        CDRMessage_t& msg,
+        const Locator& remote_locator)
+{
+    if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+    {
+        // Processes the data through the CDR Message interface.
+        uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+        std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+        auto it = receiver_resources_.find(logicalPort);
+        if (it != receiver_resources_.end())
+        {
+            TransportReceiverInterface* receiver = it->second.first;
+            ReceiverInUseCV* receiver_in_use = it->second.second;
+            receiver_in_use->in_use++;
+            scopedLock.unlock();
+            receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
+            scopedLock.lock();
+            receiver_in_use->in_use--;
+            receiver_in_use->cv.notify_one();
+        }
+        else
         {
-            // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            if (it != receiver_resources_.end())
-            {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use++;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use--;
-                receiver_in_use->cv.notify_one();
-            }
-            else
+            EPROSIMA_LOG_WARNING(RTCP,
+                    "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+        }
+    }
+}
+
+void TCPTransportInterface::start_reactor_operation(
+        const std::shared_ptr<TCPChannelResource>& channel)
+{
+    std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
+    std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
+    Locator remote_locator;
+
+    uint32_t connection_id = ++channel->reactor_connection_id_;
+    channel->message_assembler_.reset();
+
+    if (prepare_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr, remote_locator))
+    {
+        async_receive(channel, connection_id, rtcp_manager_weak_ptr, remote_locator);
+    }
+}
+
+void TCPTransportInterface::async_receive(
+        const std::shared_ptr<TCPChannelResource>& channel,
+        uint32_t connection_id,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        const Locator& remote_locator)
+{
+    if (TCPChannelResource::eConnectionStatus::eConnecting >= channel->connection_status())
+    {
+        EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
+        return;
+    }
+
+    CDRMessage_t& msg = channel->message_buffer();
+    octet* data = nullptr;
+    std::size_t size = 0;
+    channel->message_assembler_.prepare(msg.buffer, msg.max_size, data, size);
+
+    // The handler keeps the channel alive until the read completes, as the blocking reception thread would do.
+    std::shared_ptr<TCPChannelResource> channel_ptr = channel;
+    Locator locator = remote_locator;
+    channel->async_read_some(data, size,
+            [this, channel_ptr, connection_id, rtcp_manager, locator](
+                const asio::error_code& ec,
+                std::size_t bytes_received)
             {
-                EPROSIMA_LOG_WARNING(RTCP,
-                        "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
-            }
+                std::shared_ptr<TCPChannelResource> channel = channel_ptr;
+                Locator remote_locator = locator;
+                on_async_receive(channel, connection_id, rtcp_manager, remote_locator, ec, bytes_received);
+            });
+}
+
+void TCPTransportInterface::on_async_receive(
+        std::shared_ptr<TCPChannelResource>& channel,
+        uint32_t connection_id,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        Locator& remote_locator,
+        const asio::error_code& ec,
+        std::size_t bytes_received)
+{
+    if (connection_id != channel->reactor_connection_id_)
+    {
+        // The channel reconnected, and this read belongs to the previous connection
+        return;
+    }
+
+    if (ec)
+    {
+        if (ec != asio::error::eof && ec != asio::error::operation_aborted &&
+                TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+        {
+            EPROSIMA_LOG_WARNING(DEBUG, "Failed to read TCP channel: " << ec.message());
         }
+        close_tcp_socket(channel);
+        return;
     }
 
-    EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
+    try
+    {
+        CDRMessage_t& msg = channel->message_buffer();
+        TCPMessageAssembler& assembler = channel->message_assembler_;
+
+        switch (assembler.commit(bytes_received, msg.max_size, msg.msg_endian))
+        {
+            case TCPMessageAssembler::Result::MESSAGE_TOO_BIG:
+                EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                        << assembler.body_size() << " vs. " << msg.max_size << ". "
+                        << "The full message will be dropped.");
+                break;
+
+            case TCPMessageAssembler::Result::MESSAGE_READY:
+                EPROSIMA_LOG_INFO(RTCP_MSG_IN, "Received RTCP MSG. Logical Port " << assembler.header().logical_port);
+                msg.pos = 0;
+                msg.length = assembler.body_size();
+                if (process_received_message(rtcp_manager, channel, assembler.header(), msg.buffer, msg.length,
+                        msg.msg_endian, remote_locator) && msg.length > 0)
+                {
+                    deliver_received_message(channel, msg, remote_locator);
+                }
+                break;
+
+            case TCPMessageAssembler::Result::INCOMPLETE:
+                break;
+        }
+    }
+    catch (const asio::system_error& error)
+    {
+        (void)error;
+        // Close the channel
+        EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "ASIO SYSTEM_ERROR [RECEIVE]: " << error.what());
+        close_tcp_socket(channel);
+        return;
+    }
+
+    async_receive(channel, connection_id, rtcp_manager, remote_locator);
 }
 
 bool TCPTransportInterface::read_body(
@@ -1338,54 +1495,8 @@ bool TCPTransportInterface::Receive(
 
                 if (success)
                 {
-                    if (configuration()->check_crc
-                            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                    {
-                        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
-                    }
-
-                    if (tcp_header.logical_port == 0)
-                    {
-                        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-                        {
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager = rtcp_manager.lock();
-                        }
-
-                        if (rtcp_message_manager)
-                        {
-                            // The channel is not going to be deleted because we lock it for reading.
-                            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                channel, receive_buffer, body_size, msg_endian);
-
-                            if (responseCode != RETCODE_OK)
-                            {
-                                close_tcp_socket(channel);
-                            }
-                            success = false;
-
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager.reset();
-                            rtcp_message_manager_cv_.notify_one();
-                        }
-                        else
-                        {
-                            success = false;
-                            close_tcp_socket(channel);
-                        }
-
-                    }
-                    else
-                    {
-                        if (!IsLocatorValid(remote_locator))
-                        {
-                            remote_locator = remote_endpoint_to_locator(channel);
-                        }
-                        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                          << " - " << receive_buffer_size << " bytes.");
-                    }
+                    success = process_received_message(rtcp_manager, channel, tcp_header, receive_buffer,
+                                    receive_buffer_size, msg_endian, remote_locator);
                 }
                 // Error message already shown by read_body method.
             }
@@ -1417,6 +1528,69 @@ bool TCPTransportInterface::Receive(
     return success;
 }
 
+bool TCPTransportInterface::process_received_message(
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        fastdds::rtps::Endianness_t msg_endian,
+        Locator& remote_locator)
+{
+    bool success = true;
+
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size, msg_endian);
+
+            if (responseCode != RETCODE_OK)
+            {
+                close_tcp_socket(channel);
+            }
+            success = false;
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            success = false;
+            close_tcp_socket(channel);
+        }
+
+    }
+    else
+    {
+        if (!IsLocatorValid(remote_locator))
+        {
+            remote_locator = remote_endpoint_to_locator(channel);
+        }
+        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                                          << " - " << receive_buffer_size << " bytes.");
+    }
+
+    return success;
+}
+
 bool TCPTransportInterface::send(
         const std::vector<NetworkBuffer>& buffers,
         uint32_t total_bytes,
@@ -91,6 +91,8 @@ protected:
 #endif // if TLS_FOUND
     eprosima::thread io_service_thread_;
     eprosima::thread io_service_timers_thread_;
+    // Additional threads running io_service_ when connections are served by a reactor pool
+    std::vector<eprosima::thread> io_service_reactor_threads_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -179,6 +181,62 @@ protected:
             std::shared_ptr<TCPChannelResource>& channel,
             std::size_t body_size);
 
+    /**
+     * Sends the connection request of an outgoing channel, or waits for the bind request of an incoming one, before
+     * its reception starts.
+     *
+     * @param channel_weak Channel whose reception is starting.
+     * @param rtcp_manager RTCP message manager of the transport.
+     * @param remote_locator Filled with the remote locator of the channel.
+     * @return The channel, or nullptr if the transport is being destroyed.
+     */
+    std::shared_ptr<TCPChannelResource> prepare_listen_operation(
+            const std::weak_ptr<TCPChannelResource>& channel_weak,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            Locator& remote_locator);
+
+    /**
+     * Processes a complete message received on a channel.
+     * RTCP control messages are processed here, and RTPS messages get the logical port of their header set on
+     * @c remote_locator.
+     *
+     * @return true when the message is an RTPS message that has to be delivered to the receivers.
+     */
+    bool process_received_message(
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            fastdds::rtps::Endianness_t msg_endian,
+            Locator& remote_locator);
+
+    //! Delivers an RTPS message received on a channel to the receiver of its logical port.
+    void deliver_received_message(
+            const std::shared_ptr<TCPChannelResource>& channel,
+            CDRMessage_t& msg,
+            const Locator& remote_locator);
+
+    //! Starts serving a channel from the reactor threads.
+    void start_reactor_operation(
+            const std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Issues a non-blocking read of the next bytes of the message being assembled on a channel.
+    void async_receive(
+            const std::shared_ptr<TCPChannelResource>& channel,
+            uint32_t connection_id,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            const Locator& remote_locator);
+
+    //! Handles the completion of a read issued by async_receive().
+    void on_async_receive(
+            std::shared_ptr<TCPChannelResource>& channel,
+            uint32_t connection_id,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            Locator& remote_locator,
+            const asio::error_code& ec,
+            std::size_t bytes_received);
+
     virtual void set_receive_buffer_size(
             uint32_t size) = 0;
     virtual void set_send_buffer_size(
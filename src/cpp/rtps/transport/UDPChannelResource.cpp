@@ -14,8 +14,16 @@
 
 #include <rtps/transport/UDPChannelResource.h>
 
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
 #include <asio.hpp>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 #include <rtps/messages/MessageReceiver.h>
@@ -42,6 +50,7 @@ UDPChannelResource::UDPChannelResource(
     , only_multicast_purpose_(false)
     , interface_(sInterface)
     , transport_(transport)
+    , receive_batch_size_(transport->configuration()->receive_batch_size)
 {
     auto fn = [this, locator]()
             {
@@ -61,6 +70,15 @@ UDPChannelResource::~UDPChannelResource()
 void UDPChannelResource::perform_listen_operation(
         Locator input_locator)
 {
+#if defined(__linux__)
+    if (receive_batch_size_ > 1)
+    {
+        perform_batched_listen_operation(input_locator);
+        message_receiver(nullptr);
+        return;
+    }
+#endif // if defined(__linux__)
+
     Locator remote_locator;
 
     while (alive())
@@ -86,6 +104,84 @@ void UDPChannelResource::perform_listen_operation(
     message_receiver(nullptr);
 }
 
+void UDPChannelResource::perform_batched_listen_operation(
+        const Locator& input_locator)
+{
+#if defined(__linux__)
+    const uint32_t batch_size = receive_batch_size_;
+    const size_t buffer_capacity = message_buffer().max_size;
+
+    // Ring of receive buffers, together with the per-datagram descriptors handed to the kernel.
+    // Everything is allocated once, before entering the listening loop.
+    std::vector<octet> buffers(batch_size * buffer_capacity);
+    std::vector<struct iovec> iovecs(batch_size);
+    std::vector<struct sockaddr_storage> addresses(batch_size);
+    std::vector<struct mmsghdr> headers(batch_size);
+    for (uint32_t i = 0; i < batch_size; ++i)
+    {
+        iovecs[i].iov_base = &buffers[i * buffer_capacity];
+        iovecs[i].iov_len = buffer_capacity;
+        std::memset(&headers[i], 0, sizeof(struct mmsghdr));
+        headers[i].msg_hdr.msg_name = &addresses[i];
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    asio::ip::udp::endpoint sender_endpoint;
+    Locator remote_locator;
+
+    while (alive())
+    {
+        for (uint32_t i = 0; i < batch_size; ++i)
+        {
+            headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+        }
+
+        // Block until at least one datagram is available, then take whatever else is already queued.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), batch_size, MSG_WAITFORONE, nullptr);
+        if (received < 0)
+        {
+            if (EINTR != errno && alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "Error receiving data: " << std::strerror(errno) << " - "
+                                                                            << message_receiver() << " (" << this << ")");
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received && alive(); ++i)
+        {
+            octet* data = static_cast<octet*>(iovecs[i].iov_base);
+            uint32_t length = static_cast<uint32_t>(headers[i].msg_len);
+            socklen_t address_length = headers[i].msg_hdr.msg_namelen;
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (0 == length || (13 == length && 0 == memcmp(data, "EPRORTPSCLOSE", 13)) ||
+                    address_length > sender_endpoint.capacity())
+            {
+                continue;
+            }
+
+            std::memcpy(sender_endpoint.data(), &addresses[i], address_length);
+            sender_endpoint.resize(address_length);
+            transport_->endpoint_to_locator(sender_endpoint, remote_locator);
+
+            // Processes the data through the CDR Message interface.
+            if (message_receiver() != nullptr)
+            {
+                message_receiver()->OnDataReceived(data, length, input_locator, remote_locator);
+            }
+            else if (alive())
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        }
+    }
+#else
+    static_cast<void>(input_locator);
+#endif // if defined(__linux__)
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
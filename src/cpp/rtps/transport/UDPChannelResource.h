@@ -227,6 +227,15 @@ protected:
     void perform_listen_operation(
             Locator input_locator);
 
+    /**
+     * Listening loop used when batched reception is enabled.
+     * Drains up to receive_batch_size datagrams per system call into a set of preallocated buffers,
+     * and then dispatches them to the message receiver in arrival order.
+     * @param input_locator - Locator that triggered the creation of the resource
+     */
+    void perform_batched_listen_operation(
+            const Locator& input_locator);
+
     /**
      * Blocking Receive from the specified channel.
      * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
@@ -248,6 +257,8 @@ private:
     bool only_multicast_purpose_;
     std::string interface_;
     UDPTransportInterface* transport_;
+    //! Maximum number of datagrams to receive on each system call
+    uint32_t receive_batch_size_;
 
     UDPChannelResource(
             const UDPChannelResource&) = delete;
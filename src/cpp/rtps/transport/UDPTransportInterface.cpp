@@ -15,6 +15,7 @@
 #include <rtps/transport/UDPTransportInterface.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <cstring>
 #include <limits>
@@ -37,6 +38,10 @@ namespace rtps {
 
 using Log = fastdds::dds::Log;
 
+// Maximum number of messages the kernel accepts on a single recvmmsg/sendmmsg call (UIO_MAXIOV)
+static constexpr uint32_t s_maximum_receive_batch_size = 1024;
+static constexpr uint32_t s_maximum_send_batch_size = 1024;
+
 UDPTransportDescriptor::UDPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
     , m_output_udp_socket(0)
@@ -48,6 +53,8 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->receive_batch_size == t.receive_batch_size &&
+           this->send_batch_size == t.send_batch_size &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -152,6 +159,32 @@ bool UDPTransportInterface::init(
         return false;
     }
 
+    if (configuration()->receive_batch_size > s_maximum_receive_batch_size)
+    {
+        EPROSIMA_LOG_ERROR(TRANSPORT_UDP, "receive_batch_size cannot be greater than " << s_maximum_receive_batch_size);
+        return false;
+    }
+
+    if (configuration()->send_batch_size > s_maximum_send_batch_size)
+    {
+        EPROSIMA_LOG_ERROR(TRANSPORT_UDP, "send_batch_size cannot be greater than " << s_maximum_send_batch_size);
+        return false;
+    }
+
+#if !defined(__linux__)
+    if (configuration()->receive_batch_size > 1)
+    {
+        EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "Batched reception is not supported on this platform. "
+                << "Datagrams will be received one at a time");
+    }
+
+    if (configuration()->send_batch_size > 1)
+    {
+        EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "Batched sending is not supported on this platform. "
+                << "Datagrams will be sent one at a time");
+    }
+#endif // if !defined(__linux__)
+
     asio::error_code ec;
     ip::udp::socket socket(io_service_);
     socket.open(generate_protocol(), ec);
@@ -502,6 +535,14 @@ bool UDPTransportInterface::send(
     auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
         max_blocking_time_point - std::chrono::steady_clock::now());
 
+#if defined(__linux__)
+    if (configuration()->send_batch_size > 1)
+    {
+        return send_batch(buffers, total_bytes, socket, it, *destination_locators_end, only_multicast_purpose,
+                       whitelisted, time_out);
+    }
+#endif // if defined(__linux__)
+
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
@@ -596,6 +637,156 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+#if defined(__linux__)
+bool UDPTransportInterface::send_batch(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        LocatorsIterator& destination_locators_begin,
+        LocatorsIterator& destination_locators_end,
+        bool only_multicast_purpose,
+        bool whitelisted,
+        const std::chrono::microseconds& timeout)
+{
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    const size_t batch_size = configuration()->send_batch_size;
+    const size_t num_buffers = buffers.size();
+    assert(0 < num_buffers);
+
+    // Every datagram of the batch references the same buffers. Only the trailing statistics submessage, which is
+    // stamped for each destination, needs its own copy.
+    size_t tail_size = 0;
+#ifdef FASTDDS_STATISTICS
+    if (statistics::rtps::is_statistics_buffer(buffers.back()))
+    {
+        tail_size = buffers.back().size;
+    }
+#endif // ifdef FASTDDS_STATISTICS
+
+    batch_endpoints_.resize(batch_size);
+    batch_iovecs_.resize(batch_size * num_buffers);
+    batch_headers_.resize(batch_size);
+    batch_tails_.resize(batch_size * tail_size);
+
+    struct timeval timeStruct;
+    timeStruct.tv_sec = 0;
+    timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
+    setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
+            reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+
+    bool ret = true;
+    size_t pending = 0;
+
+    for (LocatorsIterator& it = destination_locators_begin; it != destination_locators_end; ++it)
+    {
+        const Locator& remote_locator = *it;
+
+        if (!IsLocatorSupported(remote_locator))
+        {
+            continue;
+        }
+
+        bool is_multicast_remote_address = IPLocator::isMulticast(remote_locator);
+        if (is_multicast_remote_address != only_multicast_purpose && !whitelisted)
+        {
+            ret = false;
+            continue;
+        }
+
+        if (!is_multicast_remote_address && socket.should_filter(remote_locator))
+        {
+            // Filter unicast remote locators according to socket conditions (e.g. netmask filtering)
+            continue;
+        }
+
+        // Fill the scatter-gather description of the datagram for this destination
+        batch_endpoints_[pending] = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+        struct iovec* iovecs = &batch_iovecs_[pending * num_buffers];
+        for (size_t i = 0; i < num_buffers; ++i)
+        {
+            iovecs[i].iov_base = const_cast<void*>(buffers[i].buffer);
+            iovecs[i].iov_len = buffers[i].size;
+        }
+
+        if (0 < tail_size)
+        {
+            octet* tail = &batch_tails_[pending * tail_size];
+            memcpy(tail, buffers.back().buffer, tail_size);
+            iovecs[num_buffers - 1].iov_base = tail;
+            statistics_info_.set_statistics_message_data(remote_locator,
+                    NetworkBuffer(tail, static_cast<uint32_t>(tail_size)), total_bytes);
+        }
+        else
+        {
+            statistics_info_.set_statistics_message_data(remote_locator, buffers.back(), total_bytes);
+        }
+
+        struct mmsghdr& header = batch_headers_[pending];
+        memset(&header, 0, sizeof(struct mmsghdr));
+        header.msg_hdr.msg_name = batch_endpoints_[pending].data();
+        header.msg_hdr.msg_namelen = static_cast<socklen_t>(batch_endpoints_[pending].size());
+        header.msg_hdr.msg_iov = iovecs;
+        header.msg_hdr.msg_iovlen = num_buffers;
+
+        if (++pending == batch_size)
+        {
+            ret &= flush_send_batch(socket, pending);
+            pending = 0;
+        }
+    }
+
+    if (0 < pending)
+    {
+        ret &= flush_send_batch(socket, pending);
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::flush_send_batch(
+        eProsimaUDPSocket& socket,
+        size_t count)
+{
+    bool ret = true;
+    size_t sent = 0;
+
+    while (sent < count)
+    {
+        int result = sendmmsg(getSocketPtr(socket)->native_handle(), &batch_headers_[sent],
+                        static_cast<unsigned int>(count - sent), 0);
+        if (0 <= result)
+        {
+            sent += static_cast<size_t>(result);
+            continue;
+        }
+
+        if (EAGAIN == errno || EWOULDBLOCK == errno)
+        {
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, "UDP send would have blocked. "
+                    << (count - sent) << " packets are dropped.");
+            break;
+        }
+
+        if (EINTR != errno)
+        {
+            // Skip the datagram that could not be sent and carry on with the rest of the batch
+            EPROSIMA_LOG_WARNING(TRANSPORT_UDP, std::strerror(errno));
+            ret = false;
+            ++sent;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(TRANSPORT_UDP,
+            "UDPTransport: " << count << " datagrams sent in batch FROM " << getSocketPtr(socket)->local_endpoint());
+    return ret;
+}
+
+#endif // if defined(__linux__)
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -22,6 +22,10 @@
 
 #include <asio.hpp>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif // if defined(__linux__)
+
 #include <fastdds/rtps/common/LocatorWithMask.hpp>
 #include <fastdds/rtps/transport/network/AllowedNetworkInterface.hpp>
 #include <fastdds/rtps/transport/network/NetmaskFilterKind.hpp>
@@ -292,6 +296,31 @@ protected:
             bool whitelisted,
             const std::chrono::microseconds& timeout);
 
+#if defined(__linux__)
+    /**
+     * Send a vector of buffers to several destinations, handing up to send_batch_size datagrams
+     * to the kernel on each system call.
+     *
+     * Follows the same filtering rules as the single destination send.
+     */
+    bool send_batch(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            LocatorsIterator& destination_locators_begin,
+            LocatorsIterator& destination_locators_end,
+            bool only_multicast_purpose,
+            bool whitelisted,
+            const std::chrono::microseconds& timeout);
+
+    /**
+     * Send the first @c count datagrams prepared on batch_headers_.
+     */
+    bool flush_send_batch(
+            eProsimaUDPSocket& socket,
+            size_t count);
+#endif // if defined(__linux__)
+
     /**
      * @brief Return list of not yet open network interfaces
      *
@@ -306,6 +335,15 @@ protected:
 
     std::atomic_bool rescan_interfaces_ = {true};
 
+#if defined(__linux__)
+    // Scratch storage for batched sends.
+    // As statistics_info_, it relies on sends being serialized by the owner of the transport.
+    std::vector<asio::ip::udp::endpoint> batch_endpoints_;
+    std::vector<struct iovec> batch_iovecs_;
+    std::vector<struct mmsghdr> batch_headers_;
+    std::vector<octet> batch_tails_;
+#endif // if defined(__linux__)
+
 };
 
 } // namespace rtps
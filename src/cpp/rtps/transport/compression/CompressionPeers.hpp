@@ -0,0 +1,173 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONPEERS_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONPEERS_HPP_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/LocatorsIterator.hpp>
+
+#include <utils/shared_mutex.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Remote locators which receive compressed messages.
+ *
+ * A participant with compression transports announces in discovery the locator kinds on which it receives
+ * compressed messages. Its unicast locators of those kinds are added here when it is discovered, and removed when it
+ * is gone. Messages sent to any other locator, including multicast ones, are not compressed, so participants without
+ * a compression transport still receive them.
+ *
+ * Compression transports derive from this class, so the network factory reaches them without depending on the
+ * transport itself.
+ */
+class CompressionPeers
+{
+public:
+
+    virtual ~CompressionPeers() = default;
+
+    /**
+     * Start compressing the messages sent to a remote participant.
+     *
+     * @param locators Unicast locators of the remote participant.
+     * @param kinds Locator kinds on which the remote participant receives compressed messages, as announced by it.
+     */
+    void add_peer(
+            const LocatorList& locators,
+            const std::string& kinds)
+    {
+        std::lock_guard<shared_mutex> lock(peers_mutex_);
+        for (const Locator& locator : locators)
+        {
+            if (is_kind_announced(locator.kind, kinds))
+            {
+                ++peers_[locator];
+            }
+        }
+    }
+
+    /**
+     * Stop compressing the messages sent to a remote participant.
+     *
+     * @param locators Unicast locators of the remote participant.
+     * @param kinds Locator kinds on which the remote participant receives compressed messages, as announced by it.
+     */
+    void remove_peer(
+            const LocatorList& locators,
+            const std::string& kinds)
+    {
+        std::lock_guard<shared_mutex> lock(peers_mutex_);
+        for (const Locator& locator : locators)
+        {
+            if (is_kind_announced(locator.kind, kinds))
+            {
+                auto it = peers_.find(locator);
+                if (peers_.end() != it && 0 == --it->second)
+                {
+                    peers_.erase(it);
+                }
+            }
+        }
+    }
+
+    /**
+     * Split the destinations of a message between the ones which receive it compressed and the rest.
+     *
+     * @param [in,out] begin Iterator to the first destination. It is moved up to @c end.
+     * @param [in] end Iterator past the last destination.
+     * @param [out] compressed Destinations which receive compressed messages.
+     * @param [out] plain Destinations which do not.
+     */
+    void split_destinations(
+            LocatorsIterator& begin,
+            const LocatorsIterator& end,
+            std::vector<Locator>& compressed,
+            std::vector<Locator>& plain) const
+    {
+        compressed.clear();
+        plain.clear();
+
+        shared_lock<shared_mutex> lock(peers_mutex_);
+        for (; begin != end; ++begin)
+        {
+            const Locator& locator = *begin;
+            if (peers_.end() != peers_.find(locator))
+            {
+                compressed.push_back(locator);
+            }
+            else
+            {
+                plain.push_back(locator);
+            }
+        }
+    }
+
+    /**
+     * Format the locator kinds on which a participant receives compressed messages, to announce them.
+     *
+     * @param kinds Locator kinds of the compression transports of the participant.
+     * @return The kinds separated by commas.
+     */
+    static std::string format_kinds(
+            const std::vector<int32_t>& kinds)
+    {
+        std::ostringstream output;
+        for (size_t i = 0; i < kinds.size(); ++i)
+        {
+            output << (0 == i ? "" : ",") << kinds[i];
+        }
+        return output.str();
+    }
+
+private:
+
+    static bool is_kind_announced(
+            int32_t kind,
+            const std::string& kinds)
+    {
+        std::istringstream input(kinds);
+        std::string item;
+        while (std::getline(input, item, ','))
+        {
+            if (item == std::to_string(kind))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    mutable shared_mutex peers_mutex_;
+
+    //! Number of discovered participants announcing each locator.
+    std::map<Locator, uint32_t> peers_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONPEERS_HPP_
@@ -0,0 +1,131 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CompressionTransport.hpp"
+
+#include <cstring>
+
+#include <fastdds/dds/log/Log.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+TransportInterface* CompressionTransportDescriptor::create_transport() const
+{
+    return new CompressionTransport(*this);
+}
+
+CompressionTransport::CompressionTransport(
+        const CompressionTransportDescriptor& descriptor)
+    : ChainingTransport(descriptor)
+    , descriptor_(descriptor)
+    , compressor_(descriptor.mode, descriptor.min_size, descriptor.min_savings_percent, descriptor.adaptive_skip)
+{
+}
+
+bool CompressionTransport::send(
+        SenderResource* low_sender_resource,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        LocatorsIterator* destination_locators_begin,
+        LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& timeout)
+{
+    if (CompressionMode::NONE == descriptor_.mode || descriptor_.min_size > total_bytes)
+    {
+        return low_sender_resource->send(buffers, total_bytes, destination_locators_begin,
+                       destination_locators_end, timeout);
+    }
+
+    // Sending threads reuse their buffers across messages.
+    thread_local std::vector<Locator> compressed_destinations;
+    thread_local std::vector<Locator> plain_destinations;
+    thread_local std::vector<octet> message;
+    thread_local std::vector<octet> frame;
+
+    // Only the destinations announced by participants with a compression transport receive compressed messages.
+    split_destinations(*destination_locators_begin, *destination_locators_end, compressed_destinations,
+            plain_destinations);
+
+    bool ret = true;
+    if (!compressed_destinations.empty())
+    {
+        const octet* contiguous = static_cast<const octet*>(buffers.front().buffer);
+        if (1 < buffers.size())
+        {
+            message.resize(total_bytes);
+            uint32_t offset = 0;
+            for (const NetworkBuffer& buffer : buffers)
+            {
+                std::memcpy(message.data() + offset, buffer.buffer, buffer.size);
+                offset += buffer.size;
+            }
+            contiguous = message.data();
+        }
+
+        if (compressor_.encode(contiguous, total_bytes, frame))
+        {
+            std::vector<NetworkBuffer> compressed{NetworkBuffer(frame.data(), static_cast<uint32_t>(frame.size()))};
+            Locators begin(compressed_destinations.begin());
+            Locators end(compressed_destinations.end());
+            ret = low_sender_resource->send(compressed, static_cast<uint32_t>(frame.size()), &begin, &end, timeout);
+        }
+        else
+        {
+            plain_destinations.insert(plain_destinations.end(), compressed_destinations.begin(),
+                    compressed_destinations.end());
+        }
+    }
+
+    if (!plain_destinations.empty())
+    {
+        Locators begin(plain_destinations.begin());
+        Locators end(plain_destinations.end());
+        ret = low_sender_resource->send(buffers, total_bytes, &begin, &end, timeout) && ret;
+    }
+
+    return ret;
+}
+
+void CompressionTransport::receive(
+        TransportReceiverInterface* next_receiver,
+        const octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        const Locator_t& local_locator,
+        const Locator_t& remote_locator)
+{
+    thread_local std::vector<octet> message;
+
+    switch (MessageCompressor::decode(receive_buffer, receive_buffer_size, descriptor_.max_message_size(), message))
+    {
+        case MessageCompressor::DecodeResult::NOT_COMPRESSED:
+            next_receiver->OnDataReceived(receive_buffer, receive_buffer_size, local_locator, remote_locator);
+            break;
+
+        case MessageCompressor::DecodeResult::DECOMPRESSED:
+            next_receiver->OnDataReceived(message.data(), static_cast<uint32_t>(message.size()), local_locator,
+                    remote_locator);
+            break;
+
+        case MessageCompressor::DecodeResult::INVALID:
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Discarding malformed compressed message of "
+                    << receive_buffer_size << " bytes");
+            break;
+    }
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,72 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONTRANSPORT_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONTRANSPORT_HPP_
+
+#include <fastdds/rtps/transport/ChainingTransport.h>
+#include <fastdds/rtps/transport/CompressionTransportDescriptor.h>
+
+#include "CompressionPeers.hpp"
+#include "MessageCompressor.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Chaining transport compressing the messages carrying user data before sending them through the low level
+ * transport, and decompressing them on reception.
+ * Messages are only compressed for the remote locators added as peers by discovery, and the ones received
+ * uncompressed are handed to the upper level as they are.
+ */
+class CompressionTransport : public ChainingTransport, public CompressionPeers
+{
+public:
+
+    CompressionTransport(
+            const CompressionTransportDescriptor& descriptor);
+
+    TransportDescriptorInterface* get_configuration() override
+    {
+        return &descriptor_;
+    }
+
+    bool send(
+            SenderResource* low_sender_resource,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& timeout) override;
+
+    void receive(
+            TransportReceiverInterface* next_receiver,
+            const octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            const Locator_t& local_locator,
+            const Locator_t& remote_locator) override;
+
+private:
+
+    CompressionTransportDescriptor descriptor_;
+
+    MessageCompressor compressor_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_COMPRESSION_COMPRESSIONTRANSPORT_HPP_
@@ -0,0 +1,295 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LZCodec.hpp"
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+namespace {
+
+// Minimum length of a match.
+constexpr size_t MIN_MATCH = 4;
+// The last bytes of a block are always literals.
+constexpr size_t LAST_LITERALS = 5;
+// The last match has to start this number of bytes before the end of the block.
+constexpr size_t MATCH_FIND_LIMIT = 12;
+// Matches can point up to this number of bytes backwards.
+constexpr size_t MAX_DISTANCE = 65535;
+
+constexpr uint32_t HASH_LOG = 12;
+constexpr uint32_t HASH_SIZE = 1u << HASH_LOG;
+
+// Literal and match lengths in a token are saturated at this value, and continued in the following bytes.
+constexpr size_t RUN_MASK = 15;
+
+inline uint32_t read32(
+        const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t hash_position(
+        const uint8_t* p)
+{
+    return (read32(p) * 2654435761u) >> (32 - HASH_LOG);
+}
+
+// Bytes needed to encode a length saturated in a token nibble.
+inline size_t extra_length_bytes(
+        size_t length)
+{
+    return length < RUN_MASK ? 0 : (length - RUN_MASK) / 255 + 1;
+}
+
+inline uint8_t* write_extra_length(
+        uint8_t* op,
+        size_t length)
+{
+    if (length >= RUN_MASK)
+    {
+        length -= RUN_MASK;
+        while (length >= 255)
+        {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = static_cast<uint8_t>(length);
+    }
+    return op;
+}
+
+// Append a sequence of literals, optionally followed by a match.
+// Returns nullptr when the sequence does not fit in the output.
+inline uint8_t* write_sequence(
+        uint8_t* op,
+        const uint8_t* op_end,
+        const uint8_t* literals,
+        size_t literal_length,
+        size_t match_offset,
+        size_t match_length)
+{
+    size_t needed = 1 + extra_length_bytes(literal_length) + literal_length;
+    if (0 != match_offset)
+    {
+        needed += 2 + extra_length_bytes(match_length - MIN_MATCH);
+    }
+    if (static_cast<size_t>(op_end - op) < needed)
+    {
+        return nullptr;
+    }
+
+    uint8_t* token = op++;
+    *token = static_cast<uint8_t>((literal_length < RUN_MASK ? literal_length : RUN_MASK) << 4);
+    op = write_extra_length(op, literal_length);
+    if (0 < literal_length)
+    {
+        std::memcpy(op, literals, literal_length);
+        op += literal_length;
+    }
+
+    if (0 != match_offset)
+    {
+        *op++ = static_cast<uint8_t>(match_offset);
+        *op++ = static_cast<uint8_t>(match_offset >> 8);
+        size_t length = match_length - MIN_MATCH;
+        *token |= static_cast<uint8_t>(length < RUN_MASK ? length : RUN_MASK);
+        op = write_extra_length(op, length);
+    }
+
+    return op;
+}
+
+// Read the continuation of a saturated length. Returns false when the block ends in the middle.
+inline bool read_extra_length(
+        const uint8_t*& ip,
+        const uint8_t* ip_end,
+        size_t& length)
+{
+    if (RUN_MASK == length)
+    {
+        uint8_t byte = 0;
+        do
+        {
+            if (ip >= ip_end)
+            {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (255 == byte);
+    }
+    return true;
+}
+
+} // namespace
+
+size_t LZCodec::compress_bound(
+        size_t input_size)
+{
+    return input_size + input_size / 255 + 16;
+}
+
+size_t LZCodec::compress(
+        const uint8_t* input,
+        size_t input_size,
+        uint8_t* output,
+        size_t output_capacity)
+{
+    const uint8_t* const ip_begin = input;
+    const uint8_t* const ip_end = input + input_size;
+    const uint8_t* anchor = input;
+    uint8_t* op = output;
+    const uint8_t* const op_end = output + output_capacity;
+
+    if (input_size > MATCH_FIND_LIMIT)
+    {
+        uint32_t table[HASH_SIZE];
+        std::memset(table, 0, sizeof(table));
+
+        const uint8_t* const match_limit = ip_end - LAST_LITERALS;
+        const uint8_t* const find_limit = ip_end - MATCH_FIND_LIMIT;
+        const uint8_t* ip = input + 1;
+        uint32_t misses = 0;
+
+        while (ip < find_limit)
+        {
+            uint32_t h = hash_position(ip);
+            const uint8_t* ref = ip_begin + table[h];
+            table[h] = static_cast<uint32_t>(ip - ip_begin);
+
+            if (static_cast<size_t>(ip - ref) > MAX_DISTANCE || read32(ref) != read32(ip))
+            {
+                // Step faster over data which does not compress.
+                ip += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // Extend the match backwards over pending literals, and then forwards.
+            while (ip > anchor && ref > ip_begin && ip[-1] == ref[-1])
+            {
+                --ip;
+                --ref;
+            }
+            size_t length = MIN_MATCH;
+            while (ip + length < match_limit && ip[length] == ref[length])
+            {
+                ++length;
+            }
+
+            op = write_sequence(op, op_end, anchor, static_cast<size_t>(ip - anchor),
+                            static_cast<size_t>(ip - ref), length);
+            if (nullptr == op)
+            {
+                return 0;
+            }
+
+            ip += length;
+            anchor = ip;
+            if (ip < find_limit)
+            {
+                table[hash_position(ip - 2)] = static_cast<uint32_t>(ip - 2 - ip_begin);
+            }
+        }
+    }
+
+    op = write_sequence(op, op_end, anchor, static_cast<size_t>(ip_end - anchor), 0, 0);
+    return nullptr == op ? 0 : static_cast<size_t>(op - output);
+}
+
+bool LZCodec::decompress(
+        const uint8_t* input,
+        size_t input_size,
+        uint8_t* output,
+        size_t output_size)
+{
+    const uint8_t* ip = input;
+    const uint8_t* const ip_end = input + input_size;
+    uint8_t* op = output;
+    uint8_t* const op_end = output + output_size;
+
+    while (ip < ip_end)
+    {
+        uint8_t token = *ip++;
+
+        size_t literal_length = token >> 4;
+        if (!read_extra_length(ip, ip_end, literal_length) ||
+                static_cast<size_t>(ip_end - ip) < literal_length ||
+                static_cast<size_t>(op_end - op) < literal_length)
+        {
+            return false;
+        }
+        if (0 < literal_length)
+        {
+            std::memcpy(op, ip, literal_length);
+            ip += literal_length;
+            op += literal_length;
+        }
+
+        if (ip == ip_end)
+        {
+            // The last sequence has no match.
+            break;
+        }
+
+        if (ip_end - ip < 2)
+        {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (0 == offset || static_cast<size_t>(op - output) < offset)
+        {
+            return false;
+        }
+
+        size_t match_length = token & RUN_MASK;
+        if (!read_extra_length(ip, ip_end, match_length))
+        {
+            return false;
+        }
+        match_length += MIN_MATCH;
+        if (static_cast<size_t>(op_end - op) < match_length)
+        {
+            return false;
+        }
+
+        const uint8_t* ref = op - offset;
+        if (offset >= match_length)
+        {
+            std::memcpy(op, ref, match_length);
+            op += match_length;
+        }
+        else
+        {
+            // Overlapping match, repeating the last offset bytes.
+            for (size_t i = 0; i < match_length; ++i)
+            {
+                *op++ = *ref++;
+            }
+        }
+    }
+
+    return op == op_end;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
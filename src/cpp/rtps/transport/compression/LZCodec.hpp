@@ -0,0 +1,77 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_COMPRESSION_LZCODEC_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_COMPRESSION_LZCODEC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Fast LZ77 codec producing blocks in the LZ4 block format.
+ *
+ * It favours speed over ratio: matches are looked up in a single hash table of recent positions, with no chains,
+ * so it compresses at memory-copy-like speeds the repetitive structures found in serialized samples.
+ */
+class LZCodec
+{
+public:
+
+    /**
+     * Maximum size of the block resulting from compressing an input of a given size.
+     * @param input_size Size of the input.
+     * @return Size a destination buffer needs so compression never fails.
+     */
+    static size_t compress_bound(
+            size_t input_size);
+
+    /**
+     * Compress a buffer.
+     * @param input Buffer to compress.
+     * @param input_size Size of @c input.
+     * @param output Buffer receiving the compressed block.
+     * @param output_capacity Size of @c output.
+     * @return Size of the compressed block, or 0 if it does not fit in @c output_capacity bytes.
+     */
+    static size_t compress(
+            const uint8_t* input,
+            size_t input_size,
+            uint8_t* output,
+            size_t output_capacity);
+
+    /**
+     * Decompress a block.
+     * Malformed blocks are detected, and never make the decoder access memory out of the given buffers.
+     * @param input Compressed block.
+     * @param input_size Size of @c input.
+     * @param output Buffer receiving the decompressed data.
+     * @param output_size Exact size of the decompressed data.
+     * @return true when the block is well formed and decompresses to exactly @c output_size bytes.
+     */
+    static bool decompress(
+            const uint8_t* input,
+            size_t input_size,
+            uint8_t* output,
+            size_t output_size);
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_COMPRESSION_LZCODEC_HPP_
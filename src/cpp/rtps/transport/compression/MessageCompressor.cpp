@@ -0,0 +1,197 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MessageCompressor.hpp"
+
+#include <cstring>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+
+#include "LZCodec.hpp"
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+namespace {
+
+constexpr octet COMPRESSED_MAGIC[4] = {'R', 'T', 'P', 'Z'};
+
+// Offset of the writerId in the body of DATA and DATA_FRAG submessages, after extraFlags, octetsToInlineQos and
+// readerId.
+constexpr uint32_t WRITER_ID_OFFSET = 8;
+
+// Builtin entities have the two most significant bits of their kind set.
+constexpr octet BUILTIN_ENTITY_MASK = 0xC0;
+
+inline void write_uint32_le(
+        octet* p,
+        uint32_t value)
+{
+    p[0] = static_cast<octet>(value);
+    p[1] = static_cast<octet>(value >> 8);
+    p[2] = static_cast<octet>(value >> 16);
+    p[3] = static_cast<octet>(value >> 24);
+}
+
+inline uint32_t read_uint32_le(
+        const octet* p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+constexpr uint32_t MessageCompressor::COMPRESSED_HEADER_SIZE;
+constexpr octet MessageCompressor::LZ_CODEC;
+
+MessageCompressor::MessageCompressor(
+        CompressionMode mode,
+        uint32_t min_size,
+        uint32_t min_savings_percent,
+        uint32_t adaptive_skip)
+    : mode_(mode)
+    , min_size_(min_size)
+    , min_savings_percent_(min_savings_percent)
+    , adaptive_skip_(adaptive_skip)
+{
+}
+
+bool MessageCompressor::encode(
+        const octet* message,
+        uint32_t size,
+        std::vector<octet>& frame)
+{
+    if (CompressionMode::NONE == mode_ || size < min_size_ || size <= COMPRESSED_HEADER_SIZE ||
+            !carries_user_data(message, size))
+    {
+        return false;
+    }
+
+    if (CompressionMode::ADAPTIVE == mode_ && skip_message())
+    {
+        return false;
+    }
+
+    // Only frames smaller than the original message are worth sending.
+    size_t capacity = size - COMPRESSED_HEADER_SIZE - 1;
+    frame.resize(COMPRESSED_HEADER_SIZE + capacity);
+    size_t compressed_size = LZCodec::compress(message, size, frame.data() + COMPRESSED_HEADER_SIZE, capacity);
+    size_t frame_size = COMPRESSED_HEADER_SIZE + compressed_size;
+
+    if (CompressionMode::ADAPTIVE == mode_ &&
+            (0 == compressed_size || (size - frame_size) * 100 < static_cast<size_t>(size) * min_savings_percent_))
+    {
+        // Data of this kind does not compress well, so the next messages are not even tried.
+        pending_skips_.store(adaptive_skip_, std::memory_order_relaxed);
+    }
+
+    if (0 == compressed_size)
+    {
+        return false;
+    }
+
+    std::memcpy(frame.data(), COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC));
+    frame[4] = LZ_CODEC;
+    frame[5] = 0;
+    frame[6] = 0;
+    frame[7] = 0;
+    write_uint32_le(&frame[8], size);
+    frame.resize(frame_size);
+    return true;
+}
+
+MessageCompressor::DecodeResult MessageCompressor::decode(
+        const octet* buffer,
+        uint32_t size,
+        uint32_t max_message_size,
+        std::vector<octet>& message)
+{
+    if (size < sizeof(COMPRESSED_MAGIC) || 0 != std::memcmp(buffer, COMPRESSED_MAGIC, sizeof(COMPRESSED_MAGIC)))
+    {
+        return DecodeResult::NOT_COMPRESSED;
+    }
+
+    if (size < COMPRESSED_HEADER_SIZE || LZ_CODEC != buffer[4])
+    {
+        return DecodeResult::INVALID;
+    }
+
+    uint32_t message_size = read_uint32_le(&buffer[8]);
+    if (message_size > max_message_size)
+    {
+        return DecodeResult::INVALID;
+    }
+
+    message.resize(message_size);
+    if (!LZCodec::decompress(buffer + COMPRESSED_HEADER_SIZE, size - COMPRESSED_HEADER_SIZE, message.data(),
+            message_size))
+    {
+        return DecodeResult::INVALID;
+    }
+
+    return DecodeResult::DECOMPRESSED;
+}
+
+bool MessageCompressor::carries_user_data(
+        const octet* message,
+        uint32_t size)
+{
+    uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+
+    while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= size)
+    {
+        octet id = message[pos];
+        bool little_endian = 0 != (message[pos + 1] & 0x01);
+        uint32_t length = little_endian ?
+                (static_cast<uint32_t>(message[pos + 2]) | (static_cast<uint32_t>(message[pos + 3]) << 8)) :
+                ((static_cast<uint32_t>(message[pos + 2]) << 8) | static_cast<uint32_t>(message[pos + 3]));
+        uint32_t body = pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+
+        if (DATA == id || DATA_FRAG == id)
+        {
+            // The entityKind is the last byte of the writerId.
+            uint32_t kind_pos = body + WRITER_ID_OFFSET + 3;
+            if (kind_pos < size && BUILTIN_ENTITY_MASK != (message[kind_pos] & BUILTIN_ENTITY_MASK))
+            {
+                return true;
+            }
+        }
+
+        if (0 == length)
+        {
+            // The submessage extends up to the end of the message.
+            break;
+        }
+        pos = body + length;
+    }
+
+    return false;
+}
+
+bool MessageCompressor::skip_message()
+{
+    uint32_t pending = pending_skips_.load(std::memory_order_relaxed);
+    while (0 < pending &&
+            !pending_skips_.compare_exchange_weak(pending, pending - 1, std::memory_order_relaxed))
+    {
+    }
+    return 0 < pending;
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
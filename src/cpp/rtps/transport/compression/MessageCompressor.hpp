@@ -0,0 +1,125 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_COMPRESSION_MESSAGECOMPRESSOR_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_COMPRESSION_MESSAGECOMPRESSOR_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/transport/CompressionTransportDescriptor.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Turns RTPS messages into compressed frames and back.
+ *
+ * A compressed frame is made up of a header of COMPRESSED_HEADER_SIZE bytes followed by the compressed message:
+ *
+ * - 4 bytes with the magic 'R' 'T' 'P' 'Z', which no RTPS message starts with.
+ * - 1 byte with the codec used to compress the message.
+ * - 3 reserved bytes, set to zero.
+ * - 4 bytes with the size of the original message, little endian.
+ */
+class MessageCompressor
+{
+public:
+
+    //! Size of the header preceding the compressed message.
+    static constexpr uint32_t COMPRESSED_HEADER_SIZE = 12;
+
+    //! Codec identifier of the LZ codec.
+    static constexpr octet LZ_CODEC = 1;
+
+    //! Result of decoding a received buffer.
+    enum class DecodeResult
+    {
+        //! The buffer is not a compressed frame, and has to be processed as is.
+        NOT_COMPRESSED,
+        //! The buffer was a compressed frame, and the original message has been recovered.
+        DECOMPRESSED,
+        //! The buffer is a malformed compressed frame, and has to be discarded.
+        INVALID
+    };
+
+    MessageCompressor(
+            CompressionMode mode,
+            uint32_t min_size,
+            uint32_t min_savings_percent,
+            uint32_t adaptive_skip);
+
+    /**
+     * Compress a message, when it is worth it.
+     * Only messages carrying user data, with at least a DATA or DATA_FRAG submessage of a non-builtin writer, are
+     * compressed.
+     * @param message RTPS message to compress.
+     * @param size Size of @c message.
+     * @param[out] frame Compressed frame, including its header.
+     * @return true when @c frame holds a compressed frame smaller than @c message, which has to be sent instead.
+     */
+    bool encode(
+            const octet* message,
+            uint32_t size,
+            std::vector<octet>& frame);
+
+    /**
+     * Recover the original message from a received buffer.
+     * @param buffer Received buffer.
+     * @param size Size of @c buffer.
+     * @param max_message_size Maximum size a decompressed message may have.
+     * @param[out] message Decompressed message, only filled when DECOMPRESSED is returned.
+     * @return What the buffer was.
+     */
+    static DecodeResult decode(
+            const octet* buffer,
+            uint32_t size,
+            uint32_t max_message_size,
+            std::vector<octet>& message);
+
+    /**
+     * Whether an RTPS message carries user data.
+     * @param message RTPS message.
+     * @param size Size of @c message.
+     * @return true when @c message has a DATA or DATA_FRAG submessage of a non-builtin writer.
+     */
+    static bool carries_user_data(
+            const octet* message,
+            uint32_t size);
+
+private:
+
+    //! Consume one of the messages to be sent uncompressed after a poor ratio.
+    bool skip_message();
+
+    CompressionMode mode_;
+
+    uint32_t min_size_;
+
+    uint32_t min_savings_percent_;
+
+    uint32_t adaptive_skip_;
+
+    //! Messages still to be sent uncompressed in ADAPTIVE mode.
+    std::atomic<uint32_t> pending_skips_{0};
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_COMPRESSION_MESSAGECOMPRESSOR_HPP_
@@ -54,7 +54,8 @@ public:
 
         uint32_t ref_counter() const
         {
-            return ref_counter_.load(std::memory_order_relaxed);
+            // Pairs with the release in push(), so the data is visible to listeners polling without the port lock
+            return ref_counter_.load(std::memory_order_acquire);
         }
 
         friend class MultiProducerConsumerRingBuffer<T>;
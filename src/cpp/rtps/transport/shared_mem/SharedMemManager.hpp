@@ -24,6 +24,7 @@
 #include <foonathan/memory/memory_pool.hpp>
 
 #include "rtps/transport/shared_mem/SharedMemGlobal.hpp"
+#include "utils/AdaptiveSpin.hpp"
 #include "utils/collections/node_size_helpers.hpp"
 #include "utils/shared_memory/RobustSharedLock.hpp"
 #include "utils/shared_memory/SharedMemWatchdog.hpp"
@@ -656,12 +657,19 @@ public:
     {
     public:
 
+        /**
+         * @param shared_mem_manager  Manager owning the segments the descriptors point to.
+         * @param port                Port to listen to.
+         * @param spin_budget_us      Time pop() polls the port before blocking (microseconds).
+         */
         Listener(
                 SharedMemManager* shared_mem_manager,
-                std::shared_ptr<SharedMemGlobal::Port> port)
+                std::shared_ptr<SharedMemGlobal::Port> port,
+                uint32_t spin_budget_us = 0)
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , spin_(spin_budget_us)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -690,14 +698,16 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            spin_ = other.spin_;
 
             return *this;
         }
 
         /**
          * Extract the first buffer enqueued in the port.
-         * If the queue is empty, blocks until a buffer is pushed
-         * to the port.
+         * If the queue is empty, polls the port during the spin budget of the listener, and then blocks until a buffer
+         * is pushed to the port.
+         * Senders only wake up listeners which are blocked, so polling listeners save the notification.
          * @return A shared_ptr to the buffer, this shared_ptr can be nullptr if the
          * wait was interrupted because errors or close operations.
          * @remark Multithread not supported.
@@ -718,8 +728,15 @@ public:
 
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
-                        // Wait until there's data to pop
-                        global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        bool polled = spin_.enabled() && spin_.spin([&]
+                                        {
+                                            return is_closed_.load() || nullptr != global_listener_->head();
+                                        });
+                        if (!polled)
+                        {
+                            // Wait until there's data to pop
+                            global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        }
                     }
 
                     if (!head_cell)
@@ -804,7 +821,7 @@ public:
         {
             auto new_port = global_port_;
             shared_mem_manager_->regenerate_port(new_port, new_port->open_mode());
-            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port);
+            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port, spin_.max_spin_us());
             *this = std::move(*new_listener);
         }
 
@@ -829,6 +846,8 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        AdaptiveSpin spin_;
+
     }; // Listener
 
     /**
@@ -952,9 +971,13 @@ public:
             }
         }
 
-        std::shared_ptr<Listener> create_listener()
+        /**
+         * @param spin_budget_us  Time the listener polls the port before blocking (microseconds).
+         */
+        std::shared_ptr<Listener> create_listener(
+                uint32_t spin_budget_us = 0)
         {
-            return std::make_shared<Listener>(shared_mem_manager_, global_port_);
+            return std::make_shared<Listener>(shared_mem_manager_, global_port_, spin_budget_us);
         }
 
     private:
@@ -335,7 +335,7 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration_.port_queue_capacity(),
             configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode)->create_listener(configuration_.listener_spin_budget_us()),
         locator,
         receiver,
         configuration_.rtps_dump_file(),
@@ -36,6 +36,7 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , listener_spin_budget_us_(0)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -48,6 +49,7 @@ bool SharedMemTransportDescriptor::operator ==(
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
            this->dump_thread_ == t.dump_thread() &&
+           this->listener_spin_budget_us_ == t.listener_spin_budget_us() &&
            PortBasedTransportDescriptor::operator ==(t));
 }
 
@@ -0,0 +1,234 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_TCP_MESSAGE_ASSEMBLER_H_
+#define _FASTDDS_TCP_MESSAGE_ASSEMBLER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include <rtps/transport/tcp/RTCPHeader.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Incremental parser of the RTCP framing of a TCP connection.
+ *
+ * Used when a connection is served by non-blocking reads of whatever amount of bytes is available.
+ * The caller asks with @ref prepare() where the next read has to be stored, and reports with @ref commit() how many
+ * bytes were read. Headers are assembled inside the object, resynchronizing on the "RTCP" mark as the blocking
+ * reception does, and bodies are assembled directly on the reception buffer of the channel, so a message never
+ * needs to be copied.
+ */
+class TCPMessageAssembler
+{
+public:
+
+    enum class Result
+    {
+        //! More bytes are needed to complete the current message.
+        INCOMPLETE,
+        //! The body of a message is complete on the reception buffer.
+        MESSAGE_READY,
+        //! The header of a message bigger than the reception buffer was found. Its body will be dropped.
+        MESSAGE_TOO_BIG
+    };
+
+    /**
+     * Get the region where the next read has to be stored.
+     *
+     * @param [in]  buffer    Reception buffer of the channel.
+     * @param [in]  capacity  Capacity of the reception buffer.
+     * @param [out] data      Where the next read has to be stored.
+     * @param [out] size      Maximum number of bytes the next read may store.
+     */
+    void prepare(
+            octet* buffer,
+            uint32_t capacity,
+            octet*& data,
+            std::size_t& size)
+    {
+        switch (state_)
+        {
+            case State::HEADER:
+                data = header_.address() + header_pos_;
+                size = TCPHeader::size() - header_pos_;
+                break;
+
+            case State::BODY:
+                data = buffer + body_pos_;
+                size = body_size_ - body_pos_;
+                break;
+
+            case State::DROP:
+                data = buffer;
+                size = std::min<std::size_t>(capacity, body_size_ - body_pos_);
+                break;
+        }
+    }
+
+    /**
+     * Process the bytes stored by a read on the region returned by @ref prepare().
+     *
+     * @param bytes       Number of bytes read.
+     * @param capacity    Capacity of the reception buffer.
+     * @param msg_endian  Endianness of the incoming headers.
+     *
+     * @return The state of the current message.
+     */
+    Result commit(
+            std::size_t bytes,
+            uint32_t capacity,
+            Endianness_t msg_endian)
+    {
+        Result ret = Result::INCOMPLETE;
+
+        switch (state_)
+        {
+            case State::HEADER:
+                header_pos_ += bytes;
+                synchronize();
+                if (TCPHeader::size() == header_pos_)
+                {
+                    ret = header_completed(capacity, msg_endian);
+                }
+                break;
+
+            case State::BODY:
+                body_pos_ += static_cast<uint32_t>(bytes);
+                if (body_pos_ == body_size_)
+                {
+                    header_pos_ = 0;
+                    state_ = State::HEADER;
+                    ret = Result::MESSAGE_READY;
+                }
+                break;
+
+            case State::DROP:
+                body_pos_ += static_cast<uint32_t>(bytes);
+                if (body_pos_ == body_size_)
+                {
+                    header_pos_ = 0;
+                    state_ = State::HEADER;
+                }
+                break;
+        }
+
+        return ret;
+    }
+
+    //! Header of the last message found, with its endianness already fixed.
+    const TCPHeader& header() const
+    {
+        return header_;
+    }
+
+    //! Size of the body of the last message found.
+    uint32_t body_size() const
+    {
+        return body_size_;
+    }
+
+    //! Discard any partial message.
+    void reset()
+    {
+        state_ = State::HEADER;
+        header_pos_ = 0;
+        body_size_ = 0;
+        body_pos_ = 0;
+    }
+
+private:
+
+    enum class State
+    {
+        HEADER,
+        BODY,
+        DROP
+    };
+
+    /**
+     * Drop the leading bytes of the partial header until they are a prefix of the "RTCP" mark.
+     */
+    void synchronize()
+    {
+        static const char mark[4] = {'R', 'T', 'C', 'P'};
+        octet* ptr = header_.address();
+
+        std::size_t checked = 0;
+        while (checked < std::min<std::size_t>(header_pos_, sizeof(mark)))
+        {
+            if (mark[checked] == static_cast<char>(ptr[checked]))
+            {
+                ++checked;
+            }
+            else
+            {
+                memmove(ptr, &ptr[1], header_pos_ - 1);
+                --header_pos_;
+                checked = 0;
+            }
+        }
+    }
+
+    Result header_completed(
+            uint32_t capacity,
+            Endianness_t msg_endian)
+    {
+        TCPHeader header = header_;
+        header.valid_endianness(msg_endian);
+
+        if (header.length < TCPHeader::size())
+        {
+            // Not a valid header, look for the next mark
+            header_.rtcp[0] = 0;
+            synchronize();
+            return Result::INCOMPLETE;
+        }
+
+        header_ = header;
+        body_size_ = header.length - static_cast<uint32_t>(TCPHeader::size());
+        body_pos_ = 0;
+
+        if (body_size_ > capacity)
+        {
+            state_ = State::DROP;
+            return Result::MESSAGE_TOO_BIG;
+        }
+
+        if (0 == body_size_)
+        {
+            header_pos_ = 0;
+            return Result::MESSAGE_READY;
+        }
+
+        state_ = State::BODY;
+        return Result::INCOMPLETE;
+    }
+
+    State state_ = State::HEADER;
+    TCPHeader header_;
+    std::size_t header_pos_ = 0;
+    uint32_t body_size_ = 0;
+    uint32_t body_pos_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TCP_MESSAGE_ASSEMBLER_H_
@@ -34,6 +34,7 @@
 #include <string.h>
 
 #include <security/cryptography/AESGCMGMAC_KeyFactory.h>
+#include <security/cryptography/AESGCMGMAC_Transform.h>
 
 // Solve error with Win32 macro
 #ifdef WIN32
@@ -805,6 +806,9 @@ void AESGCMGMAC_KeyFactory::release_participant(
 
     // free all remaining resources
     delete (&key);
+
+    // Session keys derived from the released key material must not outlive it
+    AESGCMGMAC_Transform::clear_cached_session_keys();
 }
 
 bool AESGCMGMAC_KeyFactory::unregister_participant(
@@ -900,6 +904,9 @@ bool AESGCMGMAC_KeyFactory::unregister_datawriter(
     // This should be the last reference
     datawriter_crypto_handle.reset();
 
+    // Session keys derived from the released key material must not outlive it
+    AESGCMGMAC_Transform::clear_cached_session_keys();
+
     return true;
 }
 
@@ -939,6 +946,9 @@ bool AESGCMGMAC_KeyFactory::unregister_datareader(
     // This should be the last reference
     datareader_crypto_handle.reset();
 
+    // Session keys derived from the released key material must not outlive it
+    AESGCMGMAC_Transform::clear_cached_session_keys();
+
     return true;
 }
 
@@ -23,9 +23,14 @@
 #include <rtps/messages/CDRMessage.hpp>
 
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
 #define IS_OPENSSL_1_1 1
@@ -55,6 +60,275 @@ using namespace security;
 
 constexpr int initialization_vector_suffix_length = 8;
 
+namespace {
+
+// Receiver specific MACs are computed with the cipher contexts following this one.
+constexpr size_t first_receiver_context = 1;
+// Receivers beyond this number share the cached cipher contexts.
+constexpr size_t max_cached_cipher_contexts = 256;
+// Session keys kept by each thread.
+constexpr size_t cached_session_keys = 64;
+
+/**
+ * AES-GCM cipher contexts kept by each thread and reused across messages.
+ *
+ * Every context remembers the cipher and key it was initialized with, so reusing it with the same key only sets the
+ * initialization vector, saving the allocation of the context and the expansion of the key. The MACs for the same
+ * receivers of consecutive messages are computed with one context per receiver, which keeps its key from the
+ * previous message.
+ */
+class CipherContextCache
+{
+public:
+
+    ~CipherContextCache()
+    {
+        release(encryption_contexts_);
+        release(decryption_contexts_);
+    }
+
+    /**
+     * Get a context ready to encrypt.
+     * @param slot Index of the context to use.
+     * @param cipher AES-GCM cipher.
+     * @param key Key of the length of @c cipher.
+     * @param initialization_vector Initialization vector of the operation.
+     * @return The context, or nullptr on error.
+     */
+    EVP_CIPHER_CTX* encryption(
+            size_t slot,
+            const EVP_CIPHER* cipher,
+            const uint8_t* key,
+            const uint8_t* initialization_vector)
+    {
+        return init(encryption_contexts_, slot, cipher, key, initialization_vector, 1);
+    }
+
+    /**
+     * Get a context ready to decrypt.
+     * @param slot Index of the context to use.
+     * @param cipher AES-GCM cipher.
+     * @param key Key of the length of @c cipher.
+     * @param initialization_vector Initialization vector of the operation.
+     * @return The context, or nullptr on error.
+     */
+    EVP_CIPHER_CTX* decryption(
+            size_t slot,
+            const EVP_CIPHER* cipher,
+            const uint8_t* key,
+            const uint8_t* initialization_vector)
+    {
+        return init(decryption_contexts_, slot, cipher, key, initialization_vector, 0);
+    }
+
+private:
+
+    struct Context
+    {
+        EVP_CIPHER_CTX* ctx = nullptr;
+        const EVP_CIPHER* cipher = nullptr;
+        std::array<uint8_t, 32> key;
+    };
+
+    static EVP_CIPHER_CTX* init(
+            std::vector<Context>& contexts,
+            size_t slot,
+            const EVP_CIPHER* cipher,
+            const uint8_t* key,
+            const uint8_t* initialization_vector,
+            int encrypt)
+    {
+        slot %= max_cached_cipher_contexts;
+        if (contexts.size() <= slot)
+        {
+            contexts.resize(slot + 1);
+        }
+
+        Context& context = contexts[slot];
+        if (nullptr == context.ctx)
+        {
+            context.ctx = EVP_CIPHER_CTX_new();
+            if (nullptr == context.ctx)
+            {
+                return nullptr;
+            }
+        }
+
+        size_t key_len = static_cast<size_t>(EVP_CIPHER_key_length(cipher));
+        bool same_key = context.cipher == cipher && 0 == CRYPTO_memcmp(context.key.data(), key, key_len);
+        if (!EVP_CipherInit_ex(context.ctx, same_key ? nullptr : cipher, nullptr, same_key ? nullptr : key,
+                initialization_vector, encrypt))
+        {
+            context.cipher = nullptr;
+            return nullptr;
+        }
+
+        if (!same_key)
+        {
+            context.cipher = cipher;
+            memcpy(context.key.data(), key, key_len);
+        }
+        return context.ctx;
+    }
+
+    static void release(
+            std::vector<Context>& contexts)
+    {
+        for (Context& context : contexts)
+        {
+            EVP_CIPHER_CTX_free(context.ctx);
+            OPENSSL_cleanse(context.key.data(), context.key.size());
+        }
+    }
+
+    std::vector<Context> encryption_contexts_;
+    std::vector<Context> decryption_contexts_;
+};
+
+/**
+ * Session keys derived by each thread, so they are derived once per session instead of once per message.
+ * Entries are looked up by session id and master key, and compared in full on each hit.
+ * The caches of all the threads are registered, so they can be cleared when key material goes away.
+ */
+class SessionKeyCache
+{
+public:
+
+    SessionKeyCache()
+    {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        registry.caches.push_back(this);
+    }
+
+    ~SessionKeyCache()
+    {
+        {
+            Registry& registry = get_registry();
+            std::lock_guard<std::mutex> guard(registry.mutex);
+            registry.caches.erase(std::find(registry.caches.begin(), registry.caches.end(), this));
+        }
+        clear();
+    }
+
+    /**
+     * Find a session key.
+     * @param [out] session_key Where the session key is copied when found.
+     * @return Whether the session key has already been derived by this thread.
+     */
+    bool find(
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            uint32_t session_id,
+            int key_len,
+            std::array<uint8_t, 32>& session_key)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        const Entry& entry = entries_[index(master_key, session_id)];
+        if (entry.valid && entry.receiver_specific == receiver_specific && entry.session_id == session_id &&
+                entry.key_len == key_len &&
+                0 == CRYPTO_memcmp(entry.master_key.data(), master_key.data(), master_key.size()) &&
+                0 == CRYPTO_memcmp(entry.master_salt.data(), master_salt.data(), master_salt.size()))
+        {
+            session_key = entry.session_key;
+            return true;
+        }
+        return false;
+    }
+
+    //! Store a session key, replacing the one stored for another session in the same position.
+    void store(
+            bool receiver_specific,
+            const std::array<uint8_t, 32>& master_key,
+            const std::array<uint8_t, 32>& master_salt,
+            uint32_t session_id,
+            int key_len,
+            const std::array<uint8_t, 32>& session_key)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        Entry& entry = entries_[index(master_key, session_id)];
+        entry.valid = true;
+        entry.receiver_specific = receiver_specific;
+        entry.session_id = session_id;
+        entry.key_len = key_len;
+        entry.master_key = master_key;
+        entry.master_salt = master_salt;
+        entry.session_key = session_key;
+    }
+
+    //! Wipe the entries of this cache.
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        OPENSSL_cleanse(entries_.data(), sizeof(Entry) * entries_.size());
+        for (Entry& entry : entries_)
+        {
+            entry.valid = false;
+        }
+    }
+
+    //! Wipe the entries of the caches of every thread.
+    static void clear_all()
+    {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        for (SessionKeyCache* cache : registry.caches)
+        {
+            cache->clear();
+        }
+    }
+
+private:
+
+    struct Entry
+    {
+        bool valid = false;
+        bool receiver_specific = false;
+        uint32_t session_id = 0;
+        int key_len = 0;
+        std::array<uint8_t, 32> master_key;
+        std::array<uint8_t, 32> master_salt;
+        std::array<uint8_t, 32> session_key;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<SessionKeyCache*> caches;
+    };
+
+    // Never destroyed, as caches of threads ending after the static destructors still unregister themselves.
+    static Registry& get_registry()
+    {
+        static Registry* registry = new Registry();
+        return *registry;
+    }
+
+    static size_t index(
+            const std::array<uint8_t, 32>& master_key,
+            uint32_t session_id)
+    {
+        uint32_t key_prefix = 0;
+        memcpy(&key_prefix, master_key.data(), sizeof(key_prefix));
+        return ((key_prefix ^ session_id) * 2654435761u >> 16) % cached_session_keys;
+    }
+
+    std::mutex mutex_;
+    std::array<Entry, cached_session_keys> entries_;
+};
+
+thread_local CipherContextCache cipher_contexts;
+thread_local SessionKeyCache session_keys;
+
+inline const EVP_CIPHER* gcm_cipher(
+        bool use_256_bits)
+{
+    return use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+}
+
+} // namespace
+
 static KeyMaterial_AES_GCM_GMAC* find_key(
         KeyMaterial_AES_GCM_GMAC_Seq& keys,
         const CryptoTransformIdentifier& id)
@@ -1474,6 +1748,11 @@ void AESGCMGMAC_Transform::compute_sessionkey(
     compute_sessionkey(session_key, false, key_mat.master_sender_key, key_mat.master_salt, session_id, key_len);
 }
 
+void AESGCMGMAC_Transform::clear_cached_session_keys()
+{
+    SessionKeyCache::clear_all();
+}
+
 void AESGCMGMAC_Transform::compute_sessionkey(
         std::array<uint8_t, 32>& session_key,
         bool receiver_specific,
@@ -1482,6 +1761,12 @@ void AESGCMGMAC_Transform::compute_sessionkey(
         const uint32_t session_id,
         int key_len)
 {
+    // Session keys only change with the session, so the ones already derived by this thread are reused
+    if (session_keys.find(receiver_specific, master_key, master_salt, session_id, key_len, session_key))
+    {
+        return;
+    }
+
     session_key.fill(0);
 
     int sourceLen = 0;
@@ -1525,6 +1810,8 @@ void AESGCMGMAC_Transform::compute_sessionkey(
     EVP_MD_CTX_cleanup(ctx);
     free(ctx);
 #endif // if IS_OPENSSL_1_1
+
+    session_keys.store(receiver_specific, master_key, master_salt, session_id, key_len, session_key);
 }
 
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(
@@ -1555,34 +1842,17 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // AES_BLOCK_SIZE = 16
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
+    const EVP_CIPHER* cipher = gcm_cipher(use_256_bits);
+    EVP_CIPHER_CTX* e_ctx = cipher_contexts.encryption(0, cipher, session_key.data(), initialization_vector.data());
 
-    if (!use_256_bits)
+    if (nullptr == e_ctx)
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(cipher);
 
     if (!do_encryption)
     {
@@ -1591,7 +1861,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.get_current_position(), plain_buffer, plain_buffer_len);
@@ -1601,7 +1870,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1609,7 +1877,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
     }
@@ -1653,7 +1920,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Error in fastcdr trying to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1662,7 +1928,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1670,7 +1935,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1696,7 +1960,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1743,6 +2006,9 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
     uint32_t length = 0;
     serializer << length;
 
+    const EVP_CIPHER* cipher = gcm_cipher(use_256_bits);
+    size_t context_slot = first_receiver_context;
+
     //Check the list of receivers, search for keys and compute session keys as needed
     for (auto rec = receiving_crypto_list.begin(); rec != receiving_crypto_list.end(); ++rec)
     {
@@ -1778,52 +2044,31 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         }
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+        //Each receiver has its own cached context, still keyed from the previous message to the same receivers
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
+        EVP_CIPHER_CTX* e_ctx = cipher_contexts.encryption(context_slot++, cipher,
+                        remote_entity->Sessions[sessionIndex].SessionKey.data(), initialization_vector.data());
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1849,6 +2094,8 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
     uint32_t length = 0;
     serializer << length;
 
+    size_t context_slot = first_receiver_context;
+
     //Check the list of receivers, search for keys and compute session keys as needed
     for (auto rec = receiving_crypto_list.begin(); rec != receiving_crypto_list.end(); ++rec)
     {
@@ -1891,53 +2138,31 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         }
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+        //Each receiver has its own cached context, still keyed from the previous message to the same receivers
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = cipher_contexts.encryption(context_slot++, gcm_cipher(use_256_bits),
+                        remote_participant->Session.SessionKey.data(), initialization_vector.data());
+        if (nullptr == e_ctx)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                        "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                    "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
         serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.get_current_position());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1979,35 +2204,18 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
     int cipher_block_size = 0, actual_size = 0, final_size = 0;
+    const EVP_CIPHER* cipher = gcm_cipher(use_256_bits);
+    EVP_CIPHER_CTX* d_ctx = cipher_contexts.decryption(0, cipher, session_key.data(), initialization_vector.data());
 
-    if (!use_256_bits)
+    if (nullptr == d_ctx)
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
+        EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
+                "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
-                    "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
 
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
-    }
+    cipher_block_size = EVP_CIPHER_block_size(cipher);
 
     uint32_t protected_len = body_length;
     if (do_encryption)
@@ -2019,7 +2227,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             EPROSIMA_LOG_WARNING(SECURITY_CRYPTO, "Error in fastcdr trying to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2030,7 +2237,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
                 "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
@@ -2040,10 +2246,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     {
         EPROSIMA_LOG_WARNING(SECURITY_CRYPTO,
                 "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2147,7 +2351,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
         const EVP_CIPHER* d_cipher = nullptr;
 
         int actual_size = 0, final_size = 0;
@@ -2171,16 +2374,15 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         else
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
-                initialization_vector.data()))
+        EVP_CIPHER_CTX* d_ctx = cipher_contexts.decryption(first_receiver_context, d_cipher,
+                        specific_session_key.data(), initialization_vector.data());
+        if (nullptr == d_ctx)
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2188,7 +2390,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2196,7 +2397,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2204,11 +2404,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             EPROSIMA_LOG_ERROR(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
-
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
@@ -104,6 +104,9 @@ public:
             DatawriterCryptoHandle& sending_datawriter_crypto,
             SecurityException& exception) override;
 
+    //! Forget the session keys derived by every thread. Called when key material is unregistered or replaced.
+    static void clear_cached_session_keys();
+
     //Aux functions to compute session key from the master material
     void compute_sessionkey(
             std::array<uint8_t, 32>& session_key,
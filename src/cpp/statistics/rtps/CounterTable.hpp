@@ -0,0 +1,214 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CounterTable.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_COUNTERTABLE_HPP_
+#define _STATISTICS_RTPS_COUNTERTABLE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/Locator.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Hash table of the counters a participant keeps per locator or per remote participant.
+ * Entries are never removed until the table is destroyed, so buckets are lists where new entries are only pushed at
+ * the head, and looking a key up, or adding it, does not take any lock.
+ * Counters are expected to synchronize themselves, usually by being atomic.
+ */
+template<class Key, class Value, class Hash = std::hash<Key>>
+class CounterTable
+{
+public:
+
+    /**
+     * @param num_buckets  Number of buckets of the table. Rounded up to a power of two.
+     */
+    explicit CounterTable(
+            std::size_t num_buckets = 64u)
+    {
+        while (mask_ + 1u < num_buckets)
+        {
+            mask_ = (mask_ << 1u) | 1u;
+        }
+        buckets_.reset(new std::atomic<Node*>[mask_ + 1u]);
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            buckets_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~CounterTable()
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            Node* node = buckets_[i].load(std::memory_order_relaxed);
+            while (nullptr != node)
+            {
+                Node* next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+    }
+
+    CounterTable(
+            const CounterTable&) = delete;
+    CounterTable& operator =(
+            const CounterTable&) = delete;
+
+    /**
+     * Get the counters of a key, adding them if the key is not on the table yet.
+     *
+     * @param key  Key to look up.
+     * @return Reference to the counters of the key, valid for the lifetime of the table.
+     */
+    Value& get(
+            const Key& key)
+    {
+        std::atomic<Node*>& bucket = buckets_[hash_(key) & mask_];
+        Node* head = bucket.load(std::memory_order_acquire);
+        Node* found = find(head, nullptr, key);
+        if (nullptr != found)
+        {
+            return found->value;
+        }
+
+        std::unique_ptr<Node> node(new Node(key));
+        while (true)
+        {
+            node->next = head;
+            if (bucket.compare_exchange_weak(head, node.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return node.release()->value;
+            }
+
+            // Some entries were pushed meanwhile, and one of them may be the key
+            found = find(head, node->next, key);
+            if (nullptr != found)
+            {
+                return found->value;
+            }
+        }
+    }
+
+    /**
+     * Call a functor with every entry on the table.
+     *
+     * @param f  Functor receiving the key and the counters of each entry.
+     */
+    template<class Function>
+    void for_each(
+            Function f) const
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            Node* node = buckets_[i].load(std::memory_order_acquire);
+            while (nullptr != node)
+            {
+                f(node->key, node->value);
+                node = node->next;
+            }
+        }
+    }
+
+private:
+
+    struct Node
+    {
+        explicit Node(
+                const Key& k)
+            : key(k)
+        {
+        }
+
+        const Key key;
+        Value value;
+        Node* next = nullptr;
+    };
+
+    /**
+     * Look a key up on the entries of a bucket from @c first to @c last, not included.
+     */
+    Node* find(
+            Node* first,
+            Node* last,
+            const Key& key) const
+    {
+        for (Node* node = first; node != last; node = node->next)
+        {
+            if (node->key == key)
+            {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    std::size_t mask_ = 0;
+    std::unique_ptr<std::atomic<Node*>[]> buckets_;
+    Hash hash_;
+};
+
+//! Hash of locators, mixing their kind, port and address.
+struct LocatorHash
+{
+    std::size_t operator ()(
+            const fastdds::rtps::Locator_t& locator) const noexcept
+    {
+        uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(locator.kind)) << 32u) | locator.port;
+        for (std::size_t i = 0; i < sizeof(locator.address); ++i)
+        {
+            h = (h ^ locator.address[i]) * 0x100000001B3ull;
+        }
+        h ^= h >> 33u;
+        return static_cast<std::size_t>(h);
+    }
+
+};
+
+//! Hash of pairs of a participant GUID prefix and a locator.
+struct GuidPrefixLocatorHash
+{
+    std::size_t operator ()(
+            const std::pair<fastdds::rtps::GuidPrefix_t, fastdds::rtps::Locator_t>& key) const noexcept
+    {
+        uint64_t h = LocatorHash()(key.second);
+        for (std::size_t i = 0; i < fastdds::rtps::GuidPrefix_t::size; ++i)
+        {
+            h = (h ^ key.first.value[i]) * 0x100000001B3ull;
+        }
+        h ^= h >> 33u;
+        return static_cast<std::size_t>(h);
+    }
+
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_COUNTERTABLE_HPP_
@@ -172,6 +172,12 @@ std::recursive_mutex& StatisticsParticipantImpl::get_statistics_mutex()
     return statistics_mutex_;
 }
 
+void StatisticsParticipantImpl::update_listeners_snapshot()
+{
+    std::shared_ptr<const ProxyCollection> snapshot = std::make_shared<const ProxyCollection>(listeners_);
+    std::atomic_store(&listeners_snapshot_, snapshot);
+}
+
 bool StatisticsParticipantImpl::are_statistics_writers_enabled(
         uint32_t checked_enabled_writers)
 {
@@ -268,6 +274,8 @@ bool StatisticsParticipantImpl::add_statistics_listener(
         proxy.mask(new_mask);
     }
 
+    update_listeners_snapshot();
+
     // no other mutex should be taken in order to prevent ABBA deadlocks
     lock.unlock();
 
@@ -338,6 +346,8 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
         listeners_.erase(it);
     }
 
+    update_listeners_snapshot();
+
     // no other mutex should be taken in order to prevent ABBA deadlocks
     lock.unlock();
 
@@ -438,8 +448,8 @@ void StatisticsParticipantImpl::process_network_sequence(
     Entity2LocatorTraffic notification;
 
     {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        lost_traffic_value& value = lost_traffic_[key];
+        lost_traffic_value& value = lost_traffic_.get(key);
+        std::lock_guard<std::mutex> lock(value.mutex);
 
         if (value.first_sequence > seq.sequence)
         {
@@ -513,12 +523,12 @@ void StatisticsParticipantImpl::on_rtps_sent(
     notification.dst_locator(to_statistics_type(loc));
 
     {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-
-        auto& val = traffic_[loc];
-        notification.packet_count(++val.packet_count);
-        notification.byte_count(val.byte_count += payload_size);
-        notification.byte_magnitude_order((int16_t)floor(log10(float(val.byte_count))));
+        auto& val = traffic_.get(loc);
+        unsigned long long byte_count = val.byte_count.fetch_add(payload_size, std::memory_order_relaxed) +
+                payload_size;
+        notification.packet_count(val.packet_count.fetch_add(1u, std::memory_order_relaxed) + 1u);
+        notification.byte_count(byte_count);
+        notification.byte_magnitude_order((int16_t)floor(log10(float(byte_count))));
     }
 
     // Perform the callbacks
@@ -605,11 +615,7 @@ void StatisticsParticipantImpl::on_pdp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        pdp_counter_ += packages;
-        notification.count(pdp_counter_);
-    }
+    notification.count(pdp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
@@ -634,11 +640,7 @@ void StatisticsParticipantImpl::on_edp_packet(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(get_statistics_mutex());
-        edp_counter_ += packages;
-        notification.count(edp_counter_);
-    }
+    notification.count(edp_counter_.fetch_add(packages, std::memory_order_relaxed) + packages);
 
     // Perform the callbacks
     Data data;
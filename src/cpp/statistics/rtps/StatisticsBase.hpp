@@ -21,7 +21,7 @@
 
 #include <atomic>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 
@@ -31,6 +31,7 @@
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SampleIdentity.h>
 #include <fastdds/statistics/rtps/StatisticsCommon.hpp>
+#include <statistics/rtps/CounterTable.hpp>
 #include <statistics/rtps/GuidUtils.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 #include <statistics/types/types.hpp>
@@ -59,9 +60,9 @@ struct StatisticsAncillary
 struct StatisticsWriterAncillary
     : public StatisticsAncillary
 {
-    unsigned long long data_counter = {};
-    unsigned long long gap_counter = {};
-    unsigned long long resent_counter = {};
+    std::atomic<unsigned long long> data_counter{0};
+    std::atomic<unsigned long long> gap_counter{0};
+    std::atomic<unsigned long long> resent_counter{0};
     std::chrono::time_point<std::chrono::steady_clock> last_history_change_ = std::chrono::steady_clock::now();
 };
 
@@ -109,26 +110,28 @@ private:
     // RTPS_SENT ancillary
     struct rtps_sent_data
     {
-        unsigned long long packet_count = {};
-        unsigned long long byte_count = {};
+        std::atomic<unsigned long long> packet_count{0};
+        std::atomic<unsigned long long> byte_count{0};
     };
 
-    std::map<fastdds::rtps::Locator_t, rtps_sent_data> traffic_;
+    CounterTable<fastdds::rtps::Locator_t, rtps_sent_data, LocatorHash> traffic_;
 
     // RTPS_LOST ancillary
     using lost_traffic_key = std::pair<fastdds::rtps::GuidPrefix_t, fastdds::rtps::Locator_t>;
     struct lost_traffic_value
     {
+        // Datagrams from a participant to a locator are processed in order, so each entry has its own mutex
+        std::mutex mutex;
         uint64_t first_sequence = 0;
         Entity2LocatorTraffic data{};
         rtps::StatisticsSubmessageData::Sequence seq_data{};
     };
-    std::map<lost_traffic_key, lost_traffic_value> lost_traffic_;
+    CounterTable<lost_traffic_key, lost_traffic_value, GuidPrefixLocatorHash> lost_traffic_;
 
     // PDP_PACKETS ancillary
-    unsigned long long pdp_counter_ = {};
+    std::atomic<unsigned long long> pdp_counter_{0};
     // EDP_PACKETS ancillary
-    unsigned long long edp_counter_ = {};
+    std::atomic<unsigned long long> edp_counter_{0};
 
     // Mask of enabled statistics writers
     std::atomic<uint32_t> enabled_writers_mask_{0};
@@ -193,6 +196,12 @@ protected:
     using ProxyCollection = std::set<Key, CompareProxies>;
     ProxyCollection listeners_;
 
+    // Copy of listeners_ traversed when reporting, replaced whenever listeners_ changes
+    std::shared_ptr<const ProxyCollection> listeners_snapshot_;
+
+    // update listeners_snapshot_ after modifying listeners_, with the statistics mutex taken
+    void update_listeners_snapshot();
+
     // retrieve the participant mutex
     std::recursive_mutex& get_statistics_mutex();
 
@@ -245,13 +254,14 @@ protected:
     Function for_each_listener(
             Function f)
     {
-        std::unique_lock<std::recursive_mutex> lock(get_statistics_mutex());
-        auto temp_listeners = listeners_;
-        lock.unlock();
-
-        for (auto& listener : temp_listeners)
+        // Traverse the current snapshot, so reporting does not take the statistics mutex
+        std::shared_ptr<const ProxyCollection> temp_listeners = std::atomic_load(&listeners_snapshot_);
+        if (temp_listeners)
         {
-            f(listener);
+            for (auto& listener : *temp_listeners)
+            {
+                f(listener);
+            }
         }
 
         return f;
@@ -90,9 +90,7 @@ void StatisticsWriterImpl::on_sample_datas(
 void StatisticsWriterImpl::on_data_generated(
         size_t num_destinations)
 {
-    std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-    auto members = get_members();
-    members->data_counter += static_cast<uint64_t>(num_destinations);
+    get_members()->data_counter.fetch_add(static_cast<uint64_t>(num_destinations), std::memory_order_relaxed);
 }
 
 void StatisticsWriterImpl::on_data_sent()
@@ -105,11 +103,7 @@ void StatisticsWriterImpl::on_data_sent()
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        auto members = get_members();
-        notification.count(members->data_counter);
-    }
+    notification.count(get_members()->data_counter.load(std::memory_order_relaxed));
 
     // Perform the callbacks
     Data data;
@@ -157,10 +151,7 @@ void StatisticsWriterImpl::on_gap()
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(++get_members()->gap_counter);
-    }
+    notification.count(get_members()->gap_counter.fetch_add(1u, std::memory_order_relaxed) + 1u);
 
     // Perform the callbacks
     Data data;
@@ -190,10 +181,7 @@ void StatisticsWriterImpl::on_resent_data(
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
 
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(get_members()->resent_counter += to_send);
-    }
+    notification.count(get_members()->resent_counter.fetch_add(to_send, std::memory_order_relaxed) + to_send);
 
     // Perform the callbacks
     Data data;
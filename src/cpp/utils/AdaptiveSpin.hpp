@@ -0,0 +1,127 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AdaptiveSpin.hpp
+ */
+
+#ifndef _FASTDDS_UTILS_ADAPTIVESPIN_HPP_
+#define _FASTDDS_UTILS_ADAPTIVESPIN_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif // if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * Busy wait a listening thread does before blocking on a condition variable.
+ *
+ * The time spent spinning adapts to the traffic: it is halved every time the spin ends without the awaited condition,
+ * down to a sixteenth of the configured budget, and restored to the whole budget as soon as a spin succeeds.
+ * A budget of zero disables spinning.
+ */
+class AdaptiveSpin
+{
+public:
+
+    /**
+     * @param max_spin_us  Maximum time to spin, in microseconds.
+     */
+    explicit AdaptiveSpin(
+            uint32_t max_spin_us = 0)
+        : max_spin_us_(max_spin_us)
+        , min_spin_us_((max_spin_us + 15u) / 16u)
+        , spin_us_(max_spin_us)
+    {
+    }
+
+    //! Whether spinning is enabled.
+    bool enabled() const
+    {
+        return 0u != max_spin_us_;
+    }
+
+    //! Configured budget, in microseconds.
+    uint32_t max_spin_us() const
+    {
+        return max_spin_us_;
+    }
+
+    /**
+     * Spin until a condition holds or the current budget expires.
+     *
+     * @param condition  Functor returning whether the awaited condition holds.
+     * @return Whether the condition holds.
+     */
+    template<class Predicate>
+    bool spin(
+            Predicate condition)
+    {
+        if (!enabled())
+        {
+            return condition();
+        }
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_us_);
+        do
+        {
+            if (condition())
+            {
+                spin_us_ = max_spin_us_;
+                return true;
+            }
+            cpu_relax();
+        } while (std::chrono::steady_clock::now() < deadline);
+
+        bool ret = condition();
+        if (ret)
+        {
+            spin_us_ = max_spin_us_;
+        }
+        else if (spin_us_ > min_spin_us_)
+        {
+            spin_us_ = spin_us_ / 2u > min_spin_us_ ? spin_us_ / 2u : min_spin_us_;
+        }
+        return ret;
+    }
+
+private:
+
+    //! Hint the processor that the thread is busy waiting.
+    static void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__ ("yield");
+#else
+        std::this_thread::yield();
+#endif // if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    }
+
+    uint32_t max_spin_us_;
+    uint32_t min_spin_us_;
+    uint32_t spin_us_;
+};
+
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UTILS_ADAPTIVESPIN_HPP_
@@ -257,9 +257,15 @@ void SystemInfo::stop_watching_file(
 
 std::string SystemInfo::get_timestamp(
         const char* format)
+{
+    return get_timestamp(std::chrono::system_clock::now(), format);
+}
+
+std::string SystemInfo::get_timestamp(
+        const std::chrono::system_clock::time_point& now,
+        const char* format)
 {
     std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
     std::time_t now_c = std::chrono::system_clock::to_time_t(now);
     std::chrono::system_clock::duration tp = now.time_since_epoch();
     tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
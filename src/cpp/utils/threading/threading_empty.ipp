@@ -38,6 +38,15 @@ void set_name_to_current_thread(
 {
 }
 
+void set_name_to_current_thread(
+        std::array<char, 16>& /* thread_name_buffer */,
+        const char* /* fmt */,
+        uint32_t /* arg1 */,
+        uint32_t /* arg2 */,
+        uint32_t /* arg3 */)
+{
+}
+
 void apply_thread_settings_to_current_thread(
         const char* /* thread_name */,
         const fastdds::rtps::ThreadSettings& /*settings*/)
@@ -61,6 +61,16 @@ void set_name_to_current_thread(
     set_name_to_current_thread_impl(thread_name_buffer, fmt, arg1, arg2);
 }
 
+void set_name_to_current_thread(
+        std::array<char, 16>& thread_name_buffer,
+        const char* fmt,
+        uint32_t arg1,
+        uint32_t arg2,
+        uint32_t arg3)
+{
+    set_name_to_current_thread_impl(thread_name_buffer, fmt, arg1, arg2, arg3);
+}
+
 static void configure_current_thread_priority(
         const char* thread_name,
         int32_t priority)
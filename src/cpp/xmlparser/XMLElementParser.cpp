@@ -930,6 +930,8 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:element name="scheduler" type="flowControllerSchedulerPolicy" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="max_bytes_per_period" type="int32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="period_ms" type="uint64" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="max_burst_bytes" type="uint32" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="sender_threads" type="uint32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="sender_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
             </xs:complexType>
@@ -1012,6 +1014,24 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, MAX_BURST_BYTES) == 0)
+            {
+                // max_burst_bytes - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux1, &flow_controller_descriptor->max_burst_bytes, ident))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            else if (strcmp(name, SENDER_THREADS) == 0)
+            {
+                // sender_threads - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux1, &flow_controller_descriptor->sender_threads, ident) ||
+                        0 == flow_controller_descriptor->sender_threads)
+                {
+                    EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << SENDER_THREADS << "' with bad content");
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, SENDER_THREAD) == 0)
             {
                 // sender_thread - threadSettingsType
@@ -2189,6 +2209,7 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 </xs:element>
                 <xs:element name="max_domains" type="uint32" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="data_sharing_listener_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_spin_budget_us" type="uint32" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2300,6 +2321,15 @@ XMLP_ret XMLParser::getXMLDataSharingQos(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, LISTENER_SPIN_BUDGET_US) == 0)
+        {
+            uint32_t spin_budget_us = 0;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &spin_budget_us, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            data_sharing.listener_spin_budget_us(spin_budget_us);
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found in 'data_sharing'. Name: " << name);
@@ -47,6 +47,8 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* RECEIVE_BATCH_SIZE = "receive_batch_size";
+const char* SEND_BATCH_SIZE = "send_batch_size";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* NETWORK_INTERFACE = "interface";
 const char* NETMASK_FILTER = "netmask_filter";
@@ -68,6 +70,7 @@ const char* CHECK_CRC = "check_crc";
 const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 const char* ACCEPT_THREAD = "accept_thread";
 const char* TCP_NEGOTIATION_TIMEOUT = "tcp_negotiation_timeout";
+const char* REACTOR_THREADS = "reactor_threads";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
@@ -76,6 +79,7 @@ const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* LISTENER_SPIN_BUDGET_US = "listener_spin_budget_us";
 const char* DEFAULT_RECEPTION_THREADS = "default_reception_threads";
 const char* RECEPTION_THREADS = "reception_threads";
 const char* RECEPTION_THREAD = "reception_thread";
@@ -286,6 +290,8 @@ const char* SCHEDULER = "scheduler";
 const char* SENDER_THREAD = "sender_thread";
 const char* MAX_BYTES_PER_PERIOD = "max_bytes_per_period";
 const char* PERIOD_MILLISECS = "period_ms";
+const char* MAX_BURST_BYTES = "max_burst_bytes";
+const char* SENDER_THREADS = "sender_threads";
 const char* FLOW_CONTROLLER_NAME = "flow_controller_name";
 const char* FIFO = "FIFO";
 const char* HIGH_PRIORITY = "HIGH_PRIORITY";
@@ -60,6 +60,8 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* RECEIVE_BATCH_SIZE;
+extern const char* SEND_BATCH_SIZE;
 extern const char* WHITE_LIST;
 extern const char* NETWORK_INTERFACE;
 extern const char* NETMASK_FILTER;
@@ -81,6 +83,7 @@ extern const char* CHECK_CRC;
 extern const char* KEEP_ALIVE_THREAD;
 extern const char* ACCEPT_THREAD;
 extern const char* TCP_NEGOTIATION_TIMEOUT;
+extern const char* REACTOR_THREADS;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
@@ -89,6 +92,7 @@ extern const char* HEALTHY_CHECK_TIMEOUT_MS;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* LISTENER_SPIN_BUDGET_US;
 extern const char* DEFAULT_RECEPTION_THREADS;
 extern const char* RECEPTION_THREADS;
 extern const char* RECEPTION_THREAD;
@@ -304,6 +308,8 @@ extern const char* ROUND_ROBIN;
 extern const char* PRIORITY_WITH_RESERVATION;
 extern const char* FLOW_CONTROLLER_NAME;
 extern const char* PERIOD_MILLISECS;
+extern const char* MAX_BURST_BYTES;
+extern const char* SENDER_THREADS;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -11654,7 +11654,11 @@ TEST_F(DynamicTypesTests, DynamicType_structure)
     }
     EXPECT_EQ(loan_data->get_int64_value(test4, MEMBER_ID_INVALID), RETCODE_OK);
     EXPECT_EQ(test3, test4);
+    EXPECT_EQ(loan_data->set_int64_value(MEMBER_ID_INVALID, test3 + 1), RETCODE_OK);
     EXPECT_EQ(struct_data->return_loaned_value(loan_data), RETCODE_OK);
+    EXPECT_EQ(struct_data->get_int64_value(test4, 1), RETCODE_OK);
+    EXPECT_EQ(test3 + 1, test4);
+    EXPECT_EQ(struct_data->set_int64_value(1, test3), RETCODE_OK);
     {
         eprosima::fastdds::testing::ScopeLogs _("disable");
         EXPECT_FALSE(struct_data->loan_value(MEMBER_ID_INVALID));
@@ -11705,6 +11709,205 @@ TEST_F(DynamicTypesTests, DynamicType_structure)
     EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
 }
 
+TEST_F(DynamicTypesTests, DynamicType_structure_primitive_runs)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    // Consecutive members of the same kind are serialized as an array, while in the same structure with alternated
+    // signed and unsigned kinds, which are encoded the same way, every member is serialized on its own.
+    auto create_struct = [&](const std::string& name, ExtensibilityKind extensibility, bool alternate_kinds)
+            {
+                TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+                type_descriptor->kind(TK_STRUCTURE);
+                type_descriptor->name(name);
+                type_descriptor->extensibility_kind(extensibility);
+                DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+
+                std::vector<TypeKind> kinds {TK_INT32, TK_INT32, TK_INT32, TK_FLOAT64, TK_STRING8, TK_INT16, TK_INT16,
+                                             TK_INT64, TK_INT64};
+                for (size_t index = 0; index < kinds.size(); ++index)
+                {
+                    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+                    member_descriptor->name("member_" + std::to_string(index));
+                    if (TK_STRING8 == kinds[index])
+                    {
+                        member_descriptor->type(factory->create_string_type(20)->build());
+                    }
+                    else if (alternate_kinds && 1 == index % 2)
+                    {
+                        member_descriptor->type(factory->get_primitive_type(
+                                    TK_INT32 == kinds[index] ? TK_UINT32 :
+                                    TK_INT16 == kinds[index] ? TK_UINT16 :
+                                    TK_INT64 == kinds[index] ? TK_UINT64 : kinds[index]));
+                    }
+                    else
+                    {
+                        member_descriptor->type(factory->get_primitive_type(kinds[index]));
+                    }
+                    EXPECT_EQ(RETCODE_OK, builder->add_member(member_descriptor));
+                }
+
+                return builder->build();
+            };
+
+    auto fill_struct = [](DynamicData::_ref_type data)
+            {
+                for (MemberId id = 0; id < 9; ++id)
+                {
+                    DynamicTypeMember::_ref_type member;
+                    ASSERT_EQ(RETCODE_OK, data->type()->get_member(member, id));
+                    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+                    ASSERT_EQ(RETCODE_OK, member->get_descriptor(member_descriptor));
+                    switch (member_descriptor->type()->get_kind())
+                    {
+                        case TK_INT16:
+                            EXPECT_EQ(RETCODE_OK, data->set_int16_value(id, static_cast<int16_t>(id + 1)));
+                            break;
+                        case TK_UINT16:
+                            EXPECT_EQ(RETCODE_OK, data->set_uint16_value(id, static_cast<uint16_t>(id + 1)));
+                            break;
+                        case TK_INT32:
+                            EXPECT_EQ(RETCODE_OK, data->set_int32_value(id, static_cast<int32_t>(id + 1)));
+                            break;
+                        case TK_UINT32:
+                            EXPECT_EQ(RETCODE_OK, data->set_uint32_value(id, id + 1));
+                            break;
+                        case TK_INT64:
+                            EXPECT_EQ(RETCODE_OK, data->set_int64_value(id, static_cast<int64_t>(id + 1)));
+                            break;
+                        case TK_UINT64:
+                            EXPECT_EQ(RETCODE_OK, data->set_uint64_value(id, id + 1));
+                            break;
+                        case TK_FLOAT64:
+                            EXPECT_EQ(RETCODE_OK, data->set_float64_value(id, id + 1.5));
+                            break;
+                        default:
+                            EXPECT_EQ(RETCODE_OK, data->set_string_value(id, std::to_string(id + 1)));
+                            break;
+                    }
+                }
+            };
+
+    for (auto extensibility : {ExtensibilityKind::FINAL, ExtensibilityKind::APPENDABLE, ExtensibilityKind::MUTABLE})
+    {
+        DynamicType::_ref_type runs_type {create_struct("RunsStruct", extensibility, false)};
+        ASSERT_TRUE(runs_type);
+        DynamicType::_ref_type alternate_type {create_struct("AlternateStruct", extensibility, true)};
+        ASSERT_TRUE(alternate_type);
+
+        DynamicData::_ref_type runs_data {DynamicDataFactory::get_instance()->create_data(runs_type)};
+        fill_struct(runs_data);
+        DynamicData::_ref_type alternate_data {DynamicDataFactory::get_instance()->create_data(alternate_type)};
+        fill_struct(alternate_data);
+
+        for (auto encoding : encodings)
+        {
+            TypeSupport runs_pubsub {new DynamicPubSubType(runs_type)};
+            TypeSupport alternate_pubsub {new DynamicPubSubType(alternate_type)};
+            uint32_t payload_size =
+                    static_cast<uint32_t>(runs_pubsub.get_serialized_size_provider(&runs_data, encoding)());
+            EXPECT_EQ(payload_size,
+                    static_cast<uint32_t>(alternate_pubsub.get_serialized_size_provider(&alternate_data,
+                    encoding)()));
+            SerializedPayload_t runs_payload(payload_size);
+            SerializedPayload_t alternate_payload(payload_size);
+            ASSERT_TRUE(runs_pubsub.serialize(&runs_data, &runs_payload, encoding));
+            ASSERT_TRUE(alternate_pubsub.serialize(&alternate_data, &alternate_payload, encoding));
+            ASSERT_EQ(runs_payload.length, payload_size);
+            ASSERT_EQ(alternate_payload.length, payload_size);
+            EXPECT_EQ(0, memcmp(runs_payload.data, alternate_payload.data, payload_size));
+
+            DynamicData::_ref_type runs_data2 {DynamicDataFactory::get_instance()->create_data(runs_type)};
+            encoding_decoding_test(runs_type, runs_data, runs_data2, encoding);
+            EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(runs_data2), RETCODE_OK);
+        }
+
+        EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(runs_data), RETCODE_OK);
+        EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(alternate_data), RETCODE_OK);
+    }
+}
+
+TEST_F(DynamicTypesTests, DynamicType_appendable_structure_shorter_sample)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    // Appendable structure with a run of int32 members, nested on a final one which has a member after it.
+    auto create_struct = [&](uint32_t members_count)
+            {
+                TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+                type_descriptor->kind(TK_STRUCTURE);
+                type_descriptor->name("InnerStruct");
+                type_descriptor->extensibility_kind(ExtensibilityKind::APPENDABLE);
+                DynamicTypeBuilder::_ref_type inner_builder {factory->create_type(type_descriptor)};
+                for (uint32_t index = 0; index < members_count; ++index)
+                {
+                    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+                    member_descriptor->name("member_" + std::to_string(index));
+                    member_descriptor->type(factory->get_primitive_type(TK_INT32));
+                    EXPECT_EQ(RETCODE_OK, inner_builder->add_member(member_descriptor));
+                }
+
+                type_descriptor = traits<TypeDescriptor>::make_shared();
+                type_descriptor->kind(TK_STRUCTURE);
+                type_descriptor->name("OuterStruct");
+                type_descriptor->extensibility_kind(ExtensibilityKind::FINAL);
+                DynamicTypeBuilder::_ref_type outer_builder {factory->create_type(type_descriptor)};
+                MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+                member_descriptor->name("inner");
+                member_descriptor->type(inner_builder->build());
+                EXPECT_EQ(RETCODE_OK, outer_builder->add_member(member_descriptor));
+                member_descriptor = traits<MemberDescriptor>::make_shared();
+                member_descriptor->name("after");
+                member_descriptor->type(factory->get_primitive_type(TK_INT32));
+                EXPECT_EQ(RETCODE_OK, outer_builder->add_member(member_descriptor));
+
+                return outer_builder->build();
+            };
+
+    DynamicType::_ref_type short_type {create_struct(2)};
+    ASSERT_TRUE(short_type);
+    DynamicType::_ref_type long_type {create_struct(4)};
+    ASSERT_TRUE(long_type);
+
+    DynamicData::_ref_type short_data {DynamicDataFactory::get_instance()->create_data(short_type)};
+    DynamicData::_ref_type inner_data {short_data->loan_value(0)};
+    ASSERT_TRUE(inner_data);
+    EXPECT_EQ(RETCODE_OK, inner_data->set_int32_value(0, 10));
+    EXPECT_EQ(RETCODE_OK, inner_data->set_int32_value(1, 11));
+    EXPECT_EQ(RETCODE_OK, short_data->return_loaned_value(inner_data));
+    EXPECT_EQ(RETCODE_OK, short_data->set_int32_value(1, 20));
+
+    // Only XCDRv2 delimits appendable structures.
+    TypeSupport short_pubsub {new DynamicPubSubType(short_type)};
+    TypeSupport long_pubsub {new DynamicPubSubType(long_type)};
+    uint32_t payload_size =
+            static_cast<uint32_t>(short_pubsub.get_serialized_size_provider(&short_data,
+            XCDR2_DATA_REPRESENTATION)());
+    SerializedPayload_t payload(payload_size);
+    ASSERT_TRUE(short_pubsub.serialize(&short_data, &payload, XCDR2_DATA_REPRESENTATION));
+
+    DynamicData::_ref_type long_data {DynamicDataFactory::get_instance()->create_data(long_type)};
+    ASSERT_TRUE(long_pubsub.deserialize(&payload, &long_data));
+
+    int32_t value {0};
+    inner_data = long_data->loan_value(0);
+    ASSERT_TRUE(inner_data);
+    EXPECT_EQ(RETCODE_OK, inner_data->get_int32_value(value, 0));
+    EXPECT_EQ(10, value);
+    EXPECT_EQ(RETCODE_OK, inner_data->get_int32_value(value, 1));
+    EXPECT_EQ(11, value);
+    EXPECT_EQ(RETCODE_OK, inner_data->get_int32_value(value, 2));
+    EXPECT_EQ(0, value);
+    EXPECT_EQ(RETCODE_OK, inner_data->get_int32_value(value, 3));
+    EXPECT_EQ(0, value);
+    EXPECT_EQ(RETCODE_OK, long_data->return_loaned_value(inner_data));
+    EXPECT_EQ(RETCODE_OK, long_data->get_int32_value(value, 1));
+    EXPECT_EQ(20, value);
+
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(short_data), RETCODE_OK);
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(long_data), RETCODE_OK);
+}
+
 TEST_F(DynamicTypesTests, DynamicType_structure_inheritance)
 {
     DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
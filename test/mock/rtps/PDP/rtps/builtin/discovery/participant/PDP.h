@@ -101,6 +101,14 @@ public:
 
     MOCK_METHOD0(ParticipantProxiesEnd, ResourceLimitedVector<ParticipantProxyData*>::const_iterator());
 
+    MOCK_METHOD(void, readers_on_topic, (
+            const fastcdr::string_255& topic_name,
+            std::vector<ReaderProxyData*>& readers), (const));
+
+    MOCK_METHOD(void, writers_on_topic, (
+            const fastcdr::string_255& topic_name,
+            std::vector<WriterProxyData*>& writers), (const));
+
     MOCK_METHOD(RTPSParticipantImpl*, getRTPSParticipant, (), (const));
 
     ProxyPool<ReaderProxyData>& get_temporary_reader_proxies_pool()
@@ -22,6 +22,7 @@
 #include <atomic>
 #include <map>
 #include <sstream>
+#include <string>
 
 #include <gmock/gmock.h>
 
@@ -349,6 +350,23 @@ public:
 
     MOCK_METHOD(bool, update_removed_participant, (rtps::LocatorList_t&));
 
+    std::string compression_locator_kinds() const
+    {
+        return std::string();
+    }
+
+    void add_compression_peer(
+            const LocatorList_t&,
+            const std::string&)
+    {
+    }
+
+    void remove_compression_peer(
+            const LocatorList_t&,
+            const std::string&)
+    {
+    }
+
     uint32_t getRTPSParticipantID() const
     {
         return 0;
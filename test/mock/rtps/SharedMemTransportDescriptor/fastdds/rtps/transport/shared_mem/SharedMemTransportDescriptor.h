@@ -123,6 +123,17 @@ typedef struct SharedMemTransportDescriptor : public PortBasedTransportDescripto
         dump_thread_ = dump_thread;
     }
 
+    FASTDDS_EXPORTED_API uint32_t listener_spin_budget_us() const
+    {
+        return listener_spin_budget_us_;
+    }
+
+    FASTDDS_EXPORTED_API void listener_spin_budget_us(
+            uint32_t listener_spin_budget_us)
+    {
+        listener_spin_budget_us_ = listener_spin_budget_us;
+    }
+
 private:
 
     uint32_t segment_size_;
@@ -130,6 +141,7 @@ private:
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
     ThreadSettings dump_thread_;
+    uint32_t listener_spin_budget_us_ = 0;
 
 }SharedMemTransportDescriptor;
 
@@ -0,0 +1,241 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ChangePoolBenchmark.cpp
+ *
+ * Measures the reception of samples by several threads on a history with a fixed depth, where every sample needs a
+ * change reserved from the CacheChangePool of the reader, and the oldest one is released when the history is full.
+ * It compares using the pool while holding the history mutex, as readers did before, with reserving and releasing the
+ * changes out of it, which the pool allows now.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <rtps/history/CacheChangePool.h>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct Measurement
+{
+    double sample_ns = 0;
+    uint64_t samples = 0;
+};
+
+/**
+ * History of a reader, guarded by its own mutex.
+ */
+struct BenchmarkHistory
+{
+    std::mutex mutex;
+    std::deque<CacheChange_t*> changes;
+};
+
+/**
+ * Run @c threads_count threads receiving @c samples samples each on a history of @c depth changes.
+ */
+Measurement run(
+        MemoryManagementPolicy_t policy,
+        uint32_t threads_count,
+        uint32_t samples,
+        uint32_t depth,
+        bool pool_out_of_lock)
+{
+    // Room for the history plus the change each thread may be holding
+    PoolConfig config {policy, 0, depth + threads_count, depth + threads_count};
+    CacheChangePool pool(config);
+    BenchmarkHistory history;
+    std::atomic<uint64_t> received {0};
+
+    auto receive = [&](uint32_t thread_id)
+            {
+                uint64_t added = 0;
+                for (uint32_t i = 0; i < samples; ++i)
+                {
+                    CacheChange_t* change = nullptr;
+                    CacheChange_t* removed = nullptr;
+
+                    if (pool_out_of_lock && !pool.reserve_cache(change))
+                    {
+                        continue;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(history.mutex);
+                        if (!pool_out_of_lock && !pool.reserve_cache(change))
+                        {
+                            continue;
+                        }
+
+                        change->sequenceNumber.high = static_cast<int32_t>(thread_id);
+                        change->sequenceNumber.low = i;
+                        history.changes.push_back(change);
+                        ++added;
+
+                        if (history.changes.size() > depth)
+                        {
+                            removed = history.changes.front();
+                            history.changes.pop_front();
+                            if (!pool_out_of_lock)
+                            {
+                                pool.release_cache(removed);
+                            }
+                        }
+                    }
+
+                    if (pool_out_of_lock && nullptr != removed)
+                    {
+                        pool.release_cache(removed);
+                    }
+                }
+                received += added;
+            };
+
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back(receive, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Measurement measurement;
+    measurement.samples = received;
+    measurement.sample_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / (static_cast<double>(threads_count) * samples);
+
+    for (CacheChange_t* change : history.changes)
+    {
+        pool.release_cache(change);
+    }
+    return measurement;
+}
+
+const char* policy_name(
+        MemoryManagementPolicy_t policy)
+{
+    switch (policy)
+    {
+        case PREALLOCATED_MEMORY_MODE:
+            return "preallocated";
+        case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+            return "prealloc_realloc";
+        case DYNAMIC_RESERVE_MEMORY_MODE:
+            return "dynamic";
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            return "dynamic_reusable";
+    }
+    return "unknown";
+}
+
+void usage()
+{
+    printf("Usage: ChangePoolBenchmark [--max-threads <n>] [--samples <n>] [--depth <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 8;
+    uint32_t samples = 200000;
+    uint32_t depth = 100;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-threads")
+        {
+            max_threads = value;
+        }
+        else if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--depth")
+        {
+            depth = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_threads || 0 == samples || 0 == depth)
+    {
+        usage();
+        return 1;
+    }
+
+    const MemoryManagementPolicy_t policies[] = {
+        PREALLOCATED_MEMORY_MODE,
+        PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
+        DYNAMIC_RESERVE_MEMORY_MODE,
+        DYNAMIC_REUSABLE_MEMORY_MODE
+    };
+
+    printf("[   Threads][            Policy][           Pool use][ Sample(ns)][     Samples]\n");
+    for (uint32_t threads_count = 1; threads_count <= max_threads; threads_count *= 2)
+    {
+        uint64_t expected = static_cast<uint64_t>(threads_count) * samples;
+
+        for (MemoryManagementPolicy_t policy : policies)
+        {
+            Measurement in_lock = run(policy, threads_count, samples, depth, false);
+            Measurement out_of_lock = run(policy, threads_count, samples, depth, true);
+
+            printf("%12u,%19s,%20s,%12.1f,%13llu\n", threads_count, policy_name(policy), "in history lock",
+                    in_lock.sample_ns, static_cast<unsigned long long>(in_lock.samples));
+            printf("%12u,%19s,%20s,%12.1f,%13llu\n", threads_count, policy_name(policy), "out of history lock",
+                    out_of_lock.sample_ns, static_cast<unsigned long long>(out_of_lock.samples));
+
+            if (in_lock.samples != expected || out_of_lock.samples != expected)
+            {
+                printf("Only %llu and %llu samples were received instead of %llu\n",
+                        static_cast<unsigned long long>(in_lock.samples),
+                        static_cast<unsigned long long>(out_of_lock.samples),
+                        static_cast<unsigned long long>(expected));
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
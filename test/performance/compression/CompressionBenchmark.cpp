@@ -0,0 +1,292 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CompressionBenchmark.cpp
+ *
+ * Measures the compression of the messages carrying user data by the compression transport, over payloads
+ * representative of usual topics: compression ratio, CPU time and throughput, with and without the adaptive mode.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/transport/CompressionTransportDescriptor.h>
+
+#include <rtps/transport/compression/MessageCompressor.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct Measurement
+{
+    //! Original bytes divided by the bytes sent.
+    double ratio = 0;
+    //! Percentage of messages sent compressed.
+    double compressed_percent = 0;
+    //! Original bytes processed per second when sending.
+    double encode_mb_s = 0;
+    //! Original bytes recovered per second when receiving.
+    double decode_mb_s = 0;
+    //! CPU time per message when sending.
+    double encode_cpu_us = 0;
+    //! Every message was received as it was sent.
+    bool valid = true;
+};
+
+//! Point cloud of a lidar: x, y, z and intensity as floats, of points along consecutive rings.
+std::vector<octet> point_cloud(
+        uint32_t size,
+        std::mt19937& generator)
+{
+    std::normal_distribution<float> noise(0.0f, 0.01f);
+    std::vector<octet> payload(size);
+    const uint32_t point_size = 4 * sizeof(float);
+    for (uint32_t i = 0; i + point_size <= size; i += point_size)
+    {
+        uint32_t point = i / point_size;
+        float angle = static_cast<float>(point % 360) * 0.0174533f;
+        float range = 10.0f + static_cast<float>(point / 360) * 0.5f + noise(generator);
+        float values[4] = {range * std::cos(angle), range * std::sin(angle), -1.5f, 100.0f};
+        std::memcpy(&payload[i], values, sizeof(values));
+    }
+    return payload;
+}
+
+//! Occupancy grid of a map: long runs of free and unknown cells, with some occupied ones.
+std::vector<octet> occupancy_grid(
+        uint32_t size,
+        std::mt19937& generator)
+{
+    std::vector<octet> payload(size);
+    uint32_t i = 0;
+    while (i < size)
+    {
+        uint32_t run = 1 + generator() % 64;
+        uint32_t kind = generator() % 10;
+        octet value = kind < 6 ? 0 : (kind < 9 ? 0xFF : 100);
+        for (uint32_t end = std::min(size, i + run); i < end; ++i)
+        {
+            payload[i] = value;
+        }
+    }
+    return payload;
+}
+
+//! Text with json records of a diagnostics topic.
+std::vector<octet> json_text(
+        uint32_t size,
+        std::mt19937& generator)
+{
+    std::string text;
+    while (text.size() < size)
+    {
+        text += "{\"name\": \"motor_" + std::to_string(generator() % 8) + "\", \"level\": " +
+                std::to_string(generator() % 3) + ", \"message\": \"temperature nominal\", \"values\": [" +
+                std::to_string(generator() % 1000) + ", " + std::to_string(generator() % 1000) + "]}\n";
+    }
+    return std::vector<octet>(text.begin(), text.begin() + size);
+}
+
+//! Already compressed or encrypted data, like video streams.
+std::vector<octet> random_bytes(
+        uint32_t size,
+        std::mt19937& generator)
+{
+    std::vector<octet> payload(size);
+    for (octet& byte : payload)
+    {
+        byte = static_cast<octet>(generator());
+    }
+    return payload;
+}
+
+//! RTPS message with a DATA submessage of a user writer carrying a payload.
+std::vector<octet> rtps_message(
+        const std::vector<octet>& payload)
+{
+    std::vector<octet> message = {'R', 'T', 'P', 'S', 2, 3, 1, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    const octet info_ts[] = {0x09, 0x01, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+    message.insert(message.end(), std::begin(info_ts), std::end(info_ts));
+    uint32_t length = static_cast<uint32_t>(20 + payload.size());
+    const octet data[] = {
+        0x15, 0x05, static_cast<octet>(length), static_cast<octet>(length >> 8),
+        0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 1, 0x03, 0, 0, 0, 0, 1, 0, 0, 0
+    };
+    message.insert(message.end(), std::begin(data), std::end(data));
+    message.insert(message.end(), payload.begin(), payload.end());
+    return message;
+}
+
+Measurement run(
+        const std::vector<std::vector<octet>>& messages,
+        CompressionMode mode)
+{
+    Measurement measurement;
+    MessageCompressor compressor(mode, 512, 10, 32);
+
+    // Frames sent for each message; an empty frame means the message was sent uncompressed.
+    std::vector<std::vector<octet>> frames(messages.size());
+    uint64_t original_bytes = 0;
+    uint64_t sent_bytes = 0;
+    uint32_t compressed = 0;
+
+    std::clock_t cpu_start = std::clock();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        const std::vector<octet>& message = messages[i];
+        if (!compressor.encode(message.data(), static_cast<uint32_t>(message.size()), frames[i]))
+        {
+            frames[i].clear();
+        }
+    }
+    double encode_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double encode_cpu_s = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+    std::vector<octet> decoded;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        const std::vector<octet>& message = messages[i];
+        original_bytes += message.size();
+        if (frames[i].empty())
+        {
+            sent_bytes += message.size();
+            measurement.valid &= MessageCompressor::DecodeResult::NOT_COMPRESSED ==
+                    MessageCompressor::decode(message.data(), static_cast<uint32_t>(message.size()), 65500,
+                            decoded);
+            continue;
+        }
+
+        ++compressed;
+        sent_bytes += frames[i].size();
+        measurement.valid &= MessageCompressor::DecodeResult::DECOMPRESSED ==
+                MessageCompressor::decode(frames[i].data(), static_cast<uint32_t>(frames[i].size()), 65500,
+                        decoded) && decoded == message;
+    }
+    double decode_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double original_mb = static_cast<double>(original_bytes) / (1024.0 * 1024.0);
+    measurement.ratio = static_cast<double>(original_bytes) / static_cast<double>(sent_bytes);
+    measurement.compressed_percent = 100.0 * compressed / messages.size();
+    measurement.encode_mb_s = original_mb / encode_s;
+    measurement.decode_mb_s = original_mb / decode_s;
+    measurement.encode_cpu_us = encode_cpu_s * 1e6 / messages.size();
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: CompressionBenchmark [--messages <n>] [--payload <bytes>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t messages_count = 2000;
+    uint32_t payload_size = 16384;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--messages")
+        {
+            messages_count = value;
+        }
+        else if (arg == "--payload")
+        {
+            payload_size = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == messages_count || 1024 > payload_size || 60000 < payload_size)
+    {
+        usage();
+        return 1;
+    }
+
+    struct Corpus
+    {
+        const char* name;
+        std::vector<octet> (* generate)(
+                uint32_t,
+                std::mt19937&);
+        //! Minimum ratio expected from the corpus.
+        double min_ratio;
+    };
+    const Corpus corpora[] = {
+        {"points", point_cloud, 1.1},
+        {"grid", occupancy_grid, 4.0},
+        {"json", json_text, 2.0},
+        {"random", random_bytes, 1.0}
+    };
+
+    printf("Messages: %u, payload: %u bytes\n", messages_count, payload_size);
+    printf("[ Corpus][     Mode][ Ratio][ Compressed(%%)][ Encode(MB/s)][ Decode(MB/s)][ CPU(us/msg)]\n");
+    for (const Corpus& corpus : corpora)
+    {
+        std::mt19937 generator(1234);
+        std::vector<std::vector<octet>> messages;
+        messages.reserve(messages_count);
+        for (uint32_t i = 0; i < messages_count; ++i)
+        {
+            messages.push_back(rtps_message(corpus.generate(payload_size, generator)));
+        }
+
+        const CompressionMode modes[] = {CompressionMode::ALWAYS, CompressionMode::ADAPTIVE};
+        for (CompressionMode mode : modes)
+        {
+            Measurement measurement = run(messages, mode);
+            printf("%9s,%10s,%7.2f,%15.1f,%14.1f,%14.1f,%13.2f\n", corpus.name,
+                    CompressionMode::ALWAYS == mode ? "always" : "adaptive", measurement.ratio,
+                    measurement.compressed_percent, measurement.encode_mb_s, measurement.decode_mb_s,
+                    measurement.encode_cpu_us);
+
+            // Messages are received as sent, compressible data shrinks, and nothing grows
+            if (!measurement.valid || measurement.ratio < corpus.min_ratio)
+            {
+                printf("Unexpected result for %s messages\n", corpus.name);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterBenchmark.cpp
+ *
+ * Measures the cost of evaluating a DDS-SQL content filter on a large type.
+ * The filter on the leading key is read directly from the payload, the filter on the trailing field needs the
+ * payload to be fully deserialized, and the baseline performs the full deserialization the filter used to do on
+ * every sample.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/core/ReturnCode.hpp>
+#include <fastdds/dds/core/StackAllocatedSequence.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+namespace {
+
+constexpr const char* type_name = "ContentFilterBenchmarkType";
+
+DynamicType::_ref_type create_type(
+        uint32_t array_length,
+        uint32_t sequence_length)
+{
+    DynamicTypeBuilderFactory::_ref_type factory = DynamicTypeBuilderFactory::get_instance();
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name(type_name);
+    DynamicTypeBuilder::_ref_type builder = factory->create_type(type_descriptor);
+
+    MemberDescriptor::_ref_type member {traits<MemberDescriptor>::make_shared()};
+    member->name("key");
+    member->type(factory->get_primitive_type(TK_INT32));
+    builder->add_member(member);
+
+    member = traits<MemberDescriptor>::make_shared();
+    member->name("values");
+    member->type(factory->create_array_type(factory->get_primitive_type(TK_FLOAT64), {array_length})->build());
+    builder->add_member(member);
+
+    member = traits<MemberDescriptor>::make_shared();
+    member->name("blob");
+    member->type(factory->create_sequence_type(factory->get_primitive_type(TK_BYTE), sequence_length)->build());
+    builder->add_member(member);
+
+    member = traits<MemberDescriptor>::make_shared();
+    member->name("tail");
+    member->type(factory->get_primitive_type(TK_INT32));
+    builder->add_member(member);
+
+    return builder->build();
+}
+
+double measure(
+        uint32_t iterations,
+        const std::vector<IContentFilter::SerializedPayload>& payloads,
+        const std::function<bool(const IContentFilter::SerializedPayload&)>& evaluate,
+        uint32_t& passed)
+{
+    passed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        if (evaluate(payloads[i % payloads.size()]))
+        {
+            ++passed;
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    return elapsed.count() / iterations;
+}
+
+void usage()
+{
+    printf("Usage: ContentFilterBenchmark [--iterations <n>] [--array <n>] [--sequence <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 100000;
+    uint32_t array_length = 256;
+    uint32_t sequence_length = 4096;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--iterations")
+        {
+            iterations = value;
+        }
+        else if (arg == "--array")
+        {
+            array_length = value;
+        }
+        else if (arg == "--sequence")
+        {
+            sequence_length = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == iterations || 0 == array_length)
+    {
+        usage();
+        return 1;
+    }
+
+    DynamicType::_ref_type type = create_type(array_length, sequence_length);
+    DynamicPubSubType type_support(type);
+    type_support.register_type_object_representation();
+
+    // Payloads with keys 0 to 9, in both encodings
+    std::vector<IContentFilter::SerializedPayload> payloads;
+    for (DataRepresentationId_t representation : {XCDR_DATA_REPRESENTATION, XCDR2_DATA_REPRESENTATION})
+    {
+        for (int32_t key = 0; key < 10; ++key)
+        {
+            DynamicData::_ref_type data = DynamicDataFactory::get_instance()->create_data(type);
+            data->set_int32_value(data->get_member_id_by_name("key"), key);
+            data->set_int32_value(data->get_member_id_by_name("tail"), key);
+            std::vector<uint8_t> blob(sequence_length, 0x55);
+            data->set_byte_values(data->get_member_id_by_name("blob"), blob);
+
+            payloads.emplace_back(type_support.getSerializedSizeProvider(&data, representation)());
+            type_support.serialize(&data, &payloads.back(), representation);
+            DynamicDataFactory::get_instance()->delete_data(data);
+        }
+    }
+
+    DDSSQLFilter::DDSFilterFactory filter_factory;
+    StackAllocatedSequence<const char*, 1> params;
+    params.length(0);
+    IContentFilter* key_filter = nullptr;
+    IContentFilter* tail_filter = nullptr;
+    if (RETCODE_OK != filter_factory.create_content_filter("DDSSQL", type_name, &type_support, "key = 5", params,
+            key_filter) ||
+            RETCODE_OK != filter_factory.create_content_filter("DDSSQL", type_name, &type_support, "tail = 5",
+            params, tail_filter))
+    {
+        printf("Could not create the content filters\n");
+        return 1;
+    }
+
+    IContentFilter::FilterSampleInfo info;
+    IContentFilter::GUID_t guid;
+
+    // What the evaluator did for every sample: deserialize the whole payload and read the field
+    DynamicData::_ref_type full_data = DynamicDataFactory::get_instance()->create_data(type);
+    MemberId key_id = full_data->get_member_id_by_name("key");
+    auto full_deserialization = [&](const IContentFilter::SerializedPayload& payload)
+            {
+                int32_t key = 0;
+                full_data->clear_all_values();
+                return type_support.deserialize(const_cast<IContentFilter::SerializedPayload*>(&payload), &full_data) &&
+                       RETCODE_OK == full_data->get_int32_value(key, key_id) && 5 == key;
+            };
+    auto key_evaluation = [&](const IContentFilter::SerializedPayload& payload)
+            {
+                return key_filter->evaluate(payload, info, guid);
+            };
+    auto tail_evaluation = [&](const IContentFilter::SerializedPayload& payload)
+            {
+                return tail_filter->evaluate(payload, info, guid);
+            };
+
+    uint32_t passed = 0;
+    printf("Payload size: %u bytes, iterations: %u\n", payloads.front().length, iterations);
+    printf("[                  Evaluation][   ns/sample][   Passed]\n");
+    double ns = measure(iterations, payloads, full_deserialization, passed);
+    printf("%30s,%13.1f,%10u\n", "full deserialization", ns, passed);
+    ns = measure(iterations, payloads, key_evaluation, passed);
+    printf("%30s,%13.1f,%10u\n", "key = 5 (direct read)", ns, passed);
+    ns = measure(iterations, payloads, tail_evaluation, passed);
+    printf("%30s,%13.1f,%10u\n", "tail = 5 (deserialization)", ns, passed);
+
+    DynamicDataFactory::get_instance()->delete_data(full_data);
+    filter_factory.delete_content_filter("DDSSQL", key_filter);
+    filter_factory.delete_content_filter("DDSSQL", tail_filter);
+    Log::Flush();
+
+    return 0;
+}
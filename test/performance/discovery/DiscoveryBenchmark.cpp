@@ -0,0 +1,207 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryBenchmark.cpp
+ *
+ * Measures the cost of looking for the candidates of a new local endpoint when thousands of remote endpoints have
+ * been discovered, comparing the walk over every proxy of every participant done by EDP before with the lookup on the
+ * topic index kept by PDP now.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rtps/builtin/data/ProxyTopicIndex.hpp>
+
+using eprosima::fastdds::rtps::ProxyTopicIndex;
+
+namespace {
+
+//! Endpoints announced by each synthesized participant
+constexpr uint32_t endpoints_per_participant = 20;
+
+struct BenchmarkProxy
+{
+    uint32_t entity_id = 0;
+    std::string topic_name;
+
+    const std::string& topicName() const
+    {
+        return topic_name;
+    }
+
+};
+
+struct BenchmarkParticipant
+{
+    std::unordered_map<uint32_t, BenchmarkProxy*> endpoints;
+};
+
+struct Measurement
+{
+    double pairing_us = 0;
+    double candidates = 0;
+};
+
+std::string topic_name(
+        uint32_t topic)
+{
+    return "benchmark_topic_" + std::to_string(topic);
+}
+
+void usage()
+{
+    printf("Usage: DiscoveryBenchmark [--max-endpoints <n>] [--topics <n>] [--pairings <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_endpoints = 100000;
+    uint32_t topics_count = 1000;
+    uint32_t pairings_count = 1000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-endpoints")
+        {
+            max_endpoints = value;
+        }
+        else if (arg == "--topics")
+        {
+            topics_count = value;
+        }
+        else if (arg == "--pairings")
+        {
+            pairings_count = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (max_endpoints < endpoints_per_participant || 0 == topics_count || 0 == pairings_count)
+    {
+        usage();
+        return 1;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> topic_distribution(0, topics_count - 1);
+
+    printf("[ Endpoints][    Topics][    Lookup][ Pairing(us)][ Candidates]\n");
+    for (uint32_t endpoints = 100; endpoints <= max_endpoints; endpoints *= 10)
+    {
+        // Synthesize the remote participants, each one with endpoints on random topics
+        uint32_t participants_count = (endpoints + endpoints_per_participant - 1) / endpoints_per_participant;
+        std::vector<std::unique_ptr<BenchmarkProxy>> proxies;
+        std::vector<BenchmarkParticipant> participants(participants_count);
+        ProxyTopicIndex<BenchmarkProxy> index;
+        for (uint32_t i = 0; i < participants_count * endpoints_per_participant; ++i)
+        {
+            proxies.emplace_back(new BenchmarkProxy());
+            BenchmarkProxy* proxy = proxies.back().get();
+            proxy->entity_id = i % endpoints_per_participant;
+            proxy->topic_name = topic_name(topic_distribution(generator));
+            participants[i / endpoints_per_participant].endpoints[proxy->entity_id] = proxy;
+            index.add(proxy);
+        }
+
+        std::vector<std::string> local_topics(pairings_count);
+        for (std::string& topic : local_topics)
+        {
+            topic = topic_name(topic_distribution(generator));
+        }
+
+        Measurement scan;
+        {
+            uint64_t candidates = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (const std::string& topic : local_topics)
+            {
+                // Every proxy is checked, and valid_matching discards the ones on other topics first
+                for (const BenchmarkParticipant& participant : participants)
+                {
+                    for (const auto& pair : participant.endpoints)
+                    {
+                        if (pair.second->topicName() == topic)
+                        {
+                            ++candidates;
+                        }
+                    }
+                }
+            }
+            scan.pairing_us = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count() / pairings_count;
+            scan.candidates = static_cast<double>(candidates) / pairings_count;
+        }
+
+        Measurement indexed;
+        {
+            uint64_t candidates = 0;
+            std::vector<BenchmarkProxy*> same_topic;
+            auto start = std::chrono::steady_clock::now();
+            for (const std::string& topic : local_topics)
+            {
+                same_topic.clear();
+                index.get(topic, same_topic);
+                for (const BenchmarkProxy* proxy : same_topic)
+                {
+                    if (proxy->topicName() == topic)
+                    {
+                        ++candidates;
+                    }
+                }
+            }
+            indexed.pairing_us = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count() / pairings_count;
+            indexed.candidates = static_cast<double>(candidates) / pairings_count;
+        }
+
+        printf("%12u,%11u,%11s,%13.2f,%12.1f\n", endpoints, topics_count, "full scan", scan.pairing_us,
+                scan.candidates);
+        printf("%12u,%11u,%11s,%13.2f,%12.1f\n", endpoints, topics_count, "index", indexed.pairing_us,
+                indexed.candidates);
+
+        if (scan.candidates != indexed.candidates)
+        {
+            printf("Topic index returned %.1f candidates per pairing instead of %.1f\n", indexed.candidates,
+                    scan.candidates);
+            return 1;
+        }
+    }
+
+    return 0;
+}
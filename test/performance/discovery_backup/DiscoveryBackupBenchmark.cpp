@@ -0,0 +1,356 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryBackupBenchmark.cpp
+ *
+ * Measures the backup of the discovery database of a server with thousands of simulated clients, comparing the json
+ * backup with the binary journal: the overhead of storing every change received, the time to dump the state of the
+ * database, and the time to restore it.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+#include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+const char* json_file_name = "discovery_backup_benchmark.json";
+const char* journal_file_name = "discovery_backup_benchmark_journal.db";
+
+double elapsed_ms(
+        const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+GuidPrefix_t client_prefix(
+        uint32_t client)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[1] = 0x0f;
+    prefix.value[8] = static_cast<octet>(client >> 24);
+    prefix.value[9] = static_cast<octet>(client >> 16);
+    prefix.value[10] = static_cast<octet>(client >> 8);
+    prefix.value[11] = static_cast<octet>(client);
+    return prefix;
+}
+
+//! Change announcing an entity, as received from the entity itself, with a payload of @c payload_size bytes.
+CacheChange_t* announcement(
+        const GUID_t& guid,
+        const EntityId_t& builtin_writer,
+        uint32_t payload_size)
+{
+    CacheChange_t* change = new CacheChange_t();
+    change->kind = ALIVE;
+    change->writerGUID = GUID_t(guid.guidPrefix, builtin_writer);
+    change->instanceHandle = InstanceHandle_t(guid);
+    change->sequenceNumber = SequenceNumber_t(0, 1);
+    SampleIdentity identity;
+    identity.writer_guid(change->writerGUID);
+    identity.sequence_number(change->sequenceNumber);
+    change->write_params.sample_identity(identity);
+    change->write_params.related_sample_identity(identity);
+
+    change->serializedPayload.reserve(payload_size);
+    change->serializedPayload.length = payload_size;
+    change->serializedPayload.encapsulation = PL_CDR_LE;
+    for (uint32_t i = 0; i < payload_size; ++i)
+    {
+        change->serializedPayload.data[i] = static_cast<octet>(i);
+    }
+    return change;
+}
+
+struct Measurement
+{
+    double json_store_ms = 0;
+    double journal_store_ms = 0;
+    double json_dump_ms = 0;
+    double journal_dump_ms = 0;
+    double json_restore_ms = 0;
+    double journal_restore_ms = 0;
+    long json_size = 0;
+    long journal_size = 0;
+    bool valid = true;
+};
+
+long file_size(
+        const char* file_name)
+{
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    return file.is_open() ? static_cast<long>(file.tellg()) : 0;
+}
+
+void release(
+        ddb::DiscoveryDataBase& db)
+{
+    db.disable();
+    for (CacheChange_t* change : db.clear())
+    {
+        delete change;
+    }
+}
+
+//! Restore a database from the json backup, as PDPServer does.
+void restore_json(
+        ddb::DiscoveryDataBase& db,
+        nlohmann::json& j)
+{
+    std::map<InstanceHandle_t, CacheChange_t*> changes_map;
+    for (const char* entities : {"participants", "writers", "readers"})
+    {
+        for (auto it = j[entities].begin(); it != j[entities].end(); ++it)
+        {
+            CacheChange_t* change = new CacheChange_t();
+            change->serializedPayload.reserve(it.value()["change"]["serialized_payload"]["length"].get<uint32_t>());
+            ddb::from_json(it.value()["change"], *change);
+            changes_map.insert(std::make_pair(change->instanceHandle, change));
+        }
+    }
+    db.from_json(j, changes_map);
+}
+
+//! Restore a database from the binary journal, as PDPServer does.
+void restore_journal(
+        ddb::DiscoveryDataBase& db,
+        const std::vector<ddb::DiscoveryJournalRecord>& records)
+{
+    std::map<InstanceHandle_t, CacheChange_t*> changes_map;
+    for (const ddb::DiscoveryJournalRecord& record : records)
+    {
+        CacheChange_t* change = new CacheChange_t();
+        change->serializedPayload.reserve(record.payload_length);
+        record.to_change(*change);
+        changes_map.insert(std::make_pair(change->instanceHandle, change));
+    }
+    db.from_journal(records, changes_map);
+}
+
+Measurement run(
+        uint32_t clients,
+        uint32_t topics,
+        uint32_t payload_size)
+{
+    Measurement measurement;
+    std::remove(json_file_name);
+    std::remove(journal_file_name);
+
+    GuidPrefix_t server_prefix = client_prefix(0xFFFFFFFF);
+    ddb::DiscoveryDataBase db(server_prefix, std::set<GuidPrefix_t>());
+
+    const EntityId_t writer_id(0x00000103);
+    const EntityId_t reader_id(0x00000104);
+    ddb::DiscoveryParticipantChangeData client_data(RemoteLocatorList(), true, true);
+    std::vector<CacheChange_t*> participants;
+    std::vector<std::pair<CacheChange_t*, std::string>> endpoints;
+    for (uint32_t client = 0; client < clients; ++client)
+    {
+        GuidPrefix_t prefix = client_prefix(client);
+        std::string topic = "topic_" + std::to_string(client % topics);
+        participants.push_back(announcement(GUID_t(prefix, c_EntityId_RTPSParticipant), c_EntityId_SPDPWriter,
+                payload_size));
+        endpoints.emplace_back(announcement(GUID_t(prefix, writer_id), c_EntityId_SEDPPubWriter, payload_size), topic);
+        endpoints.emplace_back(announcement(GUID_t(prefix, reader_id), c_EntityId_SEDPSubWriter, payload_size), topic);
+    }
+
+    // Storing every change received: a flushed json line for each change, as the json backup did
+    {
+        std::ofstream queue_file(std::string(json_file_name) + ".queue", std::ios::app);
+        auto start = std::chrono::steady_clock::now();
+        for (CacheChange_t* change : participants)
+        {
+            nlohmann::json j;
+            ddb::to_json(j, *change);
+            queue_file << j;
+            queue_file.flush();
+        }
+        for (const auto& endpoint : endpoints)
+        {
+            nlohmann::json j;
+            ddb::to_json(j, *endpoint.first);
+            queue_file << j;
+            queue_file.flush();
+        }
+        measurement.json_store_ms = elapsed_ms(start);
+    }
+    std::remove((std::string(json_file_name) + ".queue").c_str());
+
+    // Storing every change received in the journal, while feeding the database
+    db.persistence_enable(journal_file_name);
+    auto start = std::chrono::steady_clock::now();
+    for (CacheChange_t* change : participants)
+    {
+        db.update(change, client_data);
+    }
+    for (const auto& endpoint : endpoints)
+    {
+        db.update(endpoint.first, endpoint.second);
+    }
+    db.sync_backup();
+    measurement.journal_store_ms = elapsed_ms(start);
+
+    db.process_pdp_data_queue();
+    db.process_edp_data_queue();
+    db.process_dirty_topics();
+
+    // Dumping the state of the database
+    nlohmann::json original;
+    start = std::chrono::steady_clock::now();
+    {
+        std::ofstream backup_json_file(json_file_name, std::ios_base::out);
+        db.to_json(original);
+        backup_json_file << std::setw(4) << original << std::endl;
+    }
+    measurement.json_dump_ms = elapsed_ms(start);
+    measurement.json_size = file_size(json_file_name);
+
+    start = std::chrono::steady_clock::now();
+    db.clean_backup();
+    measurement.journal_dump_ms = elapsed_ms(start);
+    measurement.journal_size = file_size(journal_file_name);
+    release(db);
+
+    // Restoring the database
+    {
+        ddb::DiscoveryDataBase restored(server_prefix, std::set<GuidPrefix_t>());
+        start = std::chrono::steady_clock::now();
+        nlohmann::json j;
+        std::ifstream backup_json_file(json_file_name, std::ios_base::in);
+        backup_json_file >> j;
+        restore_json(restored, j);
+        measurement.json_restore_ms = elapsed_ms(start);
+
+        nlohmann::json check;
+        restored.to_json(check);
+        measurement.valid &= check == original;
+        release(restored);
+    }
+    {
+        ddb::DiscoveryDataBase restored(server_prefix, std::set<GuidPrefix_t>());
+        start = std::chrono::steady_clock::now();
+        std::vector<octet> buffer;
+        std::vector<ddb::DiscoveryJournalRecord> records;
+        measurement.valid &= ddb::DiscoveryJournal::read(journal_file_name, buffer, records);
+        restore_journal(restored, records);
+        measurement.journal_restore_ms = elapsed_ms(start);
+
+        nlohmann::json check;
+        restored.to_json(check);
+        measurement.valid &= check == original;
+        release(restored);
+    }
+
+    std::remove(json_file_name);
+    std::remove(journal_file_name);
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: DiscoveryBackupBenchmark [--max-clients <n>] [--topics <n>] [--payload <bytes>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_clients = 10000;
+    uint32_t topics = 500;
+    uint32_t payload_size = 256;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-clients")
+        {
+            max_clients = value;
+        }
+        else if (arg == "--topics")
+        {
+            topics = value;
+        }
+        else if (arg == "--payload")
+        {
+            payload_size = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_clients || 0 == topics)
+    {
+        usage();
+        return 1;
+    }
+
+    eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Error);
+
+    printf("Topics: %u, payload: %u bytes\n", topics, payload_size);
+    printf("[ Clients][ Format][ Store(ms)][ Dump(ms)][ Restore(ms)][ Size(KB)]\n");
+    for (uint32_t clients = 10; clients <= max_clients; clients *= 10)
+    {
+        Measurement measurement = run(clients, topics, payload_size);
+        printf("%10u,%8s,%11.3f,%10.3f,%13.3f,%10ld\n", clients, "json", measurement.json_store_ms,
+                measurement.json_dump_ms, measurement.json_restore_ms, measurement.json_size / 1024);
+        printf("%10u,%8s,%11.3f,%10.3f,%13.3f,%10ld\n", clients, "journal", measurement.journal_store_ms,
+                measurement.journal_dump_ms, measurement.journal_restore_ms, measurement.journal_size / 1024);
+
+        // Both backups must restore the same database
+        if (!measurement.valid)
+        {
+            printf("Restored database differs with %u clients\n", clients);
+            return 1;
+        }
+    }
+
+    eprosima::fastdds::dds::Log::Flush();
+    return 0;
+}
@@ -0,0 +1,232 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryServerBenchmark.cpp
+ *
+ * Measures the load of the discovery database of a server with thousands of simulated clients, each one announcing
+ * its participant, a writer and a reader, comparing the processing of dirty topics on a single thread with the
+ * processing on several threads.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+GuidPrefix_t client_prefix(
+        uint32_t client)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[1] = 0x0f;
+    prefix.value[8] = static_cast<octet>(client >> 24);
+    prefix.value[9] = static_cast<octet>(client >> 16);
+    prefix.value[10] = static_cast<octet>(client >> 8);
+    prefix.value[11] = static_cast<octet>(client);
+    return prefix;
+}
+
+//! Change announcing an entity, as received from the entity itself.
+CacheChange_t* announcement(
+        const GUID_t& guid,
+        const EntityId_t& builtin_writer)
+{
+    CacheChange_t* change = new CacheChange_t();
+    change->kind = ALIVE;
+    change->writerGUID = GUID_t(guid.guidPrefix, builtin_writer);
+    change->instanceHandle = InstanceHandle_t(guid);
+    SampleIdentity identity;
+    identity.writer_guid(change->writerGUID);
+    identity.sequence_number(SequenceNumber_t(0, 1));
+    change->write_params.sample_identity(identity);
+    change->write_params.related_sample_identity(identity);
+    return change;
+}
+
+struct Measurement
+{
+    double queues_ms = 0;
+    double dirty_topics_ms = 0;
+    std::vector<InstanceHandle_t> pdp_to_send;
+    std::vector<InstanceHandle_t> edp_publications_to_send;
+    std::vector<InstanceHandle_t> edp_subscriptions_to_send;
+};
+
+std::vector<InstanceHandle_t> handles(
+        const std::vector<CacheChange_t*>& changes)
+{
+    std::vector<InstanceHandle_t> ret;
+    ret.reserve(changes.size());
+    for (const CacheChange_t* change : changes)
+    {
+        ret.push_back(change->instanceHandle);
+    }
+    return ret;
+}
+
+/**
+ * Feed the database of a server with the announcements of @c clients clients, and process them.
+ * As no client acknowledges anything, every topic stays dirty, and every round processes all of them.
+ */
+Measurement run(
+        uint32_t threads,
+        uint32_t clients,
+        uint32_t topics,
+        uint32_t rounds)
+{
+    Measurement measurement;
+
+    GuidPrefix_t server_prefix = client_prefix(0xFFFFFFFF);
+    ddb::DiscoveryDataBase db(server_prefix, std::set<GuidPrefix_t>());
+    db.processing_threads(threads);
+
+    const EntityId_t writer_id(0x00000103);
+    const EntityId_t reader_id(0x00000104);
+    ddb::DiscoveryParticipantChangeData client_data(RemoteLocatorList(), true, true);
+    for (uint32_t client = 0; client < clients; ++client)
+    {
+        GuidPrefix_t prefix = client_prefix(client);
+        std::string topic = "topic_" + std::to_string(client % topics);
+        db.update(announcement(GUID_t(prefix, c_EntityId_RTPSParticipant), c_EntityId_SPDPWriter), client_data);
+        db.update(announcement(GUID_t(prefix, writer_id), c_EntityId_SEDPPubWriter), topic);
+        db.update(announcement(GUID_t(prefix, reader_id), c_EntityId_SEDPSubWriter), topic);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    db.process_pdp_data_queue();
+    db.process_edp_data_queue();
+    measurement.queues_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round)
+    {
+        db.process_dirty_topics();
+    }
+    measurement.dirty_topics_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count() / rounds;
+
+    measurement.pdp_to_send = handles(db.pdp_to_send());
+    measurement.edp_publications_to_send = handles(db.edp_publications_to_send());
+    measurement.edp_subscriptions_to_send = handles(db.edp_subscriptions_to_send());
+
+    db.disable();
+    for (CacheChange_t* change : db.clear())
+    {
+        delete change;
+    }
+
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: DiscoveryServerBenchmark [--max-clients <n>] [--topics <n>] [--rounds <n>] [--threads <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_clients = 5000;
+    uint32_t topics = 500;
+    uint32_t rounds = 10;
+    uint32_t threads = 4;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-clients")
+        {
+            max_clients = value;
+        }
+        else if (arg == "--topics")
+        {
+            topics = value;
+        }
+        else if (arg == "--rounds")
+        {
+            rounds = value;
+        }
+        else if (arg == "--threads")
+        {
+            threads = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_clients || 0 == topics || 0 == rounds || 0 == threads)
+    {
+        usage();
+        return 1;
+    }
+
+    eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Error);
+
+    printf("Topics: %u, rounds: %u, threads: %u\n", topics, rounds, threads);
+    printf("[ Clients][ Threads][ Queues(ms)][ Dirty topics(ms)][   DATA(p)][   DATA(w)][   DATA(r)]\n");
+    for (uint32_t clients = 10; clients <= max_clients; clients *= 10)
+    {
+        Measurement sequential = run(1, clients, topics, rounds);
+        Measurement parallel = run(threads, clients, topics, rounds);
+
+        for (const Measurement* measurement : {&sequential, &parallel})
+        {
+            printf("%10u,%9u,%13.3f,%19.3f,%11zu,%11zu,%11zu\n", clients, &sequential == measurement ? 1 : threads,
+                    measurement->queues_ms, measurement->dirty_topics_ms, measurement->pdp_to_send.size(),
+                    measurement->edp_publications_to_send.size(), measurement->edp_subscriptions_to_send.size());
+        }
+
+        // Routing must not depend on the number of threads
+        if (sequential.pdp_to_send != parallel.pdp_to_send ||
+                sequential.edp_publications_to_send != parallel.edp_publications_to_send ||
+                sequential.edp_subscriptions_to_send != parallel.edp_subscriptions_to_send)
+        {
+            printf("Changes to send differ with %u clients\n", clients);
+            return 1;
+        }
+    }
+
+    eprosima::fastdds::dds::Log::Flush();
+    return 0;
+}
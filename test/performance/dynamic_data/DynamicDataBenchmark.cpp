@@ -0,0 +1,281 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicDataBenchmark.cpp
+ *
+ * Measures the creation of samples of a structure of primitive members and the access to their members through the
+ * DynamicData API, where primitive members are kept inline on a single buffer per sample, and compares it with the
+ * representation used before, where every member was a DynamicData object of its own kept on a map.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+namespace {
+
+struct Measurement
+{
+    double create_us = 0;
+    double set_ns = 0;
+    double get_ns = 0;
+    double checksum = 0;
+};
+
+/**
+ * Emulation of the representation of samples used before: a map from MemberId to type-erased values, where the
+ * members of a structure are samples of their own holding their primitive value on the same kind of map.
+ */
+struct MemberObjectsSample
+{
+    std::map<MemberId, std::shared_ptr<void>> value;
+};
+
+std::shared_ptr<MemberObjectsSample> create_member_objects_sample(
+        uint32_t members)
+{
+    auto sample = std::make_shared<MemberObjectsSample>();
+    for (MemberId id = 0; id < members; ++id)
+    {
+        auto member = std::make_shared<MemberObjectsSample>();
+        if (0 == id % 2)
+        {
+            member->value.emplace(MEMBER_ID_INVALID, std::make_shared<int32_t>(0));
+        }
+        else
+        {
+            member->value.emplace(MEMBER_ID_INVALID, std::make_shared<double>(0.0));
+        }
+        sample->value.emplace(id, member);
+    }
+    return sample;
+}
+
+/**
+ * Build a structure whose even members are int32 and whose odd members are float64.
+ */
+DynamicType::_ref_type create_struct_type(
+        uint32_t members)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("BenchmarkStruct");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+
+    for (MemberId id = 0; id < members; ++id)
+    {
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->name("member_" + std::to_string(id));
+        member_descriptor->type(factory->get_primitive_type(0 == id % 2 ? TK_INT32 : TK_FLOAT64));
+        builder->add_member(member_descriptor);
+    }
+
+    return builder->build();
+}
+
+void usage()
+{
+    printf("Usage: DynamicDataBenchmark [--members <n>] [--samples <n>] [--iterations <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t members_count = 32;
+    uint32_t samples_count = 1000;
+    uint32_t iterations = 1000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--members")
+        {
+            members_count = value;
+        }
+        else if (arg == "--samples")
+        {
+            samples_count = value;
+        }
+        else if (arg == "--iterations")
+        {
+            iterations = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == members_count || 0 == samples_count || 0 == iterations)
+    {
+        usage();
+        return 1;
+    }
+
+    DynamicType::_ref_type type {create_struct_type(members_count)};
+    if (!type)
+    {
+        printf("Error building the structure type\n");
+        return 1;
+    }
+    DynamicDataFactory::_ref_type data_factory {DynamicDataFactory::get_instance()};
+    uint64_t accesses = static_cast<uint64_t>(iterations) * members_count;
+
+    Measurement member_objects;
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < samples_count; ++i)
+        {
+            auto sample = create_member_objects_sample(members_count);
+            member_objects.checksum += static_cast<double>(sample->value.size());
+        }
+        member_objects.create_us = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count() / samples_count;
+
+        auto sample = create_member_objects_sample(members_count);
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            for (MemberId id = 0; id < members_count; ++id)
+            {
+                auto member = std::static_pointer_cast<MemberObjectsSample>(sample->value.find(id)->second);
+                if (0 == id % 2)
+                {
+                    *std::static_pointer_cast<int32_t>(member->value.begin()->second) = static_cast<int32_t>(i);
+                }
+                else
+                {
+                    *std::static_pointer_cast<double>(member->value.begin()->second) = static_cast<double>(i);
+                }
+            }
+        }
+        member_objects.set_ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / accesses;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            for (MemberId id = 0; id < members_count; ++id)
+            {
+                auto member = std::static_pointer_cast<MemberObjectsSample>(sample->value.find(id)->second);
+                if (0 == id % 2)
+                {
+                    member_objects.checksum += *std::static_pointer_cast<int32_t>(member->value.begin()->second);
+                }
+                else
+                {
+                    member_objects.checksum += *std::static_pointer_cast<double>(member->value.begin()->second);
+                }
+            }
+        }
+        member_objects.get_ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / accesses;
+    }
+
+    Measurement dynamic_data;
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < samples_count; ++i)
+        {
+            DynamicData::_ref_type sample {data_factory->create_data(type)};
+            dynamic_data.checksum += static_cast<double>(sample->get_item_count());
+            data_factory->delete_data(sample);
+        }
+        dynamic_data.create_us = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count() / samples_count;
+
+        DynamicData::_ref_type sample {data_factory->create_data(type)};
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            for (MemberId id = 0; id < members_count; ++id)
+            {
+                if (0 == id % 2)
+                {
+                    sample->set_int32_value(id, static_cast<int32_t>(i));
+                }
+                else
+                {
+                    sample->set_float64_value(id, static_cast<double>(i));
+                }
+            }
+        }
+        dynamic_data.set_ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / accesses;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            for (MemberId id = 0; id < members_count; ++id)
+            {
+                if (0 == id % 2)
+                {
+                    int32_t value = 0;
+                    sample->get_int32_value(value, id);
+                    dynamic_data.checksum += value;
+                }
+                else
+                {
+                    double value = 0;
+                    sample->get_float64_value(value, id);
+                    dynamic_data.checksum += value;
+                }
+            }
+        }
+        dynamic_data.get_ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / accesses;
+        data_factory->delete_data(sample);
+    }
+
+    printf("[   Members][         Layout][ Create(us)][ Set(ns)][ Get(ns)]\n");
+    printf("%12u,%16s,%12.2f,%9.1f,%9.1f\n", members_count, "member objects", member_objects.create_us,
+            member_objects.set_ns, member_objects.get_ns);
+    printf("%12u,%16s,%12.2f,%9.1f,%9.1f\n", members_count, "DynamicData", dynamic_data.create_us,
+            dynamic_data.set_ns, dynamic_data.get_ns);
+
+    if (member_objects.checksum != dynamic_data.checksum)
+    {
+        printf("DynamicData read %.1f instead of %.1f\n", dynamic_data.checksum, member_objects.checksum);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FanOutBenchmark.cpp
+ *
+ * Measures how a reliable writer scales with the number of readers matched with it.
+ * All the readers are on the same participant, so every sample is sent once, but the writer keeps a proxy per reader
+ * and processes the ACKNACKs of every one of them.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t payload_size)
+    {
+        setName("FanOutBenchmarkType");
+        m_typeSize = payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class FanOutListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        BenchmarkSample sample;
+        SampleInfo info;
+        while (RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data && ++(*received) == *expected)
+            {
+                std::lock_guard<std::mutex> guard(*mtx);
+                cv->notify_all();
+            }
+        }
+    }
+
+    std::atomic<uint64_t>* received = nullptr;
+    const uint64_t* expected = nullptr;
+    std::mutex* mtx = nullptr;
+    std::condition_variable* cv = nullptr;
+};
+
+DataWriterQos writer_qos()
+{
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_samples = 1000;
+    qos.resource_limits().max_instances = 1;
+    qos.resource_limits().max_samples_per_instance = 1000;
+    qos.reliable_writer_qos().times.heartbeatPeriod = eprosima::fastdds::Duration_t(0, 100000000);
+    return qos;
+}
+
+DataReaderQos reader_qos()
+{
+    DataReaderQos qos = DATAREADER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    return qos;
+}
+
+void usage()
+{
+    printf("Usage: FanOutBenchmark [--max-readers <n>] [--samples <n>] [--rate <samples/sec>] [--size <bytes>] "
+            "[--domain <id>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_readers = 512;
+    uint32_t samples = 10000;
+    uint32_t rate = 0;
+    uint32_t payload_size = 256;
+    uint32_t domain = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-readers")
+        {
+            max_readers = value;
+        }
+        else if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--rate")
+        {
+            rate = value;
+        }
+        else if (arg == "--size")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_readers || 0 == samples)
+    {
+        usage();
+        return 1;
+    }
+
+    // Every sample has to cross a transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    TypeSupport type(new BenchmarkDataType(payload_size));
+
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    pqos.transport().use_builtin_transports = false;
+    pqos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+
+    DomainParticipant* publisher_participant = factory->create_participant(domain, pqos);
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, pqos);
+    if (nullptr == publisher_participant || nullptr == subscriber_participant)
+    {
+        return 1;
+    }
+    type.register_type(publisher_participant);
+    type.register_type(subscriber_participant);
+
+    Topic* pub_topic = publisher_participant->create_topic("fan_out_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = subscriber_participant->create_topic("fan_out_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    DataWriter* writer = publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(
+        pub_topic, writer_qos());
+    Subscriber* subscriber = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    if (nullptr == writer || nullptr == subscriber)
+    {
+        return 1;
+    }
+
+    std::atomic<uint64_t> received{0};
+    uint64_t expected = 0;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<FanOutListener>> listeners;
+
+    printf("Samples: %u, rate: %u samples/sec, payload: %u bytes\n", samples, rate, payload_size);
+    printf("[ Readers][   Time(ms)][   Samples/sec][ Deliveries/sec][ write()(us)]\n");
+
+    BenchmarkSample sample;
+    sample.data.resize(payload_size);
+    for (uint32_t readers = 1; readers <= max_readers; readers *= 2)
+    {
+        // Add readers up to the number for this run
+        while (listeners.size() < readers)
+        {
+            listeners.emplace_back(new FanOutListener());
+            FanOutListener& listener = *listeners.back();
+            listener.received = &received;
+            listener.expected = &expected;
+            listener.mtx = &mtx;
+            listener.cv = &cv;
+            if (nullptr == subscriber->create_datareader(sub_topic, reader_qos(), &listener))
+            {
+                return 1;
+            }
+        }
+
+        // Wait for discovery
+        PublicationMatchedStatus status;
+        do
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            writer->get_publication_matched_status(status);
+        } while (status.current_count < static_cast<int32_t>(readers));
+
+        received = 0;
+        expected = static_cast<uint64_t>(samples) * readers;
+
+        std::chrono::nanoseconds period(0 == rate ? 0 : 1000000000 / rate);
+        std::chrono::nanoseconds write_time(0);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < samples; ++n)
+        {
+            auto write_start = std::chrono::steady_clock::now();
+            writer->write(&sample);
+            write_time += std::chrono::steady_clock::now() - write_start;
+            if (0 != rate)
+            {
+                std::this_thread::sleep_until(start + period * (n + 1));
+            }
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]()
+                    {
+                        return received >= expected;
+                    });
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        double sample_rate = samples * 1000.0 / elapsed.count();
+        double write_us = std::chrono::duration<double, std::micro>(write_time).count() / samples;
+        printf("%10u,%12.3f,%15.0f,%16.0f,%13.2f\n", readers, elapsed.count(), sample_rate, sample_rate * readers,
+                write_us);
+    }
+
+    publisher_participant->delete_contained_entities();
+    factory->delete_participant(publisher_participant);
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return 0;
+}
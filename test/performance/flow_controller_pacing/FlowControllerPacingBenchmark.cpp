@@ -0,0 +1,527 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlowControllerPacingBenchmark.cpp
+ *
+ * Measures how evenly an asynchronous flow controller spreads the datagrams of several writers over time, comparing
+ * the bandwidth limitation per period with the token bucket, both with the same rate and number of sender threads.
+ * A chaining transport timestamps every datagram carrying samples, and the gaps between them are reported.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+#include <fastdds/rtps/transport/ChainingTransport.h>
+#include <fastdds/rtps/transport/ChainingTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t payload_size)
+    {
+        setName("FlowControllerPacingBenchmarkType");
+        m_typeSize = payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Datagrams carrying samples, with the time they were handed to the transport.
+struct Datagrams
+{
+    //! Datagrams smaller than this are discovery traffic.
+    uint32_t min_size = 0;
+
+    std::atomic<uint64_t> bytes{0};
+
+    std::mutex mtx;
+    std::vector<std::pair<std::chrono::steady_clock::time_point, uint32_t>> sent;
+};
+
+class TimestampingTransportDescriptor : public ChainingTransportDescriptor
+{
+public:
+
+    TimestampingTransportDescriptor(
+            std::shared_ptr<TransportDescriptorInterface> low_level,
+            std::shared_ptr<Datagrams> datagrams)
+        : ChainingTransportDescriptor(low_level)
+        , datagrams(datagrams)
+    {
+    }
+
+    TransportInterface* create_transport() const override;
+
+    std::shared_ptr<Datagrams> datagrams;
+};
+
+class TimestampingTransport : public ChainingTransport
+{
+public:
+
+    explicit TimestampingTransport(
+            const TimestampingTransportDescriptor& descriptor)
+        : ChainingTransport(descriptor)
+        , descriptor_(descriptor)
+    {
+    }
+
+    TransportDescriptorInterface* get_configuration() override
+    {
+        return &descriptor_;
+    }
+
+    bool send(
+            SenderResource* low_sender_resource,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& timeout) override
+    {
+        Datagrams& datagrams = *descriptor_.datagrams;
+        if (total_bytes >= datagrams.min_size)
+        {
+            auto now = std::chrono::steady_clock::now();
+            std::lock_guard<std::mutex> guard(datagrams.mtx);
+            datagrams.sent.emplace_back(now, total_bytes);
+            datagrams.bytes += total_bytes;
+        }
+
+        return low_sender_resource->send(buffers, total_bytes, destination_locators_begin,
+                       destination_locators_end, timeout);
+    }
+
+    void receive(
+            TransportReceiverInterface* next_receiver,
+            const octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            const Locator_t& local_locator,
+            const Locator_t& remote_locator) override
+    {
+        next_receiver->OnDataReceived(receive_buffer, receive_buffer_size, local_locator, remote_locator);
+    }
+
+private:
+
+    TimestampingTransportDescriptor descriptor_;
+};
+
+TransportInterface* TimestampingTransportDescriptor::create_transport() const
+{
+    return new TimestampingTransport(*this);
+}
+
+struct Measurement
+{
+    bool valid = false;
+    size_t datagrams = 0;
+    double mean_gap_us = 0;
+    double stddev_gap_us = 0;
+    double max_gap_us = 0;
+    double rate_kbps = 0;
+
+    //! Coefficient of variation of the gaps between datagrams.
+    double dispersion() const
+    {
+        return mean_gap_us > 0 ? stddev_gap_us / mean_gap_us : 0;
+    }
+
+};
+
+Measurement measure(
+        Datagrams& datagrams)
+{
+    Measurement measurement;
+    std::lock_guard<std::mutex> guard(datagrams.mtx);
+    measurement.datagrams = datagrams.sent.size();
+    if (datagrams.sent.size() < 2)
+    {
+        return measurement;
+    }
+
+    std::vector<double> gaps;
+    gaps.reserve(datagrams.sent.size() - 1);
+    uint64_t bytes = 0;
+    for (size_t i = 1; i < datagrams.sent.size(); ++i)
+    {
+        gaps.push_back(std::chrono::duration<double, std::micro>(
+                    datagrams.sent[i].first - datagrams.sent[i - 1].first).count());
+        bytes += datagrams.sent[i].second;
+    }
+
+    double sum = 0;
+    for (double gap : gaps)
+    {
+        sum += gap;
+    }
+    measurement.mean_gap_us = sum / gaps.size();
+    double squares = 0;
+    for (double gap : gaps)
+    {
+        squares += (gap - measurement.mean_gap_us) * (gap - measurement.mean_gap_us);
+    }
+    measurement.stddev_gap_us = std::sqrt(squares / gaps.size());
+    measurement.max_gap_us = *std::max_element(gaps.begin(), gaps.end());
+    measurement.rate_kbps = sum > 0 ? bytes * 1000.0 / sum : 0;
+    measurement.valid = true;
+    return measurement;
+}
+
+/**
+ * Write @c samples samples of @c payload_size bytes, spread among @c writers writers, through a flow controller
+ * sending @c rate_kbps kilobytes per second.
+ * A @c burst of 0 limits the bandwidth per period, otherwise the samples are paced with a token bucket.
+ */
+Measurement run(
+        uint32_t domain,
+        uint32_t writers,
+        uint32_t sender_threads,
+        uint32_t samples,
+        uint32_t payload_size,
+        uint32_t rate_kbps,
+        uint32_t burst)
+{
+    Measurement measurement;
+
+    auto datagrams = std::make_shared<Datagrams>();
+    datagrams->min_size = payload_size;
+    datagrams->sent.reserve(samples);
+
+    auto flow_controller = std::make_shared<FlowControllerDescriptor>();
+    flow_controller->name = "pacing_benchmark";
+    flow_controller->scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    flow_controller->period_ms = 100;
+    flow_controller->max_bytes_per_period = static_cast<int32_t>(rate_kbps * flow_controller->period_ms);
+    flow_controller->max_burst_bytes = burst;
+    flow_controller->sender_threads = sender_threads;
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    TypeSupport type(new BenchmarkDataType(payload_size));
+
+    DomainParticipantQos pub_qos = PARTICIPANT_QOS_DEFAULT;
+    pub_qos.transport().use_builtin_transports = false;
+    pub_qos.transport().user_transports.push_back(std::make_shared<TimestampingTransportDescriptor>(
+                std::make_shared<UDPv4TransportDescriptor>(), datagrams));
+    pub_qos.flow_controllers().push_back(flow_controller);
+    DomainParticipantQos sub_qos = PARTICIPANT_QOS_DEFAULT;
+    sub_qos.transport().use_builtin_transports = false;
+    sub_qos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+
+    DomainParticipant* publisher_participant = factory->create_participant(domain, pub_qos);
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, sub_qos);
+    if (nullptr == publisher_participant || nullptr == subscriber_participant)
+    {
+        return measurement;
+    }
+    type.register_type(publisher_participant);
+    type.register_type(subscriber_participant);
+
+    Topic* pub_topic = publisher_participant->create_topic("flow_controller_pacing_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = subscriber_participant->create_topic("flow_controller_pacing_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+
+    // Best effort, so every sample is sent exactly once, and the whole history kept until it is sent
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+    wqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+    wqos.resource_limits().max_samples = static_cast<int32_t>(samples);
+    wqos.resource_limits().max_instances = 1;
+    wqos.resource_limits().max_samples_per_instance = static_cast<int32_t>(samples);
+    wqos.publish_mode().kind = ASYNCHRONOUS_PUBLISH_MODE;
+    wqos.publish_mode().flow_controller_name = flow_controller->name;
+    wqos.data_sharing().off();
+    DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+    rqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = 1;
+    rqos.data_sharing().off();
+
+    Publisher* publisher = publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    std::vector<DataWriter*> data_writers;
+    for (uint32_t i = 0; i < writers; ++i)
+    {
+        data_writers.push_back(publisher->create_datawriter(pub_topic, wqos));
+    }
+    DataReader* reader = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(
+        sub_topic, rqos);
+    bool ret = nullptr != reader &&
+            data_writers.end() == std::find(data_writers.begin(), data_writers.end(), nullptr);
+
+    PublicationMatchedStatus status;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    for (DataWriter* writer : data_writers)
+    {
+        do
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            writer->get_publication_matched_status(status);
+        } while (ret && status.current_count < 1 && std::chrono::steady_clock::now() < deadline);
+        ret &= status.current_count >= 1;
+    }
+
+    if (ret)
+    {
+        // Discovery traffic as big as a sample is discarded
+        {
+            std::lock_guard<std::mutex> guard(datagrams->mtx);
+            datagrams->sent.clear();
+            datagrams->bytes = 0;
+        }
+
+        BenchmarkSample sample;
+        sample.data.assign(payload_size, 0xAB);
+        for (uint32_t n = 0; n < samples; ++n)
+        {
+            data_writers[n % writers]->write(&sample);
+        }
+
+        // Let the flow controller send every sample at the configured rate
+        uint64_t expected = static_cast<uint64_t>(samples) * payload_size;
+        deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5) +
+                std::chrono::milliseconds(3 * expected / rate_kbps);
+        while (datagrams->bytes < expected && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        measurement = measure(*datagrams);
+        measurement.valid &= datagrams->bytes >= expected;
+    }
+
+    publisher_participant->delete_contained_entities();
+    factory->delete_participant(publisher_participant);
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: FlowControllerPacingBenchmark [--samples <n>] [--payload <bytes>] [--rate <KB/s>] "
+            "[--burst <bytes>] [--writers <n>] [--sender-threads <n>] [--domain <id>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t samples = 4000;
+    uint32_t payload_size = 1024;
+    uint32_t rate_kbps = 2000;
+    uint32_t burst = 0;
+    uint32_t writers = 4;
+    uint32_t sender_threads = 2;
+    uint32_t domain = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--payload")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--rate")
+        {
+            rate_kbps = value;
+        }
+        else if (arg == "--burst")
+        {
+            burst = value;
+        }
+        else if (arg == "--writers")
+        {
+            writers = value;
+        }
+        else if (arg == "--sender-threads")
+        {
+            sender_threads = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == samples || 0 == payload_size || 0 == rate_kbps || 0 == writers || 0 == sender_threads)
+    {
+        usage();
+        return 1;
+    }
+
+    // By default, the bucket holds a couple of samples per sender thread
+    if (0 == burst)
+    {
+        burst = 2 * (payload_size + 64) * sender_threads;
+    }
+
+    // Every sample has to cross the transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    printf("Samples: %u of %u bytes, rate: %u KB/s, writers: %u, sender threads: %u\n", samples, payload_size,
+            rate_kbps, writers, sender_threads);
+    printf("[         Mode][ Datagrams][ Mean gap(us)][ Stddev(us)][ Max gap(us)][ Dispersion][ Rate(KB/s)]\n");
+    Measurement limited = run(domain, writers, sender_threads, samples, payload_size, rate_kbps, 0);
+    Measurement token_bucket = run(domain, writers, sender_threads, samples, payload_size, rate_kbps, burst);
+
+    for (const Measurement* measurement : {&limited, &token_bucket})
+    {
+        printf("%15s,%11zu,%14.1f,%12.1f,%14.1f,%12.3f,%12.1f\n",
+                &limited == measurement ? "per period" : "token bucket", measurement->datagrams,
+                measurement->mean_gap_us, measurement->stddev_gap_us, measurement->max_gap_us,
+                measurement->dispersion(), measurement->rate_kbps);
+    }
+
+    if (!limited.valid || !token_bucket.valid)
+    {
+        printf("Not every sample was sent\n");
+        return 1;
+    }
+
+    // The token bucket has to spread datagrams more evenly than the limitation per period, without exceeding the rate
+    if (token_bucket.dispersion() >= limited.dispersion() || token_bucket.rate_kbps > 1.5 * rate_kbps)
+    {
+        printf("The token bucket did not pace the datagrams\n");
+        return 1;
+    }
+
+    return 0;
+}
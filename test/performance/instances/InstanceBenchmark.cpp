@@ -0,0 +1,190 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceBenchmark.cpp
+ *
+ * Measures the cost of the instance lookups done by the DataReader and DataWriter histories on every sample, comparing
+ * the ordered map they used to keep with the pooled hash table they use now.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+#include <fastdds/utils/InstanceHashTable.hpp>
+
+using eprosima::fastdds::dds::ResourceLimitsQosPolicy;
+using eprosima::fastdds::dds::detail::InstanceHashTable;
+using eprosima::fastdds::rtps::InstanceHandle_t;
+using eprosima::fastdds::rtps::octet;
+
+namespace {
+
+struct BenchmarkInstance
+{
+    uint64_t samples = 0;
+    uint64_t padding[7] = {};
+};
+
+struct Measurement
+{
+    double insert_ns = 0;
+    double find_ns = 0;
+    double churn_ns = 0;
+};
+
+std::vector<InstanceHandle_t> create_handles(
+        uint32_t count,
+        std::mt19937_64& generator)
+{
+    std::vector<InstanceHandle_t> handles(count);
+    for (InstanceHandle_t& handle : handles)
+    {
+        // Keys longer than 16 bytes are MD5 digests, so handles look random
+        uint64_t halves[2] = {generator(), generator()};
+        octet* value = handle.value;
+        memcpy(value, halves, sizeof(halves));
+    }
+    return handles;
+}
+
+template<typename Collection>
+Measurement measure(
+        Collection& collection,
+        const std::vector<InstanceHandle_t>& handles,
+        const std::vector<uint32_t>& lookups)
+{
+    using clock = std::chrono::steady_clock;
+    Measurement ret;
+
+    auto start = clock::now();
+    for (const InstanceHandle_t& handle : handles)
+    {
+        collection.emplace(handle, BenchmarkInstance());
+    }
+    ret.insert_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / handles.size();
+
+    start = clock::now();
+    for (uint32_t index : lookups)
+    {
+        auto it = collection.find(handles[index]);
+        if (it != collection.end())
+        {
+            ++it->second.samples;
+        }
+    }
+    ret.find_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups.size();
+
+    // Instances being disposed and registered again
+    start = clock::now();
+    for (uint32_t index : lookups)
+    {
+        collection.erase(handles[index]);
+        collection.emplace(handles[index], BenchmarkInstance());
+    }
+    ret.churn_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups.size();
+
+    return ret;
+}
+
+void usage()
+{
+    printf("Usage: InstanceBenchmark [--max-instances <n>] [--lookups <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_instances = 100000;
+    uint32_t lookups_count = 1000000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-instances")
+        {
+            max_instances = value;
+        }
+        else if (arg == "--lookups")
+        {
+            lookups_count = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_instances || 0 == lookups_count)
+    {
+        usage();
+        return 1;
+    }
+
+    std::mt19937_64 generator(42);
+
+    printf("[ Instances][   Collection][ Insert(ns)][   Find(ns)][  Churn(ns)]\n");
+    for (uint32_t instances = 10; instances <= max_instances; instances *= 10)
+    {
+        std::vector<InstanceHandle_t> handles = create_handles(instances, generator);
+        std::vector<uint32_t> lookups(lookups_count);
+        std::uniform_int_distribution<uint32_t> distribution(0, instances - 1);
+        std::generate(lookups.begin(), lookups.end(), [&]()
+                {
+                    return distribution(generator);
+                });
+
+        {
+            std::map<InstanceHandle_t, BenchmarkInstance> map;
+            Measurement result = measure(map, handles, lookups);
+            printf("%12u,%14s,%12.1f,%12.1f,%12.1f\n", instances, "std::map", result.insert_ns, result.find_ns,
+                    result.churn_ns);
+        }
+
+        {
+            // Preallocated as a DataReader with allocated_samples equal to the number of instances would do
+            ResourceLimitsQosPolicy resource_limits;
+            resource_limits.max_instances = static_cast<int32_t>(instances);
+            resource_limits.allocated_samples = static_cast<int32_t>(instances);
+            InstanceHashTable<BenchmarkInstance> table(resource_limits);
+            Measurement result = measure(table, handles, lookups);
+            printf("%12u,%14s,%12.1f,%12.1f,%12.1f\n", instances, "hash table", result.insert_ns, result.find_ns,
+                    result.churn_ns);
+        }
+    }
+
+    return 0;
+}
@@ -104,6 +104,7 @@ bool LatencyTestPublisher::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
+        uint32_t listener_spin_us,
         int forced_domain,
         LatencyDataSizes& latency_data_sizes)
 {
@@ -118,6 +119,7 @@ bool LatencyTestPublisher::init(
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
+    listener_spin_us_ = listener_spin_us;
     forced_domain_ = forced_domain;
     raw_data_file_ = raw_data_file;
     pid_ = pid;
@@ -211,6 +213,20 @@ bool LatencyTestPublisher::init(
         pqos.transport().use_builtin_transports = false;
     }
 
+    // Let the shared memory listeners poll their ports before blocking
+    if (0 < listener_spin_us_)
+    {
+        for (auto& transport : pqos.transport().user_transports)
+        {
+            auto shm_transport =
+                    std::dynamic_pointer_cast<eprosima::fastdds::rtps::SharedMemTransportDescriptor>(transport);
+            if (shm_transport)
+            {
+                shm_transport->listener_spin_budget_us(listener_spin_us_);
+            }
+        }
+    }
+
     // Create the participant
     participant_ =
             DomainParticipantFactory::get_instance()->create_participant(domainId, pqos);
@@ -308,6 +324,9 @@ bool LatencyTestPublisher::init(
             dr_qos_.data_sharing(dsp);
         }
 
+        // Let the data-sharing listeners poll for new data before blocking
+        dr_qos_.data_sharing().listener_spin_budget_us(listener_spin_us_);
+
         // Increase payload pool size to prevent loan failures due to outages
         if (data_loans_)
         {
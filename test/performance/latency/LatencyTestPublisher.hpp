@@ -95,6 +95,7 @@ public:
             Arg::EnablerValue data_sharing,
             bool data_loans,
             Arg::EnablerValue shared_memory,
+            uint32_t listener_spin_us,
             int forced_domain,
             LatencyDataSizes& latency_data_sizes);
 
@@ -198,6 +199,7 @@ private:
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
+    uint32_t listener_spin_us_ = 0;
     int forced_domain_ = -1;
     int subscribers_ = 0;
     unsigned int samples_ = 0;
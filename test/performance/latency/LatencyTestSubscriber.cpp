@@ -95,6 +95,7 @@ bool LatencyTestSubscriber::init(
         Arg::EnablerValue data_sharing,
         bool data_loans,
         Arg::EnablerValue shared_memory,
+        uint32_t listener_spin_us,
         int forced_domain,
         LatencyDataSizes& latency_data_sizes)
 {
@@ -106,6 +107,7 @@ bool LatencyTestSubscriber::init(
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
     shared_memory_ = shared_memory;
+    listener_spin_us_ = listener_spin_us;
     forced_domain_ = forced_domain;
     pid_ = pid;
     hostname_ = hostname;
@@ -167,6 +169,20 @@ bool LatencyTestSubscriber::init(
         pqos.transport().use_builtin_transports = false;
     }
 
+    // Let the shared memory listeners poll their ports before blocking
+    if (0 < listener_spin_us_)
+    {
+        for (auto& transport : pqos.transport().user_transports)
+        {
+            auto shm_transport =
+                    std::dynamic_pointer_cast<eprosima::fastdds::rtps::SharedMemTransportDescriptor>(transport);
+            if (shm_transport)
+            {
+                shm_transport->listener_spin_budget_us(listener_spin_us_);
+            }
+        }
+    }
+
     // Create the participant
     participant_ = DomainParticipantFactory::get_instance()->create_participant(domainId, pqos);
     if (participant_ == nullptr)
@@ -261,6 +277,9 @@ bool LatencyTestSubscriber::init(
             dr_qos_.data_sharing(dsp);
         }
 
+        // Let the data-sharing listeners poll for new data before blocking
+        dr_qos_.data_sharing().listener_spin_budget_us(listener_spin_us_);
+
         // Increase payload pool size to prevent loan failures due to outages
         if (data_loans_)
         {
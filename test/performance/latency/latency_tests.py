@@ -81,6 +81,11 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '--listener_spin',
+        help='Microseconds data-sharing and shared memory listeners poll before blocking. (Defaults: 0, always block)',
+        required=False
+        )
 
     # Parse arguments
     args = parser.parse_args()
@@ -138,6 +143,12 @@ if __name__ == '__main__':
     elif args.data_loans:
         filename_options += '_data_loans'
 
+    if args.listener_spin:
+        if not str.isdigit(args.listener_spin):
+            print('"listener_spin" must be a non-negative integer, NOT {}'.format(args.listener_spin))
+            exit(1)  # Exit with error
+        filename_options += '_listener_spin'
+
     # add flags to the command line
     data_options = []
 
@@ -150,6 +161,9 @@ if __name__ == '__main__':
     if args.data_loans:
         data_options += ['--data_loans']
 
+    if args.listener_spin:
+        data_options += ['--listener_spin={}'.format(args.listener_spin)]
+
     reliability_options = []
     if args.reliability:
         reliability_options = ['--reliability=reliable']
@@ -63,7 +63,8 @@ enum  optionIndex
     FILE_R,
     DATA_SHARING,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    LISTENER_SPIN
 };
 
 enum TestAgent
@@ -99,6 +100,8 @@ const option::Descriptor usage[] = {
       "               --data_loans          Use loan sample API." },
     { SHARED_MEMORY,    0, "", "shared_memory", Arg::Enabler,
       "               --shared_memory=[on|off]             Explicitly enable/disable shared memory transport." },
+    { LISTENER_SPIN,    0, "", "listener_spin",   Arg::Numeric,
+      "               --listener_spin=<us>  Time data-sharing and shared memory listeners poll before blocking." },
 #if HAVE_SECURITY
     {
         USE_SECURITY,    0, "",  "security",        Arg::Required,
@@ -229,6 +232,7 @@ int main(
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
+    uint32_t listener_spin_us = 0;
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -406,6 +410,9 @@ int main(
                     shared_memory = Arg::EnablerValue::OFF;
                 }
                 break;
+            case LISTENER_SPIN:
+                listener_spin_us = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
             case UNKNOWN_OPT:
             default:
                 option::printUsage(fwrite, stdout, usage, columns);
@@ -500,7 +507,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         if (latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv, export_prefix,
                 raw_data_file, pub_part_property_policy, pub_property_policy, xml_config_file,
-                dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                dynamic_types, data_sharing, data_loans, shared_memory, listener_spin_us, forced_domain,
+                data_sizes))
         {
             latency_publisher.run();
         }
@@ -515,7 +523,8 @@ int main(
         LatencyTestSubscriber latency_subscriber;
         if (latency_subscriber.init(echo, samples, reliable, seed, hostname, sub_part_property_policy,
                 sub_property_policy,
-                xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, listener_spin_us,
+                forced_domain, data_sizes))
         {
             latency_subscriber.run();
         }
@@ -534,8 +543,8 @@ int main(
         LatencyTestPublisher latency_publisher;
         bool pub_init = latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv,
                         export_prefix, raw_data_file, pub_part_property_policy, pub_property_policy,
-                        xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain,
-                        data_sizes);
+                        xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, listener_spin_us,
+                        forced_domain, data_sizes);
 
         // Initialize subscribers
         std::vector<std::shared_ptr<LatencyTestSubscriber>> latency_subscribers;
@@ -547,7 +556,7 @@ int main(
             sub_init &= latency_subscribers.back()->init(echo, samples, reliable, seed, hostname,
                             sub_part_property_policy,
                             sub_property_policy, xml_config_file, dynamic_types, data_sharing, data_loans,
-                            shared_memory,
+                            shared_memory, listener_spin_us,
                             forced_domain, data_sizes);
         }
 
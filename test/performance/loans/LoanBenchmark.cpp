@@ -0,0 +1,331 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoanBenchmark.cpp
+ *
+ * Measures the cost per sample of loaning samples and sample infos on a read / take with loans, and of returning them
+ * afterwards, for reads of different sizes.
+ * The same pools and the same order of operations than DataReaderImpl are used.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+
+#include <fastdds/subscriber/DataReaderImpl/SampleInfoPool.hpp>
+#include <fastdds/subscriber/DataReaderImpl/SampleLoanManager.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+constexpr uint32_t sample_size = 64;
+
+struct BenchmarkSample
+{
+    uint8_t data[sample_size];
+};
+
+/**
+ * Type whose samples are copied from the payload, after the representation header.
+ */
+class BenchmarkType : public TopicDataType
+{
+public:
+
+    BenchmarkType()
+    {
+        setName("BenchmarkSample");
+        m_typeSize = 4u + sample_size;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        memcpy(payload->data + 4u, data, sample_size);
+        payload->length = m_typeSize;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        memcpy(data, payload->data + 4u, sample_size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        uint32_t size = m_typeSize;
+        return [size]()
+               {
+                   return size;
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+/**
+ * Payload pool sharing the buffer of the received changes with the loans, as the pools of the readers do.
+ */
+class BenchmarkPayloadPool : public IPayloadPool
+{
+public:
+
+    bool get_payload(
+            uint32_t size,
+            SerializedPayload_t& payload) override
+    {
+        payload.data = static_cast<octet*>(calloc(size, 1));
+        payload.max_size = size;
+        payload.length = size;
+        payload.payload_owner = this;
+        return true;
+    }
+
+    bool get_payload(
+            const SerializedPayload_t& data,
+            SerializedPayload_t& payload) override
+    {
+        payload.data = data.data;
+        payload.max_size = data.max_size;
+        payload.length = data.length;
+        payload.payload_owner = this;
+        ++shared_;
+        return true;
+    }
+
+    bool release_payload(
+            SerializedPayload_t& payload) override
+    {
+        if (0 < shared_)
+        {
+            --shared_;
+        }
+        else
+        {
+            free(payload.data);
+        }
+        payload.data = nullptr;
+        payload.length = 0;
+        payload.max_size = 0;
+        payload.payload_owner = nullptr;
+        return true;
+    }
+
+    uint64_t shared() const
+    {
+        return shared_;
+    }
+
+private:
+
+    uint64_t shared_ = 0;
+};
+
+struct Measurement
+{
+    double loan_ns = 0;
+    double return_ns = 0;
+    uint64_t checksum = 0;
+};
+
+/**
+ * Loan and return @c changes.size() samples @c reads times.
+ */
+Measurement run(
+        std::vector<CacheChange_t>& changes,
+        uint32_t reads,
+        bool is_plain)
+{
+    uint32_t num_samples = static_cast<uint32_t>(changes.size());
+
+    DataReaderQos qos;
+    qos.reader_resource_limits().max_samples_per_read = static_cast<int32_t>(num_samples);
+    TypeSupport type(new BenchmarkType());
+    PoolConfig config {PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 0, 32, 0};
+    detail::SampleInfoPool info_pool(qos);
+    detail::SampleLoanManager sample_pool(config, type, is_plain);
+
+    std::vector<void*> samples(num_samples);
+    std::vector<SampleInfo*> infos(num_samples);
+    std::chrono::steady_clock::duration loan_time {};
+    std::chrono::steady_clock::duration return_time {};
+    Measurement measurement;
+
+    for (uint32_t r = 0; r < reads; ++r)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < num_samples; ++n)
+        {
+            infos[n] = info_pool.get_item();
+            infos[n]->valid_data = true;
+            sample_pool.get_loan(&changes[n], samples[n]);
+        }
+        auto loaned = std::chrono::steady_clock::now();
+
+        for (uint32_t n = 0; n < num_samples; ++n)
+        {
+            measurement.checksum += static_cast<const BenchmarkSample*>(samples[n])->data[0];
+        }
+
+        auto returning = std::chrono::steady_clock::now();
+        uint32_t n = num_samples;
+        while (n > 0)
+        {
+            --n;
+            if (infos[n]->valid_data)
+            {
+                sample_pool.return_loan(samples[n]);
+            }
+            info_pool.return_item(infos[n]);
+        }
+        auto returned = std::chrono::steady_clock::now();
+
+        loan_time += loaned - start;
+        return_time += returned - returning;
+    }
+
+    double total = static_cast<double>(reads) * num_samples;
+    measurement.loan_ns = std::chrono::duration<double, std::nano>(loan_time).count() / total;
+    measurement.return_ns = std::chrono::duration<double, std::nano>(return_time).count() / total;
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: LoanBenchmark [--max-samples <n>] [--reads <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_samples = 10000;
+    uint32_t reads = 100;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-samples")
+        {
+            max_samples = value;
+        }
+        else if (arg == "--reads")
+        {
+            reads = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_samples || 0 == reads)
+    {
+        usage();
+        return 1;
+    }
+
+    BenchmarkPayloadPool payload_pool;
+    BenchmarkType type;
+
+    printf("[   Samples][     Type][  Loan(ns)][Return(ns)]\n");
+    for (uint32_t num_samples = 1; num_samples <= max_samples; num_samples *= 10)
+    {
+        // Changes as they would be on the history of the reader, with the sample index on their first byte
+        std::vector<CacheChange_t> changes(num_samples);
+        uint64_t expected = 0;
+        for (uint32_t n = 0; n < num_samples; ++n)
+        {
+            BenchmarkSample sample {};
+            sample.data[0] = static_cast<uint8_t>(n);
+            expected += sample.data[0];
+
+            payload_pool.get_payload(4u + sample_size, changes[n].serializedPayload);
+            type.serialize(&sample, &changes[n].serializedPayload);
+        }
+        expected *= reads;
+
+        for (bool is_plain : {true, false})
+        {
+            Measurement measurement = run(changes, reads, is_plain);
+            printf("%11u,%10s,%11.1f,%11.1f\n", num_samples, is_plain ? "plain" : "not plain",
+                    measurement.loan_ns, measurement.return_ns);
+
+            if (measurement.checksum != expected || 0 != payload_pool.shared())
+            {
+                printf("Wrong samples were loaned (checksum %llu instead of %llu, %llu payloads not returned)\n",
+                        static_cast<unsigned long long>(measurement.checksum),
+                        static_cast<unsigned long long>(expected),
+                        static_cast<unsigned long long>(payload_pool.shared()));
+                return 1;
+            }
+        }
+
+        for (CacheChange_t& change : changes)
+        {
+            payload_pool.release_payload(change.serializedPayload);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogBenchmark.cpp
+ *
+ * Measures the cost of logging from several threads at once, as when warnings burst on the data path, with each of
+ * the policies applied when the queue of pending entries is full.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+
+using eprosima::fastdds::dds::Log;
+using eprosima::fastdds::dds::LogConsumer;
+
+namespace {
+
+class CountingConsumer : public LogConsumer
+{
+public:
+
+    explicit CountingConsumer(
+            std::atomic<uint64_t>& consumed)
+        : consumed_(consumed)
+    {
+    }
+
+    void Consume(
+            const Log::Entry&) override
+    {
+        ++consumed_;
+    }
+
+private:
+
+    std::atomic<uint64_t>& consumed_;
+};
+
+struct Measurement
+{
+    double log_ns = 0;
+    double entries_per_sec = 0;
+    uint64_t consumed = 0;
+    uint64_t dropped = 0;
+};
+
+Measurement measure(
+        uint32_t threads,
+        uint32_t messages,
+        Log::QueueFullPolicy policy)
+{
+    using clock = std::chrono::steady_clock;
+    Measurement ret;
+
+    std::atomic<uint64_t> consumed(0);
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new CountingConsumer(consumed)));
+    Log::SetQueueFullPolicy(policy);
+    uint64_t dropped_before = Log::GetDroppedEntries();
+
+    std::vector<std::thread> producers;
+    std::vector<double> producer_ns(threads);
+    auto start = clock::now();
+    for (uint32_t t = 0; t < threads; ++t)
+    {
+        producers.emplace_back([t, messages, &producer_ns]()
+                {
+                    auto producer_start = clock::now();
+                    for (uint32_t i = 0; i < messages; ++i)
+                    {
+                        EPROSIMA_LOG_WARNING(BENCHMARK, "Thread " << t << " message " << i);
+                    }
+                    producer_ns[t] = std::chrono::duration<double, std::nano>(clock::now() - producer_start).count();
+                });
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    Log::Flush();
+    double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+    for (double ns : producer_ns)
+    {
+        ret.log_ns += ns / messages;
+    }
+    ret.log_ns /= threads;
+    ret.consumed = consumed.load();
+    ret.dropped = Log::GetDroppedEntries() - dropped_before;
+    ret.entries_per_sec = ret.consumed / elapsed;
+    return ret;
+}
+
+void usage()
+{
+    printf("Usage: LogBenchmark [--max-threads <n>] [--messages <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 8;
+    uint32_t messages = 100000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-threads")
+        {
+            max_threads = value;
+        }
+        else if (arg == "--messages")
+        {
+            messages = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_threads || 0 == messages)
+    {
+        usage();
+        return 1;
+    }
+
+    Log::SetVerbosity(Log::Warning);
+
+    printf("[ Threads][ Policy][  Log(ns)][ Consumed/s][  Consumed][   Dropped]\n");
+    for (uint32_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        for (Log::QueueFullPolicy policy : {Log::Block, Log::Drop})
+        {
+            Measurement result = measure(threads, messages, policy);
+            printf("%10u,%9s,%10.1f,%12.0f,%11llu,%11llu\n", threads, Log::Block == policy ? "block" : "drop",
+                    result.log_ns, result.entries_per_sec, static_cast<unsigned long long>(result.consumed),
+                    static_cast<unsigned long long>(result.dropped));
+        }
+    }
+
+    Log::Reset();
+    Log::KillThread();
+    return 0;
+}
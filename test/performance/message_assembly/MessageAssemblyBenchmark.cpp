@@ -0,0 +1,625 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MessageAssemblyBenchmark.cpp
+ *
+ * Measures how many bytes are copied to assemble the RTPS messages of a sample, and how many are gathered straight
+ * from the payload of the sample, for each one of the built-in transports.
+ * A chaining transport inspects the buffers handed to the transport, and a payload pool on the writer tells which of
+ * them point to the payload of a sample.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/transport/ChainingTransport.h>
+#include <fastdds/rtps/transport/ChainingTransportDescriptor.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/utils/IPLocator.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+//! Whether the calling thread is inside DataWriter::write(), so discovery traffic is not taken into account.
+thread_local bool writing = false;
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t max_payload_size)
+    {
+        setName("MessageAssemblyBenchmarkType");
+        m_typeSize = max_payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+/**
+ * Payload pool of the writer, which keeps track of the blocks it has given, so the transport can tell whether a
+ * buffer points to the payload of a sample.
+ */
+class TrackingPayloadPool : public IPayloadPool
+{
+public:
+
+    bool get_payload(
+            uint32_t size,
+            SerializedPayload_t& payload) override
+    {
+        octet* data = new octet[size];
+        {
+            std::lock_guard<std::mutex> guard(mtx_);
+            blocks_[data] = Block{size, 1u};
+        }
+
+        payload.data = data;
+        payload.length = 0;
+        payload.max_size = size;
+        payload.payload_owner = this;
+        return true;
+    }
+
+    bool get_payload(
+            const SerializedPayload_t& data,
+            SerializedPayload_t& payload) override
+    {
+        if (this != data.payload_owner)
+        {
+            if (!get_payload(data.length, payload))
+            {
+                return false;
+            }
+            memcpy(payload.data, data.data, data.length);
+            payload.length = data.length;
+            return true;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(mtx_);
+            ++blocks_[data.data].references;
+        }
+        payload.data = data.data;
+        payload.length = data.length;
+        payload.max_size = data.max_size;
+        payload.payload_owner = this;
+        return true;
+    }
+
+    bool release_payload(
+            SerializedPayload_t& payload) override
+    {
+        {
+            std::lock_guard<std::mutex> guard(mtx_);
+            auto it = blocks_.find(payload.data);
+            if (blocks_.end() == it)
+            {
+                return false;
+            }
+            if (0 == --it->second.references)
+            {
+                blocks_.erase(it);
+                delete[] payload.data;
+            }
+        }
+
+        payload.data = nullptr;
+        payload.length = 0;
+        payload.max_size = 0;
+        payload.payload_owner = nullptr;
+        return true;
+    }
+
+    //! Whether a buffer lies inside a payload given by the pool.
+    bool contains(
+            const NetworkBuffer& buffer)
+    {
+        const octet* ptr = static_cast<const octet*>(buffer.buffer);
+        std::lock_guard<std::mutex> guard(mtx_);
+        auto it = blocks_.upper_bound(ptr);
+        if (blocks_.begin() == it)
+        {
+            return false;
+        }
+        --it;
+        return ptr >= it->first && ptr + buffer.size <= it->first + it->second.size;
+    }
+
+private:
+
+    struct Block
+    {
+        uint32_t size;
+        uint32_t references;
+    };
+
+    std::mutex mtx_;
+    std::map<const octet*, Block> blocks_;
+};
+
+struct Counters
+{
+    //! Bytes handed to the transport.
+    std::atomic<uint64_t> sent{0};
+    //! Bytes handed to the transport on buffers pointing to the payload of a sample.
+    std::atomic<uint64_t> gathered{0};
+    //! Bytes copied by the transport itself before handing them to the operating system.
+    std::atomic<uint64_t> transport_copied{0};
+
+    void reset()
+    {
+        sent = 0;
+        gathered = 0;
+        transport_copied = 0;
+    }
+
+};
+
+class InspectingTransportDescriptor : public ChainingTransportDescriptor
+{
+public:
+
+    InspectingTransportDescriptor(
+            std::shared_ptr<TransportDescriptorInterface> low_level,
+            std::shared_ptr<TrackingPayloadPool> pool,
+            std::shared_ptr<Counters> counters)
+        : ChainingTransportDescriptor(low_level)
+        , pool(pool)
+        , counters(counters)
+    {
+    }
+
+    TransportInterface* create_transport() const override;
+
+    std::shared_ptr<TrackingPayloadPool> pool;
+    std::shared_ptr<Counters> counters;
+};
+
+class InspectingTransport : public ChainingTransport
+{
+public:
+
+    explicit InspectingTransport(
+            const InspectingTransportDescriptor& descriptor)
+        : ChainingTransport(descriptor)
+        , descriptor_(descriptor)
+    {
+    }
+
+    TransportDescriptorInterface* get_configuration() override
+    {
+        return &descriptor_;
+    }
+
+    bool send(
+            SenderResource* low_sender_resource,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& timeout) override
+    {
+        if (writing)
+        {
+            Counters& counters = *descriptor_.counters;
+            counters.sent += total_bytes;
+            for (const NetworkBuffer& buffer : buffers)
+            {
+                if (descriptor_.pool->contains(buffer))
+                {
+                    counters.gathered += buffer.size;
+                }
+            }
+
+            // Shared memory copies the whole message into the segment, while UDP and TCP hand the buffers over to
+            // the socket
+            if (LOCATOR_KIND_SHM == kind())
+            {
+                counters.transport_copied += total_bytes;
+            }
+        }
+
+        return low_sender_resource->send(buffers, total_bytes, destination_locators_begin,
+                       destination_locators_end, timeout);
+    }
+
+    void receive(
+            TransportReceiverInterface* next_receiver,
+            const octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            const Locator_t& local_locator,
+            const Locator_t& remote_locator) override
+    {
+        next_receiver->OnDataReceived(receive_buffer, receive_buffer_size, local_locator, remote_locator);
+    }
+
+private:
+
+    InspectingTransportDescriptor descriptor_;
+};
+
+TransportInterface* InspectingTransportDescriptor::create_transport() const
+{
+    return new InspectingTransport(*this);
+}
+
+struct Measurement
+{
+    bool valid = false;
+    double sent = 0;
+    double gathered = 0;
+    double copied = 0;
+    double transport_copied = 0;
+};
+
+/**
+ * Transports of the publishing and the subscribing participant for a transport kind.
+ * Returns false if the kind is unknown.
+ */
+bool make_transports(
+        const std::string& kind,
+        uint32_t max_payload_size,
+        uint16_t port,
+        std::shared_ptr<TransportDescriptorInterface>& publisher,
+        std::shared_ptr<TransportDescriptorInterface>& subscriber,
+        LocatorList_t& initial_peers)
+{
+    if ("udp" == kind)
+    {
+        publisher = std::make_shared<UDPv4TransportDescriptor>();
+        subscriber = std::make_shared<UDPv4TransportDescriptor>();
+    }
+    else if ("tcp" == kind)
+    {
+        auto server = std::make_shared<TCPv4TransportDescriptor>();
+        server->add_listener_port(port);
+        publisher = server;
+        subscriber = std::make_shared<TCPv4TransportDescriptor>();
+
+        Locator_t peer;
+        peer.kind = LOCATOR_KIND_TCPv4;
+        peer.port = port;
+        IPLocator::setIPv4(peer, 127, 0, 0, 1);
+        initial_peers.push_back(peer);
+    }
+    else if ("shm" == kind)
+    {
+        // Big enough to hold every fragment of the biggest sample
+        auto shm_publisher = std::make_shared<SharedMemTransportDescriptor>();
+        shm_publisher->segment_size(2 * max_payload_size + 1024 * 1024);
+        auto shm_subscriber = std::make_shared<SharedMemTransportDescriptor>();
+        shm_subscriber->segment_size(2 * max_payload_size + 1024 * 1024);
+        publisher = shm_publisher;
+        subscriber = shm_subscriber;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Write @c samples samples of every payload size, from 64 bytes up to @c max_payload_size, through a transport kind.
+ */
+bool run(
+        const std::string& kind,
+        uint32_t domain,
+        uint16_t port,
+        uint32_t max_payload_size,
+        uint32_t samples)
+{
+    std::shared_ptr<TransportDescriptorInterface> publisher_transport;
+    std::shared_ptr<TransportDescriptorInterface> subscriber_transport;
+    LocatorList_t initial_peers;
+    if (!make_transports(kind, max_payload_size, port, publisher_transport, subscriber_transport, initial_peers))
+    {
+        printf("Unknown transport %s\n", kind.c_str());
+        return false;
+    }
+
+    auto pool = std::make_shared<TrackingPayloadPool>();
+    auto counters = std::make_shared<Counters>();
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    TypeSupport type(new BenchmarkDataType(max_payload_size));
+
+    DomainParticipantQos pub_qos = PARTICIPANT_QOS_DEFAULT;
+    pub_qos.transport().use_builtin_transports = false;
+    pub_qos.transport().user_transports.push_back(std::make_shared<InspectingTransportDescriptor>(
+                publisher_transport, pool, counters));
+    DomainParticipantQos sub_qos = PARTICIPANT_QOS_DEFAULT;
+    sub_qos.transport().use_builtin_transports = false;
+    sub_qos.transport().user_transports.push_back(subscriber_transport);
+    sub_qos.wire_protocol().builtin.initialPeersList = initial_peers;
+
+    DomainParticipant* publisher_participant = factory->create_participant(domain, pub_qos);
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, sub_qos);
+    if (nullptr == publisher_participant || nullptr == subscriber_participant)
+    {
+        return false;
+    }
+    type.register_type(publisher_participant);
+    type.register_type(subscriber_participant);
+
+    Topic* pub_topic = publisher_participant->create_topic("message_assembly_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = subscriber_participant->create_topic("message_assembly_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+
+    // Best effort, so every sample is sent exactly once from inside DataWriter::write()
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+    wqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    wqos.history().depth = 1;
+    wqos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    wqos.data_sharing().off();
+    DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+    rqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = 1;
+    rqos.data_sharing().off();
+
+    DataWriter* writer = publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(
+        pub_topic, wqos, nullptr, StatusMask::all(), pool);
+    DataReader* reader = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(
+        sub_topic, rqos);
+    if (nullptr == writer || nullptr == reader)
+    {
+        return false;
+    }
+
+    PublicationMatchedStatus status;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    do
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        writer->get_publication_matched_status(status);
+    } while (status.current_count < 1 && std::chrono::steady_clock::now() < deadline);
+
+    bool ret = status.current_count >= 1;
+    if (!ret)
+    {
+        printf("The reader was not discovered through %s\n", kind.c_str());
+    }
+
+    BenchmarkSample sample;
+    for (uint32_t payload_size = 64; ret && payload_size <= max_payload_size; payload_size *= 16)
+    {
+        sample.data.assign(payload_size, 0xAB);
+        uint32_t serialized_size = payload_size + 4;
+
+        counters->reset();
+        for (uint32_t n = 0; n < samples; ++n)
+        {
+            writing = true;
+            writer->write(&sample);
+            writing = false;
+        }
+
+        Measurement measurement;
+        measurement.sent = static_cast<double>(counters->sent) / samples;
+        measurement.gathered = static_cast<double>(counters->gathered) / samples;
+        measurement.copied = measurement.sent - measurement.gathered;
+        measurement.transport_copied = static_cast<double>(counters->transport_copied) / samples;
+
+        // Every sample has to reach the transport, and its payload has to be gathered instead of copied
+        measurement.valid = measurement.gathered >= serialized_size;
+        printf("%11s,%12u,%15.1f,%17.1f,%15.1f,%17.1f\n", kind.c_str(), payload_size, measurement.sent,
+                measurement.gathered, measurement.copied, measurement.transport_copied);
+        if (!measurement.valid)
+        {
+            printf("The payload was not gathered from the sample with %s and %u bytes\n", kind.c_str(),
+                    payload_size);
+            ret = false;
+        }
+    }
+
+    publisher_participant->delete_contained_entities();
+    factory->delete_participant(publisher_participant);
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return ret;
+}
+
+void usage()
+{
+    printf("Usage: MessageAssemblyBenchmark [--max-size <bytes>] [--samples <n>] [--transport udp|tcp|shm|all] "
+            "[--domain <id>] [--port <port>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_payload_size = 4 * 1024 * 1024;
+    uint32_t samples = 100;
+    std::string transport = "all";
+    uint32_t domain = 0;
+    uint32_t port = 7650;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        std::string value(argv[++i]);
+        if (arg == "--max-size")
+        {
+            max_payload_size = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else if (arg == "--samples")
+        {
+            samples = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else if (arg == "--transport")
+        {
+            transport = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else if (arg == "--port")
+        {
+            port = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (max_payload_size < 64 || 0 == samples || 0xFFFF <= port)
+    {
+        usage();
+        return 1;
+    }
+
+    // Every sample has to cross a transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    std::vector<std::string> kinds;
+    if ("all" == transport)
+    {
+        kinds = {"udp", "tcp", "shm"};
+    }
+    else
+    {
+        kinds.push_back(transport);
+    }
+
+    printf("Samples: %u per payload size, bytes per sample\n", samples);
+    printf("[ Transport][ Payload(B)][          Sent][ Gathered(zero)][ Copied(group)][ Copied(transport)]\n");
+    for (const std::string& kind : kinds)
+    {
+        if (!run(kind, domain, static_cast<uint16_t>(port), max_payload_size, samples))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadPoolBenchmark.cpp
+ *
+ * Measures the cost of getting and releasing payloads of a topic payload pool shared by several threads, comparing a
+ * single free list guarded by a mutex, as TopicPayloadPool used before, with the sharded free lists it uses now.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <rtps/history/TopicPayloadPool.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+//! Bytes of each payload
+constexpr uint32_t payload_size = 256;
+
+struct Measurement
+{
+    double operation_ns = 0;
+    uint64_t operations = 0;
+};
+
+/**
+ * Emulation of the pool used before: a single free list guarded by a single mutex, with reference counted payloads.
+ */
+class SingleFreeList
+{
+public:
+
+    struct Node
+    {
+        std::atomic<uint32_t> ref_counter {0};
+        octet data[payload_size];
+    };
+
+    explicit SingleFreeList(
+            uint32_t num_payloads)
+        : nodes_(new Node[num_payloads])
+    {
+        for (uint32_t i = 0; i < num_payloads; ++i)
+        {
+            free_.push_back(&nodes_[i]);
+        }
+    }
+
+    Node* get()
+    {
+        Node* node = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (free_.empty())
+            {
+                return nullptr;
+            }
+            node = free_.back();
+            free_.pop_back();
+        }
+        node->ref_counter.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    void release(
+            Node* node)
+    {
+        if (node->ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(node);
+        }
+    }
+
+private:
+
+    std::unique_ptr<Node[]> nodes_;
+    std::vector<Node*> free_;
+    std::mutex mutex_;
+};
+
+/**
+ * Run @c threads_count threads doing @c operations get/release pairs each at the same time.
+ */
+template<typename Operation>
+Measurement run(
+        uint32_t threads_count,
+        uint32_t operations,
+        Operation operation)
+{
+    std::atomic<uint64_t> done {0};
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    uint64_t succeeded = 0;
+                    for (uint32_t i = 0; i < operations; ++i)
+                    {
+                        if (operation(i))
+                        {
+                            ++succeeded;
+                        }
+                    }
+                    done += succeeded;
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Measurement measurement;
+    measurement.operations = done;
+    measurement.operation_ns = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / (static_cast<double>(threads_count) * operations);
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: PayloadPoolBenchmark [--max-threads <n>] [--operations <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 16;
+    uint32_t operations = 1000000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-threads")
+        {
+            max_threads = value;
+        }
+        else if (arg == "--operations")
+        {
+            operations = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_threads || 0 == operations)
+    {
+        usage();
+        return 1;
+    }
+
+    printf("[   Threads][          Pool][ Get+release(ns)][   Operations]\n");
+    for (uint32_t threads_count = 1; threads_count <= max_threads; threads_count *= 2)
+    {
+        // Twice as many payloads as threads, so every get should succeed
+        uint32_t num_payloads = threads_count * 2;
+        uint64_t expected = static_cast<uint64_t>(threads_count) * operations;
+
+        SingleFreeList single_free_list(num_payloads);
+        Measurement single = run(threads_count, operations, [&](uint32_t i)
+                        {
+                            SingleFreeList::Node* node = single_free_list.get();
+                            if (nullptr == node)
+                            {
+                                return false;
+                            }
+                            node->data[0] = static_cast<octet>(i);
+                            single_free_list.release(node);
+                            return true;
+                        });
+
+        PoolConfig config {PREALLOCATED_MEMORY_MODE, payload_size, num_payloads, num_payloads};
+        std::shared_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        pool->reserve_history(config, false);
+        Measurement sharded = run(threads_count, operations, [&](uint32_t i)
+                        {
+                            SerializedPayload_t payload;
+                            if (!pool->get_payload(payload_size, payload))
+                            {
+                                return false;
+                            }
+                            payload.data[0] = static_cast<octet>(i);
+                            pool->release_payload(payload);
+                            return true;
+                        });
+        pool->release_history(config, false);
+
+        printf("%12u,%15s,%17.1f,%14llu\n", threads_count, "single list", single.operation_ns,
+                static_cast<unsigned long long>(single.operations));
+        printf("%12u,%15s,%17.1f,%14llu\n", threads_count, "sharded", sharded.operation_ns,
+                static_cast<unsigned long long>(sharded.operations));
+
+        if (single.operations != expected || sharded.operations != expected)
+        {
+            printf("Only %llu and %llu operations succeeded instead of %llu\n",
+                    static_cast<unsigned long long>(single.operations),
+                    static_cast<unsigned long long>(sharded.operations),
+                    static_cast<unsigned long long>(expected));
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,397 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceptionBenchmark.cpp
+ *
+ * Measures how the reception throughput of a single participant scales with the number of receive threads.
+ * Each reception path is a reader fed by its own publishing participant through a different channel: the first one
+ * uses shared memory and the rest use UDPv4 unicast on a dedicated port, so every path is served by a different
+ * receive thread of the subscribing participant.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/utils/IPLocator.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+constexpr uint16_t base_port = 17410;
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t payload_size)
+    {
+        setName("ReceptionBenchmarkType");
+        m_typeSize = payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class PathListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        BenchmarkSample sample;
+        SampleInfo info;
+        while (RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data && ++received == expected)
+            {
+                std::lock_guard<std::mutex> guard(*mtx);
+                cv->notify_all();
+            }
+        }
+    }
+
+    std::atomic<uint32_t> received{0};
+    uint32_t expected = 0;
+    std::mutex* mtx = nullptr;
+    std::condition_variable* cv = nullptr;
+};
+
+struct ReceptionPath
+{
+    DomainParticipant* publisher_participant = nullptr;
+    DataWriter* writer = nullptr;
+    DataReader* reader = nullptr;
+    PathListener listener;
+};
+
+DataWriterQos writer_qos()
+{
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_samples = 1000;
+    qos.resource_limits().max_instances = 1;
+    qos.resource_limits().max_samples_per_instance = 1000;
+    return qos;
+}
+
+DataReaderQos reader_qos(
+        size_t path_index)
+{
+    DataReaderQos qos = DATAREADER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    if (0 < path_index)
+    {
+        Locator_t locator;
+        IPLocator::setIPv4(locator, 127, 0, 0, 1);
+        locator.port = static_cast<uint32_t>(base_port + path_index);
+        qos.endpoint().unicast_locator_list.push_back(locator);
+    }
+
+    return qos;
+}
+
+void usage()
+{
+    printf("Usage: ReceptionBenchmark [--paths <n>] [--samples <n>] [--size <bytes>] [--domain <id>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t paths = 4;
+    uint32_t samples = 100000;
+    uint32_t payload_size = 256;
+    uint32_t domain = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--paths")
+        {
+            paths = value;
+        }
+        else if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--size")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == paths || 0 == samples)
+    {
+        usage();
+        return 1;
+    }
+
+    // Every sample has to cross a transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    TypeSupport type(new BenchmarkDataType(payload_size));
+
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == subscriber_participant)
+    {
+        return 1;
+    }
+    type.register_type(subscriber_participant);
+    Subscriber* subscriber = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<ReceptionPath>> reception_paths;
+
+    for (uint32_t i = 0; i < paths; ++i)
+    {
+        reception_paths.emplace_back(new ReceptionPath());
+        ReceptionPath& path = *reception_paths.back();
+        path.listener.mtx = &mtx;
+        path.listener.cv = &cv;
+
+        std::string topic_name = "reception_benchmark_" + std::to_string(i);
+
+        DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+        pqos.transport().use_builtin_transports = false;
+        if (0 == i)
+        {
+            pqos.transport().user_transports.push_back(std::make_shared<SharedMemTransportDescriptor>());
+        }
+        else
+        {
+            pqos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+        }
+
+        path.publisher_participant = factory->create_participant(domain, pqos);
+        if (nullptr == path.publisher_participant)
+        {
+            return 1;
+        }
+        type.register_type(path.publisher_participant);
+
+        Topic* pub_topic = path.publisher_participant->create_topic(topic_name, type.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        Publisher* publisher = path.publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        path.writer = publisher->create_datawriter(pub_topic, writer_qos());
+
+        Topic* sub_topic = subscriber_participant->create_topic(topic_name, type.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        path.reader = subscriber->create_datareader(sub_topic, reader_qos(i), &path.listener);
+
+        if (nullptr == path.writer || nullptr == path.reader)
+        {
+            return 1;
+        }
+    }
+
+    // Wait for discovery
+    for (auto& path : reception_paths)
+    {
+        PublicationMatchedStatus status;
+        do
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            path->writer->get_publication_matched_status(status);
+        } while (status.current_count < 1);
+    }
+
+    printf("[ Paths][     Samples][   Time(ms)][   Samples/sec][ Samples/sec/path]\n");
+
+    for (uint32_t active = 1; active <= paths; ++active)
+    {
+        for (uint32_t i = 0; i < active; ++i)
+        {
+            reception_paths[i]->listener.received = 0;
+            reception_paths[i]->listener.expected = samples;
+        }
+
+        std::vector<std::thread> writers;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < active; ++i)
+        {
+            DataWriter* writer = reception_paths[i]->writer;
+            writers.emplace_back([writer, samples, payload_size]()
+                    {
+                        BenchmarkSample sample;
+                        sample.data.resize(payload_size);
+                        for (uint32_t n = 0; n < samples; ++n)
+                        {
+                            writer->write(&sample);
+                        }
+                    });
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]()
+                    {
+                        for (uint32_t i = 0; i < active; ++i)
+                        {
+                            if (reception_paths[i]->listener.received < samples)
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    });
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        for (auto& thread : writers)
+        {
+            thread.join();
+        }
+
+        double total = static_cast<double>(samples) * active;
+        double rate = total * 1000.0 / elapsed.count();
+        printf("%8u,%13.0f,%12.3f,%15.0f,%18.0f\n", active, total, elapsed.count(), rate, rate / active);
+    }
+
+    for (auto& path : reception_paths)
+    {
+        path->publisher_participant->delete_contained_entities();
+        factory->delete_participant(path->publisher_participant);
+    }
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return 0;
+}
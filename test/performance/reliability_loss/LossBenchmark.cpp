@@ -0,0 +1,339 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LossBenchmark.cpp
+ *
+ * Measures how long a reliable reader takes to receive a burst of samples when the writer loses a percentage of its
+ * DATA messages.
+ * The writer sends through the test UDPv4 transport, which drops the messages, so the reader has to keep track of
+ * every gap its writer proxy sees and ask for it on the ACKNACK answering each heartbeat.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t payload_size)
+    {
+        setName("LossBenchmarkType");
+        m_typeSize = payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class LossListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        BenchmarkSample sample;
+        SampleInfo info;
+        while (RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data && ++received == expected)
+            {
+                std::lock_guard<std::mutex> guard(mtx);
+                cv.notify_all();
+            }
+        }
+    }
+
+    std::atomic<uint32_t> received{0};
+    uint32_t expected = 0;
+    std::mutex mtx;
+    std::condition_variable cv;
+};
+
+DataWriterQos writer_qos(
+        uint32_t window)
+{
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_samples = static_cast<int32_t>(window);
+    qos.resource_limits().max_instances = 1;
+    qos.resource_limits().max_samples_per_instance = static_cast<int32_t>(window);
+    // Gaps are asked for on the ACKNACK answering each heartbeat
+    qos.reliable_writer_qos().times.heartbeatPeriod = eprosima::fastdds::Duration_t(0, 50000000);
+    return qos;
+}
+
+DataReaderQos reader_qos(
+        uint32_t window)
+{
+    DataReaderQos qos = DATAREADER_QOS_DEFAULT;
+    qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_samples = static_cast<int32_t>(window);
+    qos.resource_limits().max_instances = 1;
+    qos.resource_limits().max_samples_per_instance = static_cast<int32_t>(window);
+    return qos;
+}
+
+void usage()
+{
+    printf("Usage: LossBenchmark [--samples <n>] [--window <n>] [--size <bytes>] [--max-loss <percentage>] "
+            "[--domain <id>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t samples = 100000;
+    uint32_t window = 10000;
+    uint32_t payload_size = 256;
+    uint32_t max_loss = 20;
+    uint32_t domain = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--window")
+        {
+            window = value;
+        }
+        else if (arg == "--size")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--max-loss")
+        {
+            max_loss = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == samples || 0 == window || 100 <= max_loss)
+    {
+        usage();
+        return 1;
+    }
+
+    // Every sample has to cross a transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    TypeSupport type(new BenchmarkDataType(payload_size));
+
+    // The test transport keeps a reference to the drop percentage, so it can be changed on every run
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    DomainParticipantQos pub_qos = PARTICIPANT_QOS_DEFAULT;
+    pub_qos.transport().use_builtin_transports = false;
+    pub_qos.transport().user_transports.push_back(test_transport);
+
+    DomainParticipantQos sub_qos = PARTICIPANT_QOS_DEFAULT;
+    sub_qos.transport().use_builtin_transports = false;
+    sub_qos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+
+    DomainParticipant* publisher_participant = factory->create_participant(domain, pub_qos);
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, sub_qos);
+    if (nullptr == publisher_participant || nullptr == subscriber_participant)
+    {
+        return 1;
+    }
+    type.register_type(publisher_participant);
+    type.register_type(subscriber_participant);
+
+    Topic* pub_topic = publisher_participant->create_topic("loss_benchmark", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = subscriber_participant->create_topic("loss_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    DataWriter* writer = publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(
+        pub_topic, writer_qos(window));
+    LossListener listener;
+    DataReader* reader = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(
+        sub_topic, reader_qos(window), &listener);
+    if (nullptr == writer || nullptr == reader)
+    {
+        return 1;
+    }
+
+    // Wait for discovery
+    PublicationMatchedStatus status;
+    do
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        writer->get_publication_matched_status(status);
+    } while (status.current_count < 1);
+
+    printf("Samples: %u, window: %u, payload: %u bytes\n", samples, window, payload_size);
+    printf("[ Loss(%%)][   Time(ms)][   Samples/sec]\n");
+
+    BenchmarkSample sample;
+    sample.data.resize(payload_size);
+    for (uint32_t loss = 0; loss <= max_loss; loss += 5)
+    {
+        test_transport->dropDataMessagesPercentage = static_cast<uint8_t>(loss);
+        listener.received = 0;
+        listener.expected = samples;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t n = 0; n < samples; ++n)
+        {
+            // Blocks while the window is full of samples not acknowledged yet
+            writer->write(&sample);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(listener.mtx);
+            listener.cv.wait(lock, [&]()
+                    {
+                        return listener.received >= samples;
+                    });
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        printf("%10u,%12.3f,%15.0f\n", loss, elapsed.count(), samples * 1000.0 / elapsed.count());
+    }
+
+    publisher_participant->delete_contained_entities();
+    factory->delete_participant(publisher_participant);
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return 0;
+}
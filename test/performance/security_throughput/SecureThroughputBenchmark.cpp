@@ -0,0 +1,250 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SecureThroughputBenchmark.cpp
+ *
+ * Measures the cost of protecting RTPS messages with the builtin AES-GCM-GMAC cryptographic plugin, sending each
+ * message to an increasing number of receivers with origin authentication.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openssl/rand.h>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+
+#include <rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
+#include <rtps/security/common/SharedSecretHandle.h>
+#include <security/cryptography/AESGCMGMAC.h>
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastdds::rtps::security;
+
+namespace {
+
+class SecretFactory;
+using BenchmarkSharedSecretHandle = HandleImpl<SharedSecret, SecretFactory>;
+
+//! Creates the shared secret that an authentication plugin would agree on with the remote participants.
+class SecretFactory
+{
+public:
+
+    static std::shared_ptr<BenchmarkSharedSecretHandle> create()
+    {
+        std::shared_ptr<BenchmarkSharedSecretHandle> secret(new BenchmarkSharedSecretHandle,
+                [](BenchmarkSharedSecretHandle* p)
+                {
+                    delete p;
+                });
+
+        const char* names[] = {"Challenge1", "Challenge2", "SharedSecret"};
+        for (const char* name : names)
+        {
+            std::vector<uint8_t> value(32);
+            RAND_bytes(value.data(), 32);
+            (*secret)->data_.emplace_back(name, value);
+        }
+        return secret;
+    }
+
+};
+
+struct Measurement
+{
+    //! Time to encode a message for all the receivers.
+    double encode_us = 0;
+    //! Time for one of the receivers to decode a message.
+    double decode_us = 0;
+    //! Bytes added to each message by the protection.
+    uint32_t overhead = 0;
+    //! Every message was decoded as it was sent.
+    bool valid = true;
+};
+
+Measurement run(
+        AESGCMGMAC& plugin,
+        uint32_t receivers_count,
+        uint32_t messages_count,
+        uint32_t payload_size)
+{
+    Measurement measurement;
+    SecurityException exception;
+    NilHandle identity;
+    NilHandle permissions;
+    PropertySeq properties;
+
+    ParticipantSecurityAttributes attributes;
+    attributes.is_rtps_protected = true;
+    attributes.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    std::shared_ptr<BenchmarkSharedSecretHandle> secret = SecretFactory::create();
+    CryptoKeyFactory* factory = plugin.cryptokeyfactory();
+    CryptoKeyExchange* exchange = plugin.cryptokeyexchange();
+
+    // Participant A sends to participant B and to the rest of the receivers.
+    std::shared_ptr<ParticipantCryptoHandle> sender =
+            factory->register_local_participant(identity, permissions, properties, attributes, exception);
+    std::shared_ptr<ParticipantCryptoHandle> receiver =
+            factory->register_local_participant(identity, permissions, properties, attributes, exception);
+    if (!sender || !receiver)
+    {
+        measurement.valid = false;
+        return measurement;
+    }
+
+    std::vector<std::shared_ptr<ParticipantCryptoHandle>> receivers;
+    for (uint32_t i = 0; i < receivers_count; ++i)
+    {
+        receivers.push_back(factory->register_matched_remote_participant(*sender, identity, permissions, *secret,
+                exception));
+    }
+    std::shared_ptr<ParticipantCryptoHandle> sender_at_receiver =
+            factory->register_matched_remote_participant(*receiver, identity, permissions, *secret, exception);
+
+    ParticipantCryptoTokenSeq sender_tokens;
+    ParticipantCryptoTokenSeq receiver_tokens;
+    exchange->create_local_participant_crypto_tokens(sender_tokens, *sender, *receivers.front(), exception);
+    exchange->create_local_participant_crypto_tokens(receiver_tokens, *receiver, *sender_at_receiver, exception);
+    exchange->set_remote_participant_crypto_tokens(*sender, *receivers.front(), receiver_tokens, exception);
+    exchange->set_remote_participant_crypto_tokens(*receiver, *sender_at_receiver, sender_tokens, exception);
+
+    CDRMessage_t plain(payload_size);
+    RAND_bytes(plain.buffer, static_cast<int>(payload_size));
+    plain.length = payload_size;
+
+    // Each receiver adds its key id and MAC to the message.
+    const uint32_t encoded_size = payload_size + 128 + 20 * receivers_count;
+    std::vector<CDRMessage_t> encoded;
+    encoded.reserve(messages_count);
+    for (uint32_t i = 0; i < messages_count; ++i)
+    {
+        encoded.emplace_back(encoded_size);
+    }
+    CDRMessage_t decoded(encoded_size);
+
+    auto start = std::chrono::steady_clock::now();
+    for (CDRMessage_t& message : encoded)
+    {
+        plain.pos = 0;
+        measurement.valid &= plugin.cryptotransform()->encode_rtps_message(message, plain, *sender, receivers,
+                        exception);
+    }
+    double encode_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (CDRMessage_t& message : encoded)
+    {
+        message.pos = 0;
+        decoded.pos = 0;
+        decoded.length = 0;
+        measurement.valid &= plugin.cryptotransform()->decode_rtps_message(decoded, message, *receiver,
+                        *sender_at_receiver, exception);
+    }
+    double decode_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    measurement.valid &= decoded.length == plain.length && 0 == memcmp(decoded.buffer, plain.buffer, plain.length);
+    measurement.encode_us = encode_s * 1e6 / messages_count;
+    measurement.decode_us = decode_s * 1e6 / messages_count;
+    measurement.overhead = encoded.front().length - payload_size;
+
+    for (std::shared_ptr<ParticipantCryptoHandle>& remote : receivers)
+    {
+        factory->unregister_participant(remote, exception);
+    }
+    factory->unregister_participant(sender_at_receiver, exception);
+    factory->unregister_participant(sender, exception);
+    factory->unregister_participant(receiver, exception);
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: SecureThroughputBenchmark [--messages <n>] [--payload <bytes>] [--max-receivers <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t messages_count = 2000;
+    uint32_t payload_size = 1024;
+    uint32_t max_receivers = 100;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--messages")
+        {
+            messages_count = value;
+        }
+        else if (arg == "--payload")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--max-receivers")
+        {
+            max_receivers = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == messages_count || 20 > payload_size || 60000 < payload_size || 0 == max_receivers ||
+            1000 < max_receivers)
+    {
+        usage();
+        return 1;
+    }
+
+    AESGCMGMAC plugin;
+
+    printf("Messages: %u, payload: %u bytes\n", messages_count, payload_size);
+    printf("[ Receivers][ Encode(us/msg)][ Encode(us/receiver)][ Decode(us/msg)][ Overhead(bytes)]\n");
+    for (uint32_t receivers_count = 1; receivers_count <= max_receivers; receivers_count *= 10)
+    {
+        Measurement measurement = run(plugin, receivers_count, messages_count, payload_size);
+        printf("%12u,%16.2f,%21.3f,%16.2f,%17u\n", receivers_count, measurement.encode_us,
+                measurement.encode_us / receivers_count, measurement.decode_us, measurement.overhead);
+
+        if (!measurement.valid)
+        {
+            printf("Messages not decoded as sent with %u receivers\n", receivers_count);
+            return 1;
+        }
+    }
+
+    return 0;
+}
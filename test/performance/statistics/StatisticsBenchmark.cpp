@@ -0,0 +1,375 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsBenchmark.cpp
+ *
+ * Measures the overhead of statistics on the data path, comparing several threads writing over UDPv4 with and without
+ * the statistics DataWriters of the network and writer counters enabled.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/statistics/dds/domain/DomainParticipant.hpp>
+#include <fastdds/statistics/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/statistics/topic_names.hpp>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+struct BenchmarkSample
+{
+    std::vector<uint8_t> data;
+};
+
+class BenchmarkDataType : public TopicDataType
+{
+public:
+
+    explicit BenchmarkDataType(
+            uint32_t payload_size)
+    {
+        setName("StatisticsBenchmarkType");
+        m_typeSize = payload_size + 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        return serialize(data, payload, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = static_cast<uint32_t>(sample->data.size());
+        memcpy(payload->data, &size, sizeof(size));
+        memcpy(&payload->data[sizeof(size)], sample->data.data(), size);
+        payload->length = sizeof(size) + size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        uint32_t size = 0;
+        memcpy(&size, payload->data, sizeof(size));
+        sample->data.resize(size);
+        memcpy(sample->data.data(), &payload->data[sizeof(size)], size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return getSerializedSizeProvider(data, DEFAULT_DATA_REPRESENTATION);
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data,
+            DataRepresentationId_t) override
+    {
+        BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+        return [sample]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(sizeof(uint32_t) + sample->data.size());
+               };
+    }
+
+    void* createData() override
+    {
+        return new BenchmarkSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BenchmarkSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+// Statistics updated on every sample written or datagram sent or received
+const char* const statistics_topics[] = {
+    eprosima::fastdds::statistics::RTPS_SENT_TOPIC,
+    eprosima::fastdds::statistics::RTPS_LOST_TOPIC,
+    eprosima::fastdds::statistics::NETWORK_LATENCY_TOPIC,
+    eprosima::fastdds::statistics::PUBLICATION_THROUGHPUT_TOPIC,
+    eprosima::fastdds::statistics::DATA_COUNT_TOPIC
+};
+
+struct Measurement
+{
+    double write_us = 0;
+    double sample_rate = 0;
+    uint64_t failed = 0;
+};
+
+/**
+ * Write @c samples samples from each writer, every one on its own thread.
+ */
+Measurement run(
+        const std::vector<DataWriter*>& writers,
+        uint32_t num_threads,
+        uint32_t samples,
+        uint32_t payload_size)
+{
+    std::atomic<uint64_t> write_ns{0};
+    std::atomic<uint64_t> failed{0};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        DataWriter* writer = writers[t];
+        threads.emplace_back([writer, samples, payload_size, &write_ns, &failed]()
+                {
+                    BenchmarkSample sample;
+                    sample.data.resize(payload_size);
+                    std::chrono::nanoseconds write_time(0);
+                    for (uint32_t n = 0; n < samples; ++n)
+                    {
+                        auto write_start = std::chrono::steady_clock::now();
+                        if (RETCODE_OK != writer->write(&sample))
+                        {
+                            ++failed;
+                        }
+                        write_time += std::chrono::steady_clock::now() - write_start;
+                    }
+                    write_ns += static_cast<uint64_t>(write_time.count());
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    Measurement measurement;
+    uint64_t total = static_cast<uint64_t>(num_threads) * samples;
+    measurement.write_us = static_cast<double>(write_ns) / 1000.0 / static_cast<double>(total);
+    measurement.sample_rate = static_cast<double>(total) / elapsed.count();
+    measurement.failed = failed;
+    return measurement;
+}
+
+bool set_statistics(
+        DomainParticipant* participant,
+        bool enabled)
+{
+    auto statistics_participant = eprosima::fastdds::statistics::dds::DomainParticipant::narrow(participant);
+    if (nullptr == statistics_participant)
+    {
+        return false;
+    }
+
+    for (const char* topic : statistics_topics)
+    {
+        ReturnCode_t ret = enabled ?
+                statistics_participant->enable_statistics_datawriter(topic,
+                        eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS) :
+                statistics_participant->disable_statistics_datawriter(topic);
+        if (RETCODE_OK != ret)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void usage()
+{
+    printf("Usage: StatisticsBenchmark [--max-threads <n>] [--samples <n>] [--size <bytes>] [--domain <id>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 8;
+    uint32_t samples = 10000;
+    uint32_t payload_size = 256;
+    uint32_t domain = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-threads")
+        {
+            max_threads = value;
+        }
+        else if (arg == "--samples")
+        {
+            samples = value;
+        }
+        else if (arg == "--size")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_threads || 0 == samples)
+    {
+        usage();
+        return 1;
+    }
+
+    // Every sample has to cross a transport
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    factory->set_library_settings(settings);
+
+    TypeSupport type(new BenchmarkDataType(payload_size));
+
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    pqos.transport().use_builtin_transports = false;
+    pqos.transport().user_transports.push_back(std::make_shared<UDPv4TransportDescriptor>());
+
+    DomainParticipant* publisher_participant = factory->create_participant(domain, pqos);
+    DomainParticipant* subscriber_participant = factory->create_participant(domain, pqos);
+    if (nullptr == publisher_participant || nullptr == subscriber_participant)
+    {
+        return 1;
+    }
+    type.register_type(publisher_participant);
+    type.register_type(subscriber_participant);
+
+    if (!set_statistics(publisher_participant, true) || !set_statistics(publisher_participant, false))
+    {
+        printf("Statistics are not available. Build Fast DDS with FASTDDS_STATISTICS to run this benchmark.\n");
+        return 0;
+    }
+
+    Topic* pub_topic = publisher_participant->create_topic("statistics_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = subscriber_participant->create_topic("statistics_benchmark", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+    Publisher* publisher = publisher_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = subscriber_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+    rqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    if (nullptr == publisher || nullptr == subscriber || nullptr == subscriber->create_datareader(sub_topic, rqos))
+    {
+        return 1;
+    }
+
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+    wqos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    std::vector<DataWriter*> writers;
+
+    printf("Samples: %u per thread, payload: %u bytes\n", samples, payload_size);
+    printf("[ Threads][ Statistics][ write()(us)][  Samples/sec]\n");
+    for (uint32_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        // Add a writer per thread
+        while (writers.size() < num_threads)
+        {
+            DataWriter* writer = publisher->create_datawriter(pub_topic, wqos);
+            if (nullptr == writer)
+            {
+                return 1;
+            }
+            writers.push_back(writer);
+
+            PublicationMatchedStatus status;
+            do
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                writer->get_publication_matched_status(status);
+            } while (status.current_count < 1);
+        }
+
+        Measurement off = run(writers, num_threads, samples, payload_size);
+        if (!set_statistics(publisher_participant, true))
+        {
+            return 1;
+        }
+        Measurement on = run(writers, num_threads, samples, payload_size);
+        if (!set_statistics(publisher_participant, false))
+        {
+            return 1;
+        }
+
+        printf("%10u,%13s,%13.2f,%14.0f\n", num_threads, "off", off.write_us, off.sample_rate);
+        printf("%10u,%13s,%13.2f,%14.0f\n", num_threads, "on", on.write_us, on.sample_rate);
+        if (0 != off.failed || 0 != on.failed)
+        {
+            printf("%llu writes failed\n", static_cast<unsigned long long>(off.failed + on.failed));
+            return 1;
+        }
+    }
+
+    publisher_participant->delete_contained_entities();
+    factory->delete_participant(publisher_participant);
+    subscriber_participant->delete_contained_entities();
+    factory->delete_participant(subscriber_participant);
+
+    return 0;
+}
@@ -0,0 +1,359 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TCPConnectionsBenchmark.cpp
+ *
+ * Measures how the reception of a TCPv4 transport scales with the number of connections, comparing a reception thread
+ * per connection with connections served by a pool of reactor threads.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif // ifdef __linux__
+
+#include <asio.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastdds/utils/IPLocator.h>
+
+#include <rtps/transport/tcp/RTCPHeader.h>
+#include <rtps/transport/TCPv4Transport.h>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+constexpr uint16_t logical_port = 7410;
+
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    void OnDataReceived(
+            const octet*,
+            const uint32_t,
+            const Locator&,
+            const Locator&) override
+    {
+        ++received;
+    }
+
+    std::atomic<uint64_t> received{0};
+};
+
+struct ProcessUsage
+{
+    uint64_t rss_kb = 0;
+    uint64_t threads = 0;
+};
+
+//! Resident memory and number of threads of the process. Only available on Linux.
+ProcessUsage process_usage()
+{
+    ProcessUsage usage;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 6, "VmRSS:"))
+        {
+            usage.rss_kb = std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+        else if (0 == line.compare(0, 8, "Threads:"))
+        {
+            usage.threads = std::strtoull(line.c_str() + 8, nullptr, 10);
+        }
+    }
+#endif // ifdef __linux__
+    return usage;
+}
+
+//! Maximum number of clients the file descriptors limit allows, as each one takes a descriptor on each side.
+uint32_t max_clients_allowed(
+        uint32_t wanted)
+{
+#ifdef __linux__
+    rlimit limit;
+    if (0 == getrlimit(RLIMIT_NOFILE, &limit))
+    {
+        rlim_t needed = static_cast<rlim_t>(wanted) * 2 + 64;
+        if (limit.rlim_cur < needed)
+        {
+            limit.rlim_cur = std::min(needed, limit.rlim_max);
+            setrlimit(RLIMIT_NOFILE, &limit);
+            getrlimit(RLIMIT_NOFILE, &limit);
+        }
+        if (limit.rlim_cur < needed)
+        {
+            return static_cast<uint32_t>((limit.rlim_cur - 64) / 2);
+        }
+    }
+#endif // ifdef __linux__
+    return wanted;
+}
+
+struct Measurement
+{
+    bool valid = false;
+    int64_t threads = 0;
+    double rss_per_client_kb = 0;
+    double message_rate = 0;
+    double mb_per_sec = 0;
+};
+
+bool wait_for(
+        const CountingReceiver& receiver,
+        uint64_t expected)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (receiver.received < expected)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * Connect @c num_clients clients to a transport, and write @c messages messages from each one of them.
+ */
+Measurement run(
+        uint32_t reactor_threads,
+        uint16_t port,
+        uint32_t num_clients,
+        uint32_t messages,
+        uint32_t payload_size,
+        uint32_t writer_threads)
+{
+    Measurement measurement;
+
+    TCPv4TransportDescriptor descriptor;
+    descriptor.add_listener_port(port);
+    descriptor.check_crc = false;
+    descriptor.reactor_threads = reactor_threads;
+    TCPv4Transport server(descriptor);
+    if (!server.init())
+    {
+        printf("Failed to initialize the transport. Port %u may be in use\n", port);
+        return measurement;
+    }
+
+    Locator input_locator;
+    input_locator.kind = LOCATOR_KIND_TCPv4;
+    input_locator.port = port;
+    IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(input_locator, logical_port);
+
+    CountingReceiver receiver;
+    if (!server.OpenInputChannel(input_locator, &receiver, descriptor.max_message_size()))
+    {
+        return measurement;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Every message is a TCP header followed by its payload
+    TCPHeader header;
+    header.logical_port = logical_port;
+    header.length += payload_size;
+    std::vector<uint8_t> frame(TCPHeader::size() + payload_size, 0);
+    memcpy(frame.data(), header.address(), TCPHeader::size());
+
+    ProcessUsage before = process_usage();
+
+    asio::io_context context;
+    asio::ip::tcp::endpoint destination(asio::ip::address_v4::loopback(), port);
+    std::vector<std::unique_ptr<asio::ip::tcp::socket>> clients;
+    for (uint32_t i = 0; i < num_clients; ++i)
+    {
+        asio::error_code ec;
+        clients.emplace_back(new asio::ip::tcp::socket(context));
+        clients.back()->connect(destination, ec);
+        if (!ec)
+        {
+            asio::write(*clients.back(), asio::buffer(frame), ec);
+        }
+        if (ec)
+        {
+            printf("Client %u failed: %s\n", i, ec.message().c_str());
+            return measurement;
+        }
+    }
+
+    // The first message of every client ensures its connection has been served
+    if (!wait_for(receiver, num_clients))
+    {
+        return measurement;
+    }
+    ProcessUsage connected = process_usage();
+
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < writer_threads; ++t)
+    {
+        threads.emplace_back([t, writer_threads, messages, &clients, &frame]()
+                {
+                    for (uint32_t n = 0; n < messages; ++n)
+                    {
+                        for (size_t c = t; c < clients.size(); c += writer_threads)
+                        {
+                            asio::error_code ec;
+                            asio::write(*clients[c], asio::buffer(frame), ec);
+                        }
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    measurement.valid = wait_for(receiver, static_cast<uint64_t>(num_clients) * (messages + 1));
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    uint64_t total = static_cast<uint64_t>(num_clients) * messages;
+    measurement.threads = static_cast<int64_t>(connected.threads) - static_cast<int64_t>(before.threads);
+    measurement.rss_per_client_kb = (static_cast<double>(connected.rss_kb) - static_cast<double>(before.rss_kb)) /
+            num_clients;
+    measurement.message_rate = static_cast<double>(total) / elapsed.count();
+    measurement.mb_per_sec = measurement.message_rate * frame.size() / (1024.0 * 1024.0);
+
+    for (auto& client : clients)
+    {
+        asio::error_code ec;
+        client->close(ec);
+    }
+    server.CloseInputChannel(input_locator);
+
+    return measurement;
+}
+
+void usage()
+{
+    printf("Usage: TCPConnectionsBenchmark [--max-clients <n>] [--messages <n>] [--size <bytes>]"
+            " [--reactor-threads <n>] [--writer-threads <n>] [--port <port>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_clients = 1000;
+    uint32_t messages = 100;
+    uint32_t payload_size = 256;
+    uint32_t reactor_threads = 4;
+    uint32_t writer_threads = 4;
+    uint32_t port = 7600;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-clients")
+        {
+            max_clients = value;
+        }
+        else if (arg == "--messages")
+        {
+            messages = value;
+        }
+        else if (arg == "--size")
+        {
+            payload_size = value;
+        }
+        else if (arg == "--reactor-threads")
+        {
+            reactor_threads = value;
+        }
+        else if (arg == "--writer-threads")
+        {
+            writer_threads = value;
+        }
+        else if (arg == "--port")
+        {
+            port = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_clients || 0 == reactor_threads || 0 == writer_threads || 0xFFFF <= port)
+    {
+        usage();
+        return 1;
+    }
+
+    uint32_t allowed = max_clients_allowed(max_clients);
+    if (allowed < max_clients)
+    {
+        printf("The file descriptors limit only allows %u clients\n", allowed);
+        max_clients = allowed;
+    }
+
+    eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Kind::Error);
+
+    printf("Messages: %u per client, payload: %u bytes, reactor threads: %u\n", messages, payload_size,
+            reactor_threads);
+    printf("[   Reception][ Clients][ Threads][ RSS/client(KB)][    Msgs/sec][   MB/sec]\n");
+    uint16_t run_port = static_cast<uint16_t>(port);
+    for (uint32_t num_clients = 1; num_clients <= max_clients; num_clients *= 10)
+    {
+        for (uint32_t mode_threads : {0u, reactor_threads})
+        {
+            Measurement measurement = run(mode_threads, run_port++, num_clients, messages, payload_size,
+                            std::min(writer_threads, num_clients));
+            if (!measurement.valid)
+            {
+                printf("Not every message was received with %u clients\n", num_clients);
+                return 1;
+            }
+
+            printf("%13s,%9u,%9lld,%16.1f,%13.0f,%10.1f\n", 0 == mode_threads ? "per-client" : "reactor",
+                    num_clients, static_cast<long long>(measurement.threads), measurement.rss_per_client_kb,
+                    measurement.message_rate, measurement.mb_per_sec);
+        }
+    }
+
+    eprosima::fastdds::dds::Log::Flush();
+    return 0;
+}
@@ -17,6 +17,30 @@ import os
 import subprocess
 
 
+def wait_process(process, name, resource_usage):
+    """
+    Wait for a spawned test process to finish.
+
+    When resource_usage is requested, and the platform supports it, the CPU time and context switches
+    consumed by the process are printed once it finishes.
+    """
+    if resource_usage and hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        print(
+            '{} resource usage: user {:.3f} s, system {:.3f} s, '
+            'voluntary context switches {}, involuntary context switches {}'.format(
+                name,
+                usage.ru_utime,
+                usage.ru_stime,
+                usage.ru_nvcsw,
+                usage.ru_nivcsw),
+            flush=True
+        )
+    else:
+        process.communicate()
+
+
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(
         formatter_class=argparse.ArgumentDefaultsHelpFormatter
@@ -76,6 +100,13 @@ if __name__ == '__main__':
         help='Enable the use of the loan sample API (Defaults: disable)',
         required=False
     )
+    parser.add_argument(
+        '-D',
+        '--dynamic_types',
+        action='store_true',
+        help='Use a DynamicType instead of the generated type (Defaults: disable)',
+        required=False
+    )
     parser.add_argument(
         '-R',
         '--reliability',
@@ -89,6 +120,13 @@ if __name__ == '__main__':
         help='Explicitly enable/disable shared memory transport. (Defaults: Fast DDS default settings)',
         required=False
         )
+    parser.add_argument(
+        '-u',
+        '--resource_usage',
+        action='store_true',
+        help='Print the CPU time and context switches of each process (Defaults: disable)',
+        required=False
+    )
 
     # Parse arguments
     args = parser.parse_args()
@@ -135,6 +173,9 @@ if __name__ == '__main__':
     elif args.data_loans:
         filename_options += '_data_loans'
 
+    if args.dynamic_types:
+        filename_options += '_dynamic_types'
+
     # Demands files options
     demands_options = []
     if args.demands_file:
@@ -159,6 +200,9 @@ if __name__ == '__main__':
     if args.data_loans:
         data_options += ['--data_loans']
 
+    if args.dynamic_types:
+        data_options += ['--dynamic_types']
+
     reliability_options = []
     if args.reliability:
         reliability_options = ['--reliability=reliable']
@@ -273,8 +317,8 @@ if __name__ == '__main__':
         publisher = subprocess.Popen(pub_command)
         subscriber = subprocess.Popen(sub_command)
         # Wait until finish
-        subscriber.communicate()
-        publisher.communicate()
+        wait_process(subscriber, 'Subscriber', args.resource_usage)
+        wait_process(publisher, 'Publisher', args.resource_usage)
 
         if subscriber.returncode != 0:
             exit(subscriber.returncode)
@@ -320,6 +364,6 @@ if __name__ == '__main__':
         # Spawn process
         both = subprocess.Popen(command)
         # Wait until finish
-        both.communicate()
+        wait_process(both, 'Publisher and subscriber', args.resource_usage)
         exit(both.returncode)
     exit(0)
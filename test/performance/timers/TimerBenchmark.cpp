@@ -0,0 +1,260 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerBenchmark.cpp
+ *
+ * Measures the cost of keeping the active timers of ResourceEvent, comparing the vector sorted by trigger time it
+ * keeps by default with the timing wheel selected by the fastdds.timed_events_scheduler participant property.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <rtps/resources/TimingWheel.hpp>
+
+using eprosima::fastdds::rtps::TimingWheel;
+using eprosima::fastdds::rtps::TimingWheelHook;
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+struct BenchmarkTimer
+{
+    clock::time_point next_trigger_time() const
+    {
+        return trigger_time;
+    }
+
+    TimingWheelHook<BenchmarkTimer>& timing_wheel_hook()
+    {
+        return hook;
+    }
+
+    clock::time_point trigger_time;
+    TimingWheelHook<BenchmarkTimer> hook;
+};
+
+bool timer_compare(
+        const BenchmarkTimer* lhs,
+        const BenchmarkTimer* rhs)
+{
+    return lhs->trigger_time < rhs->trigger_time;
+}
+
+/**
+ * Active timers kept as ResourceEvent keeps them by default.
+ */
+class SortedTimers
+{
+public:
+
+    void insert(
+            BenchmarkTimer* timer)
+    {
+        timers_.insert(std::lower_bound(timers_.begin(), timers_.end(), timer, timer_compare), timer);
+    }
+
+    void remove(
+            BenchmarkTimer* timer)
+    {
+        auto it = std::lower_bound(timers_.begin(), timers_.end(), timer, timer_compare);
+        it = std::find(it, timers_.end(), timer);
+        if (it != timers_.end())
+        {
+            timers_.erase(it);
+        }
+    }
+
+    void advance(
+            clock::time_point now,
+            std::vector<BenchmarkTimer*>& expired)
+    {
+        auto it = timers_.begin();
+        while (it != timers_.end() && (*it)->trigger_time <= now)
+        {
+            expired.push_back(*it);
+            ++it;
+        }
+        timers_.erase(timers_.begin(), it);
+    }
+
+    bool empty() const
+    {
+        return timers_.empty();
+    }
+
+private:
+
+    std::vector<BenchmarkTimer*> timers_;
+};
+
+struct Measurement
+{
+    double arm_ns = 0;
+    double rearm_ns = 0;
+    double cancel_ns = 0;
+    double expire_ns = 0;
+};
+
+template<typename Collection>
+Measurement measure(
+        Collection& collection,
+        std::vector<BenchmarkTimer>& timers,
+        const std::vector<clock::duration>& delays,
+        const std::vector<uint32_t>& operations,
+        clock::time_point start_time)
+{
+    Measurement ret;
+
+    auto start = clock::now();
+    for (size_t i = 0; i < timers.size(); ++i)
+    {
+        timers[i].trigger_time = start_time + delays[i];
+        collection.insert(&timers[i]);
+    }
+    ret.arm_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / timers.size();
+
+    // Timers restarted before expiring, as heartbeats and acknack responses are
+    start = clock::now();
+    for (size_t i = 0; i < operations.size(); ++i)
+    {
+        BenchmarkTimer* timer = &timers[operations[i]];
+        collection.remove(timer);
+        timer->trigger_time = start_time + delays[(operations[i] + i) % delays.size()];
+        collection.insert(timer);
+    }
+    ret.rearm_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / operations.size();
+
+    // Timers canceled, as when endpoints are unmatched
+    size_t num_canceled = timers.size() / 2;
+    start = clock::now();
+    for (size_t i = 0; i < num_canceled; ++i)
+    {
+        collection.remove(&timers[i * 2]);
+    }
+    ret.cancel_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / num_canceled;
+
+    // Remaining timers expiring, collected every millisecond as the event thread would wake up
+    std::vector<BenchmarkTimer*> expired;
+    expired.reserve(timers.size());
+    size_t num_expired = 0;
+    clock::time_point now = start_time;
+    start = clock::now();
+    while (!collection.empty())
+    {
+        now += std::chrono::milliseconds(1);
+        collection.advance(now, expired);
+        num_expired += expired.size();
+        expired.clear();
+    }
+    ret.expire_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / num_expired;
+
+    return ret;
+}
+
+void usage()
+{
+    printf("Usage: TimerBenchmark [--max-timers <n>] [--operations <n>] [--max-delay-ms <n>]\n");
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_timers = 100000;
+    uint32_t operations_count = 1000000;
+    uint32_t max_delay_ms = 10000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max-timers")
+        {
+            max_timers = value;
+        }
+        else if (arg == "--operations")
+        {
+            operations_count = value;
+        }
+        else if (arg == "--max-delay-ms")
+        {
+            max_delay_ms = value;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (0 == max_timers || 0 == operations_count || 0 == max_delay_ms)
+    {
+        usage();
+        return 1;
+    }
+
+    std::mt19937_64 generator(42);
+
+    printf("[    Timers][   Collection][   Arm(ns)][ Rearm(ns)][Cancel(ns)][Expire(ns)]\n");
+    for (uint32_t count = 1000; count <= max_timers; count *= 10)
+    {
+        std::uniform_int_distribution<int64_t> delay_distribution(1, int64_t(max_delay_ms) * 1000);
+        std::vector<std::chrono::steady_clock::duration> delays(count);
+        std::generate(delays.begin(), delays.end(), [&]()
+                {
+                    return std::chrono::microseconds(delay_distribution(generator));
+                });
+        std::uniform_int_distribution<uint32_t> index_distribution(0, count - 1);
+        std::vector<uint32_t> operations(operations_count);
+        std::generate(operations.begin(), operations.end(), [&]()
+                {
+                    return index_distribution(generator);
+                });
+
+        {
+            std::vector<BenchmarkTimer> timers(count);
+            SortedTimers sorted;
+            Measurement result = measure(sorted, timers, delays, operations, std::chrono::steady_clock::now());
+            printf("%11u,%14s,%11.1f,%11.1f,%11.1f,%11.1f\n", count, "sorted", result.arm_ns, result.rearm_ns,
+                    result.cancel_ns, result.expire_ns);
+        }
+
+        {
+            std::vector<BenchmarkTimer> timers(count);
+            TimingWheel<BenchmarkTimer> wheel;
+            Measurement result = measure(wheel, timers, delays, operations, std::chrono::steady_clock::now());
+            printf("%11u,%14s,%11.1f,%11.1f,%11.1f,%11.1f\n", count, "timing wheel", result.arm_ns, result.rearm_ns,
+                    result.cancel_ns, result.expire_ns);
+        }
+    }
+
+    return 0;
+}
@@ -15,14 +15,18 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
+#include <fastdds/dds/core/StackAllocatedSequence.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipantListener.hpp>
@@ -36,10 +40,15 @@
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/publisher/DataWriterImpl.hpp>
+#include <fastdds/publisher/filtering/ReaderFilterCollection.hpp>
 
 #include "../../common/CustomPayloadPool.hpp"
 #include "../../logging/mock/MockConsumer.h"
+#include "../topic/DDSSQLFilter/data_types/ContentFilterTestType.hpp"
+#include "../topic/DDSSQLFilter/data_types/ContentFilterTestTypePubSubTypes.h"
+#include "../topic/DDSSQLFilter/data_types/ContentFilterTestTypeTypeObjectSupport.hpp"
 
 namespace eprosima {
 namespace fastdds {
@@ -1603,6 +1612,11 @@ public:
         return &history_;
     }
 
+    DomainParticipantImpl* get_participant_impl()
+    {
+        return publisher_->get_participant_impl();
+    }
+
 };
 
 /**
@@ -2245,6 +2259,157 @@ TEST(DataWriterTests, data_type_is_plain_data_representation)
     DomainParticipantFactory::get_instance()->delete_participant(participant);
 }
 
+/*
+ * Writer-side filters of readers using the same DDS-SQL expression with different parameters share the fields read
+ * from each sample. Check that the results match the evaluation of the filter of each reader on its own, while readers
+ * join, leave, and move between expressions.
+ */
+TEST(DataWriterTests, ReaderFilterCollectionSharedFields)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(nullptr, participant);
+
+    xtypes::TypeIdentifierPair type_ids;
+    register_ContentFilterTestType_type_identifier(type_ids);
+    TypeSupport type(new ContentFilterTestTypePubSubType());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("filtered_topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(nullptr, topic);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, publisher);
+    DataWriter* datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(nullptr, datawriter);
+
+    DataWriterImplTest* datawriter_impl =
+            static_cast<DataWriterImplTest*>(static_cast<DataWriterTest*>(datawriter)->get_impl());
+    DomainParticipantImpl* participant_impl = datawriter_impl->get_participant_impl();
+    IContentFilterFactory* factory = participant_impl->find_content_filter_factory(FASTDDS_SQLFILTER_NAME);
+    ASSERT_NE(nullptr, factory);
+
+    static const std::string expression_a = "int32_field > %0 AND double_field < %1";
+    static const std::string expression_b = "string_field MATCH %0 OR int32_field = %1";
+
+    ResourceLimitedContainerConfig allocation(0, 16, 1);
+    ReaderFilterCollection collection(allocation);
+
+    struct ReaderFilter
+    {
+        std::string expression;
+        std::vector<std::string> parameters;
+    };
+    std::map<fastdds::rtps::GUID_t, ReaderFilter> readers;
+
+    auto reader_guid = [](uint8_t id)
+            {
+                fastdds::rtps::GUID_t guid;
+                guid.guidPrefix.value[0] = 1;
+                guid.entityId.value[2] = id;
+                guid.entityId.value[3] = 0x07;
+                return guid;
+            };
+
+    auto set_filter = [&](const fastdds::rtps::GUID_t& guid, const std::string& expression,
+                    const std::vector<std::string>& parameters)
+            {
+                fastdds::rtps::ContentFilterProperty::AllocationConfiguration filter_allocation;
+                fastdds::rtps::ContentFilterProperty filter_info(filter_allocation);
+                filter_info.content_filtered_topic_name = "filtered_topic_cft";
+                filter_info.related_topic_name = topic->get_name();
+                filter_info.filter_class_name = FASTDDS_SQLFILTER_NAME;
+                filter_info.filter_expression = expression;
+                for (const std::string& parameter : parameters)
+                {
+                    filter_info.expression_parameters.push_back(parameter.c_str());
+                }
+                collection.process_reader_filter_info(guid, filter_info, participant_impl, topic);
+                readers[guid] = {expression, parameters};
+            };
+
+    auto remove_filter = [&](const fastdds::rtps::GUID_t& guid)
+            {
+                collection.remove_reader(guid);
+                readers.erase(guid);
+            };
+
+    auto check_samples = [&]()
+            {
+                ContentFilterTestTypePubSubType pubsub;
+                for (int32_t i = 0; i < 10; ++i)
+                {
+                    ContentFilterTestType data;
+                    data.int32_field(i);
+                    data.double_field(0 == i % 3 ? -1.0 : 1.0);
+                    data.string_field(std::string(1, static_cast<char>('a' + i)));
+
+                    DataWriterFilteredChange change(allocation);
+                    change.kind = fastdds::rtps::ALIVE;
+                    change.writerGUID = datawriter->guid();
+                    change.sequenceNumber = fastdds::rtps::SequenceNumber_t(0, static_cast<uint32_t>(i + 1));
+                    change.serializedPayload.reserve(pubsub.getSerializedSizeProvider(&data)());
+                    ASSERT_TRUE(pubsub.serialize(&data, &change.serializedPayload));
+
+                    collection.update_filter_info(change, fastdds::rtps::SampleIdentity::unknown());
+
+                    // Compare with the filter of each reader evaluated on its own
+                    for (const auto& reader : readers)
+                    {
+                        StackAllocatedSequence<const char*, 10> parameters;
+                        parameters.length(static_cast<LoanableCollection::size_type>(reader.second.parameters.size()));
+                        for (size_t n = 0; n < reader.second.parameters.size(); ++n)
+                        {
+                            parameters[static_cast<LoanableCollection::size_type>(n)] =
+                                    reader.second.parameters[n].c_str();
+                        }
+
+                        IContentFilter* filter = nullptr;
+                        ASSERT_EQ(RETCODE_OK, factory->create_content_filter(FASTDDS_SQLFILTER_NAME,
+                                type.get_type_name().c_str(), type.get(), reader.second.expression.c_str(),
+                                parameters, filter));
+                        IContentFilter::FilterSampleInfo info;
+                        bool expected = filter->evaluate(change.serializedPayload, info, reader.first);
+                        EXPECT_EQ(expected, change.is_relevant_for(reader.first)) << "with i = " << i;
+                        factory->delete_content_filter(FASTDDS_SQLFILTER_NAME, filter);
+                    }
+                }
+            };
+
+    // Three readers share an expression, and a fourth one uses another
+    set_filter(reader_guid(1), expression_a, {"2", "0"});
+    set_filter(reader_guid(2), expression_a, {"5", "2"});
+    set_filter(reader_guid(3), expression_a, {"-1", "0.5"});
+    set_filter(reader_guid(4), expression_b, {"'[a-c]'", "7"});
+    check_samples();
+
+    // The reader reading the fields for the group moves to the other expression
+    set_filter(reader_guid(1), expression_b, {"'[d-f]'", "9"});
+    check_samples();
+
+    // A reader only changes its parameters, staying in its group
+    set_filter(reader_guid(2), expression_a, {"0", "2"});
+    check_samples();
+
+    // Readers of the first expression leave, and a new one starts a group with it
+    remove_filter(reader_guid(2));
+    remove_filter(reader_guid(3));
+    check_samples();
+    set_filter(reader_guid(5), expression_a, {"3", "2"});
+    check_samples();
+
+    // A reader moves back to the first expression, joining the new group
+    set_filter(reader_guid(1), expression_a, {"1", "0"});
+    check_samples();
+
+    remove_filter(reader_guid(1));
+    remove_filter(reader_guid(4));
+    remove_filter(reader_guid(5));
+    EXPECT_TRUE(collection.empty());
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
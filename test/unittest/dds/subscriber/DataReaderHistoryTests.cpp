@@ -267,6 +267,56 @@ TEST(DataReaderHistory, exclusive_ownership_keyed_sample_reception)
     ASSERT_EQ(18u, history.getHistorySize());
 }
 
+/*!
+ * \test Tests that keyed instances are limited by max_instances and that available instances are visited in handle
+ * order, regardless of the order in which they were received.
+ */
+TEST(DataReaderHistory, keyed_instances_limit_and_order)
+{
+    TestType* type_ = new TestType();
+    // These functions was called due to the type is keyed.
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = 4;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastdds::RecursiveTimedMutex mutex;
+    eprosima::fastdds::rtps::StatelessReader reader(&history, &mutex);
+
+    // Receive one sample for each instance, in reverse handle order
+    eprosima::fastdds::rtps::CacheChange_t changes[5];
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        changes[i].writerGUID = {{}, 1};
+        changes[i].sequenceNumber = {0, i + 1};
+        changes[i].instanceHandle = eprosima::fastdds::rtps::GUID_t{{}, 5 - i};
+    }
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(history.received_change(&changes[i], 0));
+    }
+
+    SampleRejectedStatusKind rejection_reason = NOT_REJECTED;
+    ASSERT_FALSE(history.received_change(&changes[4], 0, rejection_reason));
+    ASSERT_EQ(REJECTED_BY_INSTANCES_LIMIT, rejection_reason);
+
+    InstanceHandle_t handle;
+    for (uint32_t expected = 2; expected <= 5; ++expected)
+    {
+        auto result = history.lookup_available_instance(handle, false);
+        ASSERT_TRUE(result.first);
+        handle = result.second->first;
+        ASSERT_EQ(InstanceHandle_t(eprosima::fastdds::rtps::GUID_t{{}, expected}), handle);
+    }
+    ASSERT_FALSE(history.lookup_available_instance(handle, false).first);
+}
+
 int main(
         int argc,
         char** argv)
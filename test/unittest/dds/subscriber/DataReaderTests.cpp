@@ -1327,6 +1327,85 @@ TEST_F(DataReaderTests, resource_limits)
     }
 }
 
+/*
+ * This test checks that loaned samples remain valid until their own loan is returned, regardless of the order in which
+ * loans are returned, and when the same samples are loaned by several reads at the same time.
+ */
+TEST_F(DataReaderTests, return_loans_out_of_order)
+{
+    static constexpr int32_t num_samples = 100;
+    static constexpr int32_t num_reads = 4;
+    static constexpr int32_t samples_per_read = num_samples / num_reads;
+
+    const ReturnCode_t& ok_code = RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_samples = LENGTH_UNLIMITED;
+    reader_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+    reader_qos.reader_resource_limits().max_samples_per_read = num_samples;
+
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    for (int32_t i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = static_cast<char>(i);
+        EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+    }
+
+    FooSeq read_seq;
+    SampleInfoSeq read_infos;
+    EXPECT_TRUE(data_reader_->wait_for_unread_message({ 10, 0 }));
+    EXPECT_EQ(ok_code, data_reader_->read(read_seq, read_infos));
+    while (read_seq.length() != num_samples)
+    {
+        EXPECT_EQ(ok_code, data_reader_->return_loan(read_seq, read_infos));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        EXPECT_EQ(ok_code, data_reader_->read(read_seq, read_infos));
+    }
+
+    // Take the same samples on several reads, while the read above keeps them loaned
+    FooSeq data_seqs[num_reads];
+    SampleInfoSeq info_seqs[num_reads];
+    for (int32_t i = 0; i < num_reads; ++i)
+    {
+        EXPECT_EQ(ok_code, data_reader_->take(data_seqs[i], info_seqs[i], samples_per_read));
+        check_collection(data_seqs[i], false, samples_per_read, samples_per_read);
+        check_collection(info_seqs[i], false, samples_per_read, samples_per_read);
+    }
+
+    auto check_values = [](const FooSeq& seq, int32_t first)
+            {
+                for (FooSeq::size_type n = 0; n < seq.length(); ++n)
+                {
+                    EXPECT_EQ(static_cast<char>(first + n), seq[n].message()[0]);
+                }
+            };
+
+    // Returning the first loan should keep the samples of the others
+    check_values(read_seq, 0);
+    EXPECT_EQ(ok_code, data_reader_->return_loan(read_seq, read_infos));
+
+    const int32_t return_order[num_reads] = { 2, 0, 3, 1 };
+    for (int32_t i : return_order)
+    {
+        check_values(data_seqs[i], i * samples_per_read);
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seqs[i], info_seqs[i]));
+        check_collection(data_seqs[i], true, 0, 0);
+        check_collection(info_seqs[i], true, 0, 0);
+    }
+}
+
 void check_sample_values(
         const FooSeq& data,
         const std::string& values)
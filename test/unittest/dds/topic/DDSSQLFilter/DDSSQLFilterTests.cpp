@@ -24,6 +24,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp"
 #include "fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp"
 
 #include "fastdds/dds/core/StackAllocatedSequence.hpp"
@@ -1241,6 +1242,97 @@ TEST_F(DDSSQLFilterValueTests, test_update_params)
     EXPECT_EQ(RETCODE_OK, ret);
 }
 
+/*
+ * Fields serialized before any variable-size member are read directly from the payload.
+ * Check that both encodings give the same results as the full deserialization.
+ */
+TEST_F(DDSSQLFilterValueTests, test_compiled_data_representations)
+{
+    static const std::string expression = "int32_field > 2 AND double_field < 0";
+
+    IContentFilter* filter = nullptr;
+    auto ret = create_content_filter(uut, expression, {}, &type_support, filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+    ASSERT_NE(nullptr, filter);
+
+    for (DataRepresentationId_t representation : {XCDR_DATA_REPRESENTATION, XCDR2_DATA_REPRESENTATION})
+    {
+        for (int32_t i = 0; i < 6; ++i)
+        {
+            ContentFilterTestType data;
+            data.int32_field(i);
+            data.double_field(0 == i % 2 ? 1.0 : -1.0);
+            data.string_field("not fixed size");
+
+            IContentFilter::SerializedPayload payload(type_support.getSerializedSizeProvider(&data, representation)());
+            ASSERT_TRUE(type_support.serialize(&data, &payload, representation));
+
+            IContentFilter::FilterSampleInfo info;
+            IContentFilter::GUID_t guid;
+            EXPECT_EQ(i > 2 && 0 != i % 2, filter->evaluate(payload, info, guid)) << "with i = " << i;
+        }
+    }
+
+    ret = uut.delete_content_filter("DDSSQL", filter);
+    EXPECT_EQ(RETCODE_OK, ret);
+}
+
+/*
+ * Expressions only differing on the parameters can be evaluated on the fields read by one of them.
+ * Check that the results are the same as evaluating each expression on its own.
+ */
+TEST_F(DDSSQLFilterValueTests, test_shared_fields)
+{
+    static const std::string expression =
+            "int16_field > %0 OR string_field MATCH %1 OR struct_field.float_field < %2";
+    static const std::vector<std::vector<std::string>> parameters =
+    {
+        {"0", "'BBB'", "-3.14159"},
+        {"-100", "'Z..'", "0"},
+        {"32767", "''", "3.14159"},
+        {"-32768", "'.*'", "-3.14159"}
+    };
+
+    std::vector<IContentFilter*> filters;
+    for (const std::vector<std::string>& params : parameters)
+    {
+        IContentFilter* filter = nullptr;
+        auto ret = create_content_filter(uut, expression, params, &type_support, filter);
+        EXPECT_EQ(RETCODE_OK, ret);
+        ASSERT_NE(nullptr, filter);
+        filters.push_back(filter);
+    }
+
+    const auto& values = DDSSQLFilterValueGlobalData::values();
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        IContentFilter::FilterSampleInfo info;
+        IContentFilter::GUID_t guid;
+
+        std::vector<bool> expected;
+        for (IContentFilter* filter : filters)
+        {
+            expected.push_back(filter->evaluate(*values[i], info, guid));
+        }
+
+        // The first expression reads all the fields, and the rest use them
+        auto source = static_cast<DDSSQLFilter::DDSFilterExpression*>(filters[0]);
+        bool result = false;
+        ASSERT_TRUE(source->evaluate_all_fields(*values[i], result));
+        EXPECT_EQ(expected[0], result) << "with i = " << i;
+        for (size_t j = 1; j < filters.size(); ++j)
+        {
+            auto filter = static_cast<DDSSQLFilter::DDSFilterExpression*>(filters[j]);
+            EXPECT_EQ(expected[j], filter->evaluate_with_fields_of(*source)) << "with i = " << i << ", j = " << j;
+        }
+    }
+
+    for (IContentFilter* filter : filters)
+    {
+        EXPECT_EQ(RETCODE_OK, uut.delete_content_filter("DDSSQL", filter));
+    }
+}
+
 static void add_test_filtered_value_inputs(
         const std::string& test_prefix,
         const std::string& field_name,
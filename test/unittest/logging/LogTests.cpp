@@ -20,7 +20,9 @@
 #include "mock/MockConsumer.h"
 #include <gtest/gtest.h>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <chrono>
 #include <sstream>
@@ -88,6 +90,40 @@ protected:
     std::atomic<unsigned int>& logs_consumed_;
 };
 
+class BlockingConsumerMock : public LogConsumerMock
+{
+public:
+
+    BlockingConsumerMock(
+            std::atomic<unsigned int>& consumed_reference,
+            std::mutex& mutex,
+            std::condition_variable& cv,
+            bool& released)
+        : LogConsumerMock(consumed_reference)
+        , mutex_(mutex)
+        , cv_(cv)
+        , released_(released)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]()
+                {
+                    return released_;
+                });
+        LogConsumerMock::Consume(entry);
+    }
+
+private:
+
+    std::mutex& mutex_;
+    std::condition_variable& cv_;
+    bool& released_;
+};
+
 TEST_F(LogTests, asynchronous_logging)
 {
     EPROSIMA_LOG_ERROR(SampleCategory, "Sample error message");
@@ -663,6 +699,67 @@ TEST_F(LogTests, flush_n)
     loggind_thread.join();
 }
 
+/**
+ * This test checks the policies applied when the queue of pending entries is full, logging much more entries than the
+ * queue can hold while the consumer is blocked.
+ * With Log::Drop every entry is either consumed or counted as dropped, and with Log::Block none is dropped.
+ */
+TEST_F(LogTests, queue_full_policy)
+{
+    const unsigned int n_logs = 10000;
+
+    for (Log::QueueFullPolicy policy : {Log::Drop, Log::Block})
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool released = false;
+        std::atomic<unsigned int> logs_consumed(0);
+
+        Log::ClearConsumers();
+        Log::RegisterConsumer(std::unique_ptr<LogConsumer>(
+                    new BlockingConsumerMock(logs_consumed, mutex, cv, released)));
+        Log::SetQueueFullPolicy(policy);
+        uint64_t dropped_before = Log::GetDroppedEntries();
+
+        std::thread logging_thread([n_logs]()
+                {
+                    for (unsigned int i = 0; i < n_logs; i++)
+                    {
+                        EPROSIMA_LOG_WARNING(TEST_QUEUE_FULL, "Message " << i);
+                    }
+                });
+
+        if (Log::Drop == policy)
+        {
+            // Entries are dropped instead of waiting for the blocked consumer
+            logging_thread.join();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+        }
+        cv.notify_all();
+
+        if (Log::Block == policy)
+        {
+            logging_thread.join();
+        }
+        Log::Flush();
+
+        uint64_t dropped = Log::GetDroppedEntries() - dropped_before;
+        EXPECT_EQ(n_logs, logs_consumed.load() + dropped);
+        if (Log::Drop == policy)
+        {
+            EXPECT_LT(0u, dropped);
+        }
+        else
+        {
+            EXPECT_EQ(0u, dropped);
+        }
+    }
+}
+
 /**
  * The goal of this test is to be able to manually check that the thread settings are applied, using an external
  * tool like `htop` in Linux.
@@ -0,0 +1,400 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // ifndef _WIN32
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <fastdds/rtps/common/Guid.h>
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantsAckStatus.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+class DiscoveryJournalTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        file_name_ = std::string("DiscoveryJournalTests_") +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".db";
+        std::remove(file_name_.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(file_name_.c_str());
+        std::remove((file_name_ + ".tmp").c_str());
+    }
+
+    static GuidPrefix_t prefix(
+            octet id)
+    {
+        GuidPrefix_t guid_prefix;
+        guid_prefix.value[0] = 0x01;
+        guid_prefix.value[11] = id;
+        return guid_prefix;
+    }
+
+    //! Fill a change announcing entity, with a payload of size bytes whose content depends on its sequence number
+    static void fill_change(
+            CacheChange_t& change,
+            const GUID_t& entity,
+            int32_t sequence_number,
+            ChangeKind_t kind = ALIVE)
+    {
+        change.kind = kind;
+        change.writerGUID = GUID_t(entity.guidPrefix, c_EntityId_SPDPWriter);
+        change.instanceHandle = entity;
+        change.sequenceNumber = SequenceNumber_t(0, sequence_number);
+        change.sourceTimestamp = Time_t(sequence_number, 0u);
+        change.reader_info.receptionTimestamp = Time_t(sequence_number, 10u);
+        change.write_params.sample_identity(SampleIdentity());
+        change.write_params.sample_identity().writer_guid(change.writerGUID);
+        change.write_params.sample_identity().sequence_number(change.sequenceNumber);
+        change.serializedPayload.encapsulation = PL_CDR_LE;
+        change.serializedPayload.length = change.serializedPayload.max_size;
+        for (uint32_t i = 0; i < change.serializedPayload.length; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(sequence_number + i);
+        }
+    }
+
+    void append_participant(
+            DiscoveryJournal& journal,
+            octet id,
+            int32_t sequence_number,
+            ChangeKind_t kind = ALIVE)
+    {
+        CacheChange_t change(payload_size);
+        fill_change(change, GUID_t(prefix(id), c_EntityId_RTPSParticipant), sequence_number, kind);
+        journal.append(change, DiscoveryParticipantChangeData(RemoteLocatorList(0, 0), false, false));
+    }
+
+    void append_writer(
+            DiscoveryJournal& journal,
+            octet participant_id,
+            int32_t sequence_number)
+    {
+        CacheChange_t change(payload_size);
+        fill_change(change, GUID_t(prefix(participant_id), EntityId_t(0x103)), sequence_number);
+        journal.append(DiscoveryJournalEntity::WRITER, change, "topic");
+    }
+
+    std::size_t file_size() const
+    {
+        std::ifstream file(file_name_, std::ios_base::binary | std::ios_base::ate);
+        return static_cast<std::size_t>(file.tellg());
+    }
+
+    void write_file(
+            const std::vector<octet>& contents) const
+    {
+        std::ofstream file(file_name_, std::ios_base::binary | std::ios_base::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+    }
+
+    std::vector<octet> read_file() const
+    {
+        std::ifstream file(file_name_, std::ios_base::binary);
+        return std::vector<octet>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    static constexpr uint32_t payload_size = 32;
+
+    std::string file_name_;
+};
+
+constexpr uint32_t DiscoveryJournalTests::payload_size;
+
+//! Every field of the records is read as it was serialized, including the acknowledgement status of snapshots
+TEST_F(DiscoveryJournalTests, serialize_and_read)
+{
+    Locator_t unicast(LOCATOR_KIND_UDPv4, 7410);
+    unicast.address[15] = 1;
+    Locator_t multicast(LOCATOR_KIND_UDPv4, 7400);
+    multicast.address[12] = 239;
+    RemoteLocatorList locators(1, 1);
+    locators.add_unicast_locator(unicast);
+    locators.add_multicast_locator(multicast);
+
+    DiscoveryParticipantsAckStatus ack_status;
+    ack_status.add_or_update_participant(prefix(1), true);
+    ack_status.add_or_update_participant(prefix(2), false);
+
+    CacheChange_t participant(payload_size);
+    fill_change(participant, GUID_t(prefix(1), c_EntityId_RTPSParticipant), 5);
+    CacheChange_t reader(payload_size);
+    fill_change(reader, GUID_t(prefix(1), EntityId_t(0x104)), 6);
+
+    std::vector<octet> snapshot;
+    DiscoveryJournal::serialize_participant(snapshot, participant, DiscoveryParticipantChangeData(locators, true,
+            true), &ack_status);
+
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    ASSERT_TRUE(journal.compact(snapshot));
+    journal.append(DiscoveryJournalEntity::READER, reader, "reader_topic");
+    journal.close();
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    ASSERT_EQ(2u, records.size());
+
+    const DiscoveryJournalRecord& participant_record = records[0];
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, participant_record.entity);
+    EXPECT_EQ(ALIVE, participant_record.kind);
+    EXPECT_EQ(participant.writerGUID, participant_record.writer_guid);
+    EXPECT_EQ(participant.instanceHandle, participant_record.instance_handle);
+    EXPECT_EQ(participant.sequenceNumber, participant_record.sequence_number);
+    EXPECT_EQ(participant.sourceTimestamp, participant_record.source_timestamp);
+    EXPECT_EQ(participant.reader_info.receptionTimestamp, participant_record.reception_timestamp);
+    EXPECT_EQ(participant.write_params.sample_identity(), participant_record.sample_identity);
+    EXPECT_EQ(PL_CDR_LE, participant_record.encapsulation);
+    ASSERT_EQ(payload_size, participant_record.payload_length);
+    EXPECT_EQ(0, memcmp(participant.serializedPayload.data, participant_record.payload, payload_size));
+    EXPECT_TRUE(participant_record.is_client);
+    EXPECT_TRUE(participant_record.is_local);
+    ASSERT_EQ(1u, participant_record.metatraffic_locators.unicast.size());
+    EXPECT_EQ(unicast, participant_record.metatraffic_locators.unicast[0]);
+    ASSERT_EQ(1u, participant_record.metatraffic_locators.multicast.size());
+    EXPECT_EQ(multicast, participant_record.metatraffic_locators.multicast[0]);
+    ASSERT_EQ(2u, participant_record.ack_status.size());
+    EXPECT_EQ(prefix(1), participant_record.ack_status[0].first);
+    EXPECT_TRUE(participant_record.ack_status[0].second);
+    EXPECT_EQ(prefix(2), participant_record.ack_status[1].first);
+    EXPECT_FALSE(participant_record.ack_status[1].second);
+
+    const DiscoveryJournalRecord& reader_record = records[1];
+    EXPECT_EQ(DiscoveryJournalEntity::READER, reader_record.entity);
+    EXPECT_EQ(reader.instanceHandle, reader_record.instance_handle);
+    EXPECT_EQ("reader_topic", reader_record.topic);
+    EXPECT_TRUE(reader_record.ack_status.empty());
+
+    // The change is restored as it was received
+    CacheChange_t restored(payload_size);
+    reader_record.to_change(restored);
+    EXPECT_EQ(reader.kind, restored.kind);
+    EXPECT_EQ(reader.writerGUID, restored.writerGUID);
+    EXPECT_EQ(reader.sequenceNumber, restored.sequenceNumber);
+    EXPECT_EQ(reader.write_params.sample_identity(), restored.write_params.sample_identity());
+    ASSERT_EQ(reader.serializedPayload.length, restored.serializedPayload.length);
+    EXPECT_EQ(0, memcmp(reader.serializedPayload.data, restored.serializedPayload.data, payload_size));
+}
+
+//! A last record cut in the middle of a write is discarded, keeping the previous ones
+TEST_F(DiscoveryJournalTests, truncated_last_record)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    journal.close();
+    std::size_t first_record_end = file_size();
+
+    // Records are appended to the existing journal
+    ASSERT_TRUE(journal.open(file_name_));
+    append_writer(journal, 1, 2);
+    journal.close();
+
+    std::vector<octet> contents = read_file();
+    contents.resize(contents.size() - 3);
+    write_file(contents);
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[0].entity);
+
+    // Part of a record header is discarded too
+    contents.resize(first_record_end + 4);
+    write_file(contents);
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    EXPECT_EQ(1u, records.size());
+}
+
+//! A last record whose body does not match its checksum is discarded, keeping the previous ones
+TEST_F(DiscoveryJournalTests, bad_checksum)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    append_writer(journal, 1, 2);
+    journal.close();
+
+    std::vector<octet> contents = read_file();
+    contents.back() ^= 0xFF;
+    write_file(contents);
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[0].entity);
+
+    // A file which is not a journal is not read at all
+    contents[0] = 'X';
+    write_file(contents);
+    EXPECT_FALSE(DiscoveryJournal::read(file_name_, buffer, records));
+}
+
+//! Only the last record of each entity is kept, unless it is an older change from the same writer
+TEST_F(DiscoveryJournalTests, last_record_per_entity)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    append_writer(journal, 1, 2);
+    append_participant(journal, 2, 3);
+    append_writer(journal, 1, 5);
+    append_writer(journal, 1, 4);
+    append_participant(journal, 1, 6);
+    journal.close();
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+
+    // Records keep the position where each entity was first found
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[0].entity);
+    EXPECT_EQ(SequenceNumber_t(0, 6), records[0].sequence_number);
+    EXPECT_EQ(DiscoveryJournalEntity::WRITER, records[1].entity);
+    EXPECT_EQ(SequenceNumber_t(0, 5), records[1].sequence_number);
+    EXPECT_EQ(static_cast<octet>(5), records[1].payload[0]);
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[2].entity);
+    EXPECT_EQ(SequenceNumber_t(0, 3), records[2].sequence_number);
+}
+
+//! The endpoints of participants that are disposed, or that were never stored, are dropped
+TEST_F(DiscoveryJournalTests, endpoints_of_dead_participants)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    append_participant(journal, 2, 2);
+    append_writer(journal, 1, 3);
+    append_writer(journal, 2, 4);
+    append_writer(journal, 3, 5);
+    append_participant(journal, 2, 6, NOT_ALIVE_DISPOSED_UNREGISTERED);
+    journal.close();
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+
+    // The disposed participant is kept, so the database can announce it is gone
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[0].entity);
+    EXPECT_EQ(prefix(1), iHandle2GUID(records[0].instance_handle).guidPrefix);
+    EXPECT_EQ(DiscoveryJournalEntity::PARTICIPANT, records[1].entity);
+    EXPECT_EQ(NOT_ALIVE_DISPOSED_UNREGISTERED, records[1].kind);
+    EXPECT_EQ(DiscoveryJournalEntity::WRITER, records[2].entity);
+    EXPECT_EQ(prefix(1), iHandle2GUID(records[2].instance_handle).guidPrefix);
+}
+
+//! Compacting replaces every record with the snapshot, and later records are appended after it
+TEST_F(DiscoveryJournalTests, compact)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    append_participant(journal, 2, 2);
+    journal.sync();
+
+    CacheChange_t participant(payload_size);
+    fill_change(participant, GUID_t(prefix(3), c_EntityId_RTPSParticipant), 3);
+    std::vector<octet> snapshot;
+    DiscoveryJournal::serialize_participant(snapshot, participant, DiscoveryParticipantChangeData());
+    ASSERT_TRUE(journal.compact(snapshot));
+    append_writer(journal, 3, 4);
+    journal.close();
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(prefix(3), iHandle2GUID(records[0].instance_handle).guidPrefix);
+    EXPECT_EQ(DiscoveryJournalEntity::WRITER, records[1].entity);
+    EXPECT_FALSE(std::ifstream(file_name_ + ".tmp").is_open());
+}
+
+#ifndef _WIN32
+//! A journal that cannot be replaced by the snapshot is kept, together with the records pending to be written
+TEST_F(DiscoveryJournalTests, compact_replace_failure)
+{
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name_));
+    append_participant(journal, 1, 1);
+    journal.sync();
+    append_participant(journal, 3, 3);
+
+    // A non empty directory cannot be replaced by a file. The open journal is moved aside, so it is still written
+    std::string dir_entry = file_name_ + "/entry";
+    ASSERT_EQ(0, std::rename(file_name_.c_str(), (file_name_ + ".old").c_str()));
+    ASSERT_EQ(0, mkdir(file_name_.c_str(), 0700));
+    std::ofstream(dir_entry).put('x');
+
+    std::vector<octet> snapshot;
+    CacheChange_t participant(payload_size);
+    fill_change(participant, GUID_t(prefix(2), c_EntityId_RTPSParticipant), 2);
+    DiscoveryJournal::serialize_participant(snapshot, participant, DiscoveryParticipantChangeData());
+    EXPECT_FALSE(journal.compact(snapshot));
+    EXPECT_TRUE(journal.is_open());
+    EXPECT_FALSE(std::ifstream(file_name_ + ".tmp").is_open());
+    journal.close();
+
+    std::remove(dir_entry.c_str());
+    rmdir(file_name_.c_str());
+    ASSERT_EQ(0, std::rename((file_name_ + ".old").c_str(), file_name_.c_str()));
+
+    std::vector<octet> buffer;
+    std::vector<DiscoveryJournalRecord> records;
+    ASSERT_TRUE(DiscoveryJournal::read(file_name_, buffer, records));
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(prefix(1), iHandle2GUID(records[0].instance_handle).guidPrefix);
+    EXPECT_EQ(prefix(3), iHandle2GUID(records[1].instance_handle).guidPrefix);
+}
+#endif // ifndef _WIN32
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
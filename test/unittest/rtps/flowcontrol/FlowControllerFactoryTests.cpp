@@ -158,6 +158,65 @@ TEST(FlowControllerFactory, register_flow_controllers)
             FlowControllerPriorityWithReservationSchedule>* async_limited_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                     FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
     ASSERT_TRUE(nullptr != async_limited_reserv_flow);
+
+    flow_controller_descr.max_burst_bytes = 1;
+    flow_controller_descr.sender_threads = 2;
+
+    // AsyncTokenBucketFlowController with Fifo scheduler
+    const char* async_token_bucket_fifo = "AsyncTokenBucketFlowControllerFifo";
+    flow_controller_descr.name = async_token_bucket_fifo;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::FIFO;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_token_bucket_fifo, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerFifoSchedule>* async_token_bucket_fifo_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerFifoSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_token_bucket_fifo_flow);
+
+    const char* async_token_bucket_robin = "AsyncTokenBucketFlowControllerRobin";
+    flow_controller_descr.name = async_token_bucket_robin;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_token_bucket_robin, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerRoundRobinSchedule>* async_token_bucket_robin_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerRoundRobinSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_token_bucket_robin_flow);
+
+    // Priority schedulers are rejected with several sender threads.
+    const char* async_token_bucket_high_threads = "AsyncTokenBucketFlowControllerHighThreads";
+    flow_controller_descr.name = async_token_bucket_high_threads;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    factory.register_flow_controller(flow_controller_descr);
+    ASSERT_EQ(nullptr, factory.retrieve_flow_controller(async_token_bucket_high_threads, writer_attributes));
+
+    const char* async_token_bucket_reserv_threads = "AsyncTokenBucketFlowControllerReservationThreads";
+    flow_controller_descr.name = async_token_bucket_reserv_threads;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    factory.register_flow_controller(flow_controller_descr);
+    ASSERT_EQ(nullptr, factory.retrieve_flow_controller(async_token_bucket_reserv_threads, writer_attributes));
+
+    flow_controller_descr.sender_threads = 1;
+
+    const char* async_token_bucket_high = "AsyncTokenBucketFlowControllerHigh";
+    flow_controller_descr.name = async_token_bucket_high;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_token_bucket_high, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerHighPrioritySchedule>* async_token_bucket_high_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerHighPrioritySchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_token_bucket_high_flow);
+
+    const char* async_token_bucket_reserv = "AsyncTokenBucketFlowControllerReservation";
+    flow_controller_descr.name = async_token_bucket_reserv;
+    flow_controller_descr.scheduler = FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    factory.register_flow_controller(flow_controller_descr);
+    flow_controller = factory.retrieve_flow_controller(async_token_bucket_reserv, writer_attributes);
+    FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+            FlowControllerPriorityWithReservationSchedule>* async_token_bucket_reserv_flow = dynamic_cast<FlowControllerImpl<FlowControllerTokenBucketPublishMode,
+                    FlowControllerPriorityWithReservationSchedule>*>(flow_controller);
+    ASSERT_TRUE(nullptr != async_token_bucket_reserv_flow);
 }
 
 int main(
@@ -0,0 +1,314 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlowControllerPublishModesTests.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace testing;
+
+struct FlowControllerTokenBucketPublishModeMock : FlowControllerTokenBucketPublishMode
+{
+    FlowControllerTokenBucketPublishModeMock(
+            eprosima::fastdds::rtps::RTPSParticipantImpl* participant,
+            const FlowControllerDescriptor* descriptor)
+        : FlowControllerTokenBucketPublishMode(participant, descriptor)
+    {
+        group_mock = &group;
+        groups_mock.push_back(&group);
+    }
+
+    static eprosima::fastdds::rtps::RTPSMessageGroup* get_group()
+    {
+        return group_mock;
+    }
+
+    //! Groups of all the mocks, one for each sender thread of the flow controller.
+    static std::vector<eprosima::fastdds::rtps::RTPSMessageGroup*>& get_groups()
+    {
+        return groups_mock;
+    }
+
+    static eprosima::fastdds::rtps::RTPSMessageGroup* group_mock;
+
+    static std::vector<eprosima::fastdds::rtps::RTPSMessageGroup*> groups_mock;
+};
+eprosima::fastdds::rtps::RTPSMessageGroup* FlowControllerTokenBucketPublishModeMock::group_mock = nullptr;
+std::vector<eprosima::fastdds::rtps::RTPSMessageGroup*> FlowControllerTokenBucketPublishModeMock::groups_mock;
+
+TYPED_TEST(FlowControllerPublishModes, token_bucket_publish_mode)
+{
+    // Two samples fit in the bucket, which is refilled with one sample each 10ms.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.max_burst_bytes = 20400;
+    FlowControllerImpl<FlowControllerTokenBucketPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastdds::rtps::RTPSWriter writer1;
+
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+    EXPECT_CALL(*FlowControllerTokenBucketPublishModeMock::get_group(),
+            reset_current_bytes_processed()).WillRepeatedly([&]()
+            {
+                this->current_bytes_processed = 0;
+            });
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastdds::rtps::CacheChange_t* change,
+        eprosima::fastdds::rtps::RTPSMessageGroup&,
+        eprosima::fastdds::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    eprosima::fastdds::rtps::CacheChange_t change_writer1;
+    INIT_CACHE_CHANGE(change_writer1, writer1, 1);
+    eprosima::fastdds::rtps::CacheChange_t change_writer2;
+    INIT_CACHE_CHANGE(change_writer2, writer1, 2);
+    eprosima::fastdds::rtps::CacheChange_t change_writer3;
+    INIT_CACHE_CHANGE(change_writer3, writer1, 3);
+    eprosima::fastdds::rtps::CacheChange_t change_writer4;
+    INIT_CACHE_CHANGE(change_writer4, writer1, 4);
+    eprosima::fastdds::rtps::CacheChange_t change_writer5;
+    INIT_CACHE_CHANGE(change_writer5, writer1, 5);
+    eprosima::fastdds::rtps::CacheChange_t change_writer6;
+    INIT_CACHE_CHANGE(change_writer6, writer1, 6);
+
+    // Send 6 samples using add_new_sample. The first two are sent in a burst, and the rest are paced.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer5,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer6,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(6);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(30));
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
+
+TYPED_TEST(FlowControllerPublishModes, token_bucket_publish_mode_sender_threads_rate)
+{
+    // The sender threads share the bucket, so a single writer gets the whole rate of one sample each 10ms.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.max_burst_bytes = 20400;
+    flow_controller_descr.sender_threads = 4;
+    FlowControllerTokenBucketPublishModeMock::get_groups().clear();
+    FlowControllerImpl<FlowControllerTokenBucketPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+    // Priority schedulers run on a single sender thread.
+    ASSERT_EQ(expected_sender_threads<TypeParam>(4u), FlowControllerTokenBucketPublishModeMock::get_groups().size());
+
+    // Instantiate writers.
+    eprosima::fastdds::rtps::RTPSWriter writer1;
+
+    // Only the sender thread of the writer processes bytes.
+    for (eprosima::fastdds::rtps::RTPSMessageGroup* group : FlowControllerTokenBucketPublishModeMock::get_groups())
+    {
+        EXPECT_CALL(*group,
+                get_current_bytes_processed()).WillRepeatedly(ReturnPointee(&this->current_bytes_processed));
+        EXPECT_CALL(*group,
+                reset_current_bytes_processed()).WillRepeatedly([&]()
+                {
+                    this->current_bytes_processed = 0;
+                });
+    }
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastdds::rtps::CacheChange_t* change,
+        eprosima::fastdds::rtps::RTPSMessageGroup&,
+        eprosima::fastdds::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->current_bytes_processed += change->serializedPayload.length;
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->last_thread_delivering_sample = std::this_thread::get_id();
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    std::vector<eprosima::fastdds::rtps::CacheChange_t> changes(22);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        INIT_CACHE_CHANGE(changes[i], writer1, i + 1);
+    }
+
+    // Send 22 samples. The first two are sent in a burst, and the rest are paced at the full rate, which takes
+    // around 200ms. A quarter of the rate for each thread would take more than 400ms.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    for (eprosima::fastdds::rtps::CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &change,
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(changes.size());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(180));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(350));
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_sender_threads)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.sender_threads = 4;
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    // Instantiate writers.
+    eprosima::fastdds::rtps::RTPSWriter writer1;
+    eprosima::fastdds::rtps::RTPSWriter writer2;
+    eprosima::fastdds::rtps::RTPSWriter writer3;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        eprosima::fastdds::rtps::CacheChange_t* change,
+        eprosima::fastdds::rtps::RTPSMessageGroup&,
+        eprosima::fastdds::rtps::LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->last_thread_delivering_sample = std::this_thread::get_id();
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+
+    eprosima::fastdds::rtps::CacheChange_t change_writer1_1;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    eprosima::fastdds::rtps::CacheChange_t change_writer1_2;
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    eprosima::fastdds::rtps::CacheChange_t change_writer2_1;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    eprosima::fastdds::rtps::CacheChange_t change_writer2_2;
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    eprosima::fastdds::rtps::CacheChange_t change_writer3_1;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    eprosima::fastdds::rtps::CacheChange_t change_writer3_2;
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+
+    // Samples of each writer are delivered in order, whichever sender thread serves it.
+    {
+        InSequence seq;
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&change_writer1_1, _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer1,
+                deliver_sample_nts(&change_writer1_2, _, Ref(writer1.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    }
+    {
+        InSequence seq;
+        EXPECT_CALL(writer2,
+                deliver_sample_nts(&change_writer2_1, _, Ref(writer2.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer2,
+                deliver_sample_nts(&change_writer2_2, _, Ref(writer2.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    }
+    {
+        InSequence seq;
+        EXPECT_CALL(writer3,
+                deliver_sample_nts(&change_writer3_1, _, Ref(writer3.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+        EXPECT_CALL(writer3,
+                deliver_sample_nts(&change_writer3_2, _, Ref(writer3.async_locator_selector_), _)).
+                WillOnce(DoAll(send_functor, Return(eprosima::fastdds::rtps::DeliveryRetCode::DELIVERED)));
+    }
+
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+    writer3.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer3.getMutex().unlock();
+    this->wait_changes_was_delivered(6);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+}
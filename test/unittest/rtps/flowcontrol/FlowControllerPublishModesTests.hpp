@@ -60,6 +60,16 @@ using Schedulers = ::testing::Types<eprosima::fastdds::rtps::FlowControllerFifoS
 
 TYPED_TEST_SUITE(FlowControllerPublishModes, Schedulers, );
 
+//! Number of sender threads the flow controller runs when asked for the given number with the scheduler.
+template<typename Scheduler>
+uint32_t expected_sender_threads(
+        uint32_t sender_threads)
+{
+    return std::is_same<eprosima::fastdds::rtps::FlowControllerHighPrioritySchedule, Scheduler>::value ||
+           std::is_same<eprosima::fastdds::rtps::FlowControllerPriorityWithReservationSchedule, Scheduler>::value ?
+           1u : sender_threads;
+}
+
 #define INIT_CACHE_CHANGE(change, writer, seq) \
     change.writerGUID = writer.getGuid(); \
     change.writer_info.previous = nullptr; \
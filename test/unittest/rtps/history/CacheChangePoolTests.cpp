@@ -19,7 +19,11 @@
 
 #include <rtps/history/CacheChangePool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastdds::rtps;
 using namespace ::testing;
@@ -224,6 +228,108 @@ TEST_P(CacheChangePoolTests, change_reset_on_release)
     }
 }
 
+TEST_P(CacheChangePoolTests, concurrent_reserve_release)
+{
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_iterations = 10000;
+
+    // Changes are reserved and released from several threads without any external lock
+    std::atomic<uint32_t> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (uint32_t i = 0; i < num_iterations; ++i)
+                    {
+                        CacheChange_t* ch = nullptr;
+                        if (!pool->reserve_cache(ch))
+                        {
+                            ++failures;
+                            continue;
+                        }
+                        ch->sequenceNumber.low = i;
+                        pool->release_cache(ch);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every limit allows at least as many changes as threads
+    EXPECT_EQ(0u, failures.load());
+    if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)
+    {
+        EXPECT_EQ(0u, pool->get_allCachesSize());
+    }
+    else
+    {
+        EXPECT_EQ(pool->get_allCachesSize(), pool->get_freeCachesSize());
+        if (max_pool_size > 0)
+        {
+            EXPECT_LE(pool->get_allCachesSize(), std::max(pool_size, max_pool_size));
+        }
+    }
+}
+
+TEST_P(CacheChangePoolTests, spare_reservations)
+{
+    // Warm the free list, which is the only source of spare changes
+    CacheChange_t* ch = nullptr;
+    ASSERT_TRUE(pool->reserve_cache(ch));
+    ASSERT_TRUE(pool->release_cache(ch));
+
+    std::vector<CacheChange_t*> spare_changes;
+    for (uint32_t i = 0; i <= CacheChangePool::max_spare_reservations; ++i)
+    {
+        ch = nullptr;
+        if (!pool->reserve_spare_cache(ch))
+        {
+            break;
+        }
+        spare_changes.push_back(ch);
+    }
+
+    if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)
+    {
+        // Released changes are destroyed, so there is never a free one
+        EXPECT_TRUE(spare_changes.empty());
+        return;
+    }
+    ASSERT_FALSE(spare_changes.empty());
+    EXPECT_LE(spare_changes.size(), CacheChangePool::max_spare_reservations);
+
+    // Outstanding spare changes do not reduce the number of changes which can be reserved
+    uint32_t max_size = max_pool_size > 0 ? std::max(pool_size, max_pool_size) : 100u;
+    std::vector<CacheChange_t*> changes;
+    for (uint32_t i = 0; i < max_size; ++i)
+    {
+        ch = nullptr;
+        ASSERT_TRUE(pool->reserve_cache(ch));
+        changes.push_back(ch);
+    }
+    if (max_pool_size > 0)
+    {
+        EXPECT_LE(pool->get_allCachesSize(), max_size + spare_changes.size());
+    }
+
+    // A kept spare change is then released as any other change
+    pool->keep_spare_cache(spare_changes.back());
+    changes.push_back(spare_changes.back());
+    spare_changes.pop_back();
+    for (CacheChange_t* spare_change : spare_changes)
+    {
+        pool->release_spare_cache(spare_change);
+    }
+    for (CacheChange_t* change : changes)
+    {
+        ASSERT_TRUE(pool->release_cache(change));
+    }
+    EXPECT_EQ(pool->get_allCachesSize(), pool->get_freeCachesSize());
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -17,7 +17,10 @@
 #include <rtps/history/TopicPayloadPool.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 
+#include <atomic>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastdds::rtps;
 using namespace ::testing;
@@ -483,6 +486,63 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+//! Payloads released by a thread are found by the rest, and the preallocated pool never grows beyond its size
+TEST(TopicPayloalPoolTests, preallocated_concurrent_get_release)
+{
+    constexpr uint32_t num_payloads = 16;
+    constexpr uint32_t num_threads = 8;
+    constexpr uint32_t num_iterations = 10000;
+
+    PoolConfig config{ PREALLOCATED_MEMORY_MODE, 128, num_payloads, num_payloads };
+    std::shared_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+    ASSERT_EQ(num_payloads, pool->payload_pool_allocated_size());
+
+    // All the payloads are taken on this thread and released on another one
+    std::vector<SerializedPayload_t> payloads(num_payloads);
+    for (SerializedPayload_t& payload : payloads)
+    {
+        ASSERT_TRUE(pool->get_payload(128, payload));
+    }
+    std::thread([&]()
+            {
+                for (SerializedPayload_t& payload : payloads)
+                {
+                    pool->release_payload(payload);
+                }
+            }).join();
+
+    std::atomic<uint32_t> failures{ 0 };
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (uint32_t i = 0; i < num_iterations; ++i)
+                    {
+                        SerializedPayload_t payload;
+                        if (!pool->get_payload(128, payload))
+                        {
+                            ++failures;
+                            continue;
+                        }
+                        payload.data[0] = static_cast<octet>(i);
+                        pool->release_payload(payload);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // There are more payloads than threads, so every thread should always find one
+    EXPECT_EQ(0u, failures.load());
+    EXPECT_EQ(num_payloads, pool->payload_pool_allocated_size());
+    EXPECT_EQ(num_payloads, pool->payload_pool_available_size());
+    EXPECT_TRUE(pool->release_history(config, false));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -19,7 +19,8 @@
     FRIEND_TEST(WriterProxyTests, MissingChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, LostChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, ReceivedChangeSet); \
-    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet);
+    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet); \
+    FRIEND_TEST(WriterProxyTests, ReceivedChangeSetLargeGaps);
 
 #include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
@@ -686,6 +687,56 @@ TEST(WriterProxyTests, IrrelevantChangeSet)
     ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 9)), 0u);
 }
 
+TEST(WriterProxyTests, ReceivedChangeSetLargeGaps)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    EXPECT_CALL(readerMock, getEventResource()).Times(1u);
+    WriterProxy wproxy(&readerMock,
+            RemoteLocatorsAllocationAttributes(),
+            ResourceLimitedContainerConfig());
+
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initial_acknack_delay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeat_response_delay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    // 1. Writer proxy receives DATA with sequence numbers 1, 100, 300 and 70000
+    // Sequence number 70000 is too far away from the first missing one to be kept on the bitmap window
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 1)));
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 70000)));
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 300)));
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 100)));
+    ASSERT_FALSE(wproxy.received_change_set(SequenceNumber_t(0, 100)));
+    ASSERT_FALSE(wproxy.received_change_set(SequenceNumber_t(0, 70000)));
+
+    SequenceNumberSet_t t1(SequenceNumber_t(0, 2));
+    t1.add_range(SequenceNumber_t(0, 2), SequenceNumber_t(0, 100));
+    t1.add_range(SequenceNumber_t(0, 101), SequenceNumber_t(0, 258));
+    ASSERT_THAT(t1, wproxy.missing_changes());
+    ASSERT_EQ(SequenceNumber_t(0, 1), wproxy.available_changes_max());
+    ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 300)));
+    ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 70000)));
+    ASSERT_FALSE(wproxy.change_was_received(SequenceNumber_t(0, 69999)));
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 301)), 297u);
+    ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 70001)), 69996u);
+
+    // 2. Writer proxy receives a GAP up to sequence number 70000
+    // Sequence numbers 100 and 300 were received, and 70000 becomes available.
+    ASSERT_EQ(wproxy.lost_changes_update(SequenceNumber_t(0, 70000)), 69996);
+    ASSERT_EQ(SequenceNumber_t(0, 70000), wproxy.available_changes_max());
+    ASSERT_EQ(wproxy.are_there_missing_changes(), false);
+
+    // 3. Writer proxy receives DATA with sequence numbers 70002 and then 70001
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 70002)));
+    SequenceNumberSet_t t2(SequenceNumber_t(0, 70001));
+    t2.add(SequenceNumber_t(0, 70001));
+    ASSERT_THAT(t2, wproxy.missing_changes());
+    ASSERT_TRUE(wproxy.received_change_set(SequenceNumber_t(0, 70001)));
+    ASSERT_EQ(SequenceNumber_t(0, 70002), wproxy.available_changes_max());
+    ASSERT_EQ(wproxy.are_there_missing_changes(), false);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
@@ -28,6 +28,9 @@ public:
     void SetUp()
     {
         service_ = new eprosima::fastdds::rtps::ResourceEvent();
+#if TIMED_EVENT_TESTS_USE_TIMING_WHEEL
+        service_->use_timing_wheel(true);
+#endif // if TIMED_EVENT_TESTS_USE_TIMING_WHEEL
         service_->init_thread();
     }
 
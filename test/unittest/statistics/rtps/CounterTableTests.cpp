@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/Locator.h>
+
+#include <statistics/rtps/CounterTable.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastdds::statistics;
+
+struct TestCounters
+{
+    std::atomic<uint64_t> count{0};
+};
+
+using TestTable = CounterTable<Locator_t, TestCounters, LocatorHash>;
+
+static Locator_t test_locator(
+        uint32_t index)
+{
+    Locator_t locator(LOCATOR_KIND_UDPv4, 7400u + (index % 16u));
+    locator.address[12] = 192;
+    locator.address[13] = 168;
+    locator.address[14] = static_cast<octet>(index >> 8u);
+    locator.address[15] = static_cast<octet>(index);
+    return locator;
+}
+
+/*
+ * Check that every key gets its own counters, and that looking a key up again returns the same ones.
+ */
+TEST(CounterTableTests, get_returns_same_entry)
+{
+    // Few buckets, so several keys share each bucket
+    TestTable table(4u);
+
+    for (uint32_t i = 0; i < 100u; ++i)
+    {
+        table.get(test_locator(i)).count += i;
+    }
+
+    for (uint32_t i = 0; i < 100u; ++i)
+    {
+        EXPECT_EQ(i, table.get(test_locator(i)).count.load());
+    }
+
+    std::set<const TestCounters*> entries;
+    uint32_t num_entries = 0;
+    table.for_each([&](const Locator_t&, const TestCounters& counters)
+            {
+                entries.insert(&counters);
+                ++num_entries;
+            });
+    EXPECT_EQ(100u, num_entries);
+    EXPECT_EQ(100u, entries.size());
+}
+
+/*
+ * Check that threads adding the same keys at the same time end up sharing a single entry per key.
+ */
+TEST(CounterTableTests, concurrent_get)
+{
+    constexpr uint32_t num_threads = 8u;
+    constexpr uint32_t num_keys = 64u;
+    constexpr uint32_t num_rounds = 1000u;
+
+    TestTable table(8u);
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&table, &start, t]()
+                {
+                    while (!start)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    for (uint32_t round = 0; round < num_rounds; ++round)
+                    {
+                        for (uint32_t k = 0; k < num_keys; ++k)
+                        {
+                            // Each thread goes through the keys on a different order
+                            uint32_t key = (k + t * 7u) % num_keys;
+                            table.get(test_locator(key)).count.fetch_add(1u, std::memory_order_relaxed);
+                        }
+                    }
+                });
+    }
+
+    start = true;
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    uint32_t num_entries = 0;
+    table.for_each([&](const Locator_t&, const TestCounters& counters)
+            {
+                EXPECT_EQ(num_threads * num_rounds, counters.count.load());
+                ++num_entries;
+            });
+    EXPECT_EQ(num_keys, num_entries);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,309 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/LocatorList.hpp>
+
+#include <rtps/transport/compression/CompressionPeers.hpp>
+#include <rtps/transport/compression/LZCodec.hpp>
+#include <rtps/transport/compression/MessageCompressor.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+namespace {
+
+constexpr octet USER_WRITER_KIND = 0x03;
+constexpr octet BUILTIN_WRITER_KIND = 0xC2;
+
+/**
+ * Build an RTPS message with an INFO_TS submessage followed by a DATA submessage.
+ * @param writer_kind Entity kind of the writer of the DATA submessage.
+ * @param payload Serialized payload of the DATA submessage.
+ */
+std::vector<octet> make_message(
+        octet writer_kind,
+        const std::vector<octet>& payload)
+{
+    std::vector<octet> message = {'R', 'T', 'P', 'S', 2, 3, 1, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+    // INFO_TS, little endian.
+    const octet info_ts[] = {0x09, 0x01, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+    message.insert(message.end(), std::begin(info_ts), std::end(info_ts));
+
+    // DATA, little endian with serialized payload.
+    uint16_t length = static_cast<uint16_t>(20 + payload.size());
+    const octet data[] = {
+        0x15, 0x05, static_cast<octet>(length), static_cast<octet>(length >> 8),
+        0, 0, 16, 0,                 // extraFlags, octetsToInlineQos
+        0, 0, 0, 0,                  // readerId
+        0, 0, 1, writer_kind,        // writerId
+        0, 0, 0, 0, 1, 0, 0, 0       // writerSN
+    };
+    message.insert(message.end(), std::begin(data), std::end(data));
+    message.insert(message.end(), payload.begin(), payload.end());
+    return message;
+}
+
+std::vector<octet> repetitive_payload(
+        size_t size)
+{
+    std::vector<octet> payload(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        payload[i] = static_cast<octet>((i / 4) % 16);
+    }
+    return payload;
+}
+
+std::vector<octet> random_payload(
+        size_t size)
+{
+    std::mt19937 generator(1234);
+    std::vector<octet> payload(size);
+    for (octet& byte : payload)
+    {
+        byte = static_cast<octet>(generator());
+    }
+    return payload;
+}
+
+Locator make_locator(
+        int32_t kind,
+        uint32_t port)
+{
+    Locator locator;
+    locator.kind = kind;
+    locator.port = port;
+    locator.address[15] = 1;
+    return locator;
+}
+
+void split(
+        const CompressionPeers& peers,
+        const LocatorList& destinations,
+        std::vector<Locator>& compressed,
+        std::vector<Locator>& plain)
+{
+    Locators begin(destinations.begin());
+    Locators end(destinations.end());
+    peers.split_destinations(begin, end, compressed, plain);
+    EXPECT_TRUE(begin == end);
+}
+
+void check_round_trip(
+        const std::vector<octet>& input)
+{
+    std::vector<octet> compressed(LZCodec::compress_bound(input.size()));
+    size_t compressed_size = LZCodec::compress(input.data(), input.size(), compressed.data(), compressed.size());
+    ASSERT_NE(0u, compressed_size);
+
+    std::vector<octet> output(input.size());
+    ASSERT_TRUE(LZCodec::decompress(compressed.data(), compressed_size, output.data(), output.size()));
+    ASSERT_EQ(input, output);
+}
+
+} // namespace
+
+TEST(LZCodecTests, round_trip)
+{
+    check_round_trip({});
+    check_round_trip({'a'});
+    check_round_trip(std::vector<octet>(12, 'b'));
+    check_round_trip(std::vector<octet>(100000, 0));
+    check_round_trip(repetitive_payload(70000));
+    check_round_trip(random_payload(4096));
+
+    std::string text;
+    for (int i = 0; i < 200; ++i)
+    {
+        text += "{\"id\": " + std::to_string(i) + ", \"name\": \"sensor\", \"status\": \"ok\"}\n";
+    }
+    check_round_trip(std::vector<octet>(text.begin(), text.end()));
+}
+
+TEST(LZCodecTests, compresses_repetitive_data)
+{
+    std::vector<octet> input = repetitive_payload(16384);
+    std::vector<octet> compressed(LZCodec::compress_bound(input.size()));
+    size_t compressed_size = LZCodec::compress(input.data(), input.size(), compressed.data(), compressed.size());
+    EXPECT_NE(0u, compressed_size);
+    EXPECT_LT(compressed_size, input.size() / 10);
+}
+
+TEST(LZCodecTests, output_too_small)
+{
+    std::vector<octet> input = random_payload(1024);
+    std::vector<octet> compressed(512);
+    EXPECT_EQ(0u, LZCodec::compress(input.data(), input.size(), compressed.data(), compressed.size()));
+}
+
+TEST(LZCodecTests, malformed_blocks)
+{
+    std::vector<octet> input = repetitive_payload(4096);
+    std::vector<octet> compressed(LZCodec::compress_bound(input.size()));
+    size_t compressed_size = LZCodec::compress(input.data(), input.size(), compressed.data(), compressed.size());
+    ASSERT_NE(0u, compressed_size);
+    std::vector<octet> output(input.size());
+
+    // Wrong decompressed size.
+    EXPECT_FALSE(LZCodec::decompress(compressed.data(), compressed_size, output.data(), output.size() - 1));
+    // Truncated block.
+    EXPECT_FALSE(LZCodec::decompress(compressed.data(), compressed_size - 3, output.data(), output.size()));
+    // Offset pointing before the start of the output.
+    const octet bad_offset[] = {0x10, 'a', 0x10, 0x00, 0x00};
+    EXPECT_FALSE(LZCodec::decompress(bad_offset, sizeof(bad_offset), output.data(), 5));
+    // Literal length going past the end of the block.
+    const octet bad_literals[] = {0xF0, 0xFF, 0xFF};
+    EXPECT_FALSE(LZCodec::decompress(bad_literals, sizeof(bad_literals), output.data(), output.size()));
+}
+
+TEST(MessageCompressorTests, round_trip)
+{
+    MessageCompressor compressor(CompressionMode::ALWAYS, 256, 10, 32);
+    std::vector<octet> message = make_message(USER_WRITER_KIND, repetitive_payload(4000));
+    std::vector<octet> frame;
+
+    ASSERT_TRUE(compressor.encode(message.data(), static_cast<uint32_t>(message.size()), frame));
+    EXPECT_LT(frame.size(), message.size());
+    EXPECT_EQ(0, std::memcmp(frame.data(), "RTPZ", 4));
+
+    std::vector<octet> decoded;
+    ASSERT_EQ(MessageCompressor::DecodeResult::DECOMPRESSED,
+            MessageCompressor::decode(frame.data(), static_cast<uint32_t>(frame.size()), 65500, decoded));
+    EXPECT_EQ(message, decoded);
+
+    // Messages bigger than the receiver accepts are discarded.
+    EXPECT_EQ(MessageCompressor::DecodeResult::INVALID,
+            MessageCompressor::decode(frame.data(), static_cast<uint32_t>(frame.size()), 1000, decoded));
+
+    // Corrupted frames are discarded.
+    frame[4] = 0x7F;
+    EXPECT_EQ(MessageCompressor::DecodeResult::INVALID,
+            MessageCompressor::decode(frame.data(), static_cast<uint32_t>(frame.size()), 65500, decoded));
+}
+
+TEST(MessageCompressorTests, uncompressed_messages_pass_through)
+{
+    std::vector<octet> message = make_message(USER_WRITER_KIND, repetitive_payload(4000));
+    std::vector<octet> decoded;
+    EXPECT_EQ(MessageCompressor::DecodeResult::NOT_COMPRESSED,
+            MessageCompressor::decode(message.data(), static_cast<uint32_t>(message.size()), 65500, decoded));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(MessageCompressorTests, only_user_data_is_compressed)
+{
+    MessageCompressor compressor(CompressionMode::ALWAYS, 256, 10, 32);
+    std::vector<octet> frame;
+
+    std::vector<octet> builtin = make_message(BUILTIN_WRITER_KIND, repetitive_payload(4000));
+    EXPECT_FALSE(MessageCompressor::carries_user_data(builtin.data(), static_cast<uint32_t>(builtin.size())));
+    EXPECT_FALSE(compressor.encode(builtin.data(), static_cast<uint32_t>(builtin.size()), frame));
+
+    std::vector<octet> small = make_message(USER_WRITER_KIND, repetitive_payload(100));
+    EXPECT_TRUE(MessageCompressor::carries_user_data(small.data(), static_cast<uint32_t>(small.size())));
+    EXPECT_FALSE(compressor.encode(small.data(), static_cast<uint32_t>(small.size()), frame));
+
+    MessageCompressor disabled(CompressionMode::NONE, 256, 10, 32);
+    std::vector<octet> message = make_message(USER_WRITER_KIND, repetitive_payload(4000));
+    EXPECT_FALSE(disabled.encode(message.data(), static_cast<uint32_t>(message.size()), frame));
+}
+
+TEST(MessageCompressorTests, adaptive_mode_skips_poor_ratios)
+{
+    const uint32_t adaptive_skip = 4;
+    MessageCompressor compressor(CompressionMode::ADAPTIVE, 256, 10, adaptive_skip);
+    std::vector<octet> random = make_message(USER_WRITER_KIND, random_payload(4000));
+    std::vector<octet> repetitive = make_message(USER_WRITER_KIND, repetitive_payload(4000));
+    std::vector<octet> frame;
+
+    // Random data does not compress, so the next messages are sent uncompressed without trying.
+    EXPECT_FALSE(compressor.encode(random.data(), static_cast<uint32_t>(random.size()), frame));
+    for (uint32_t i = 0; i < adaptive_skip; ++i)
+    {
+        EXPECT_FALSE(compressor.encode(repetitive.data(), static_cast<uint32_t>(repetitive.size()), frame));
+    }
+
+    // Compression is probed again afterwards.
+    EXPECT_TRUE(compressor.encode(repetitive.data(), static_cast<uint32_t>(repetitive.size()), frame));
+
+    // ALWAYS mode keeps trying.
+    MessageCompressor always(CompressionMode::ALWAYS, 256, 10, adaptive_skip);
+    EXPECT_FALSE(always.encode(random.data(), static_cast<uint32_t>(random.size()), frame));
+    EXPECT_TRUE(always.encode(repetitive.data(), static_cast<uint32_t>(repetitive.size()), frame));
+}
+
+TEST(CompressionPeersTests, only_announced_locators_receive_compressed_messages)
+{
+    CompressionPeers peers;
+    Locator udp_peer = make_locator(LOCATOR_KIND_UDPv4, 7411);
+    Locator tcp_peer = make_locator(LOCATOR_KIND_TCPv4, 7412);
+    Locator udp_other = make_locator(LOCATOR_KIND_UDPv4, 7413);
+
+    LocatorList peer_locators;
+    peer_locators.push_back(udp_peer);
+    peer_locators.push_back(tcp_peer);
+    LocatorList destinations;
+    destinations.push_back(udp_peer);
+    destinations.push_back(tcp_peer);
+    destinations.push_back(udp_other);
+
+    std::vector<Locator> compressed;
+    std::vector<Locator> plain;
+
+    // Nothing is compressed until a participant announces it receives compressed messages.
+    split(peers, destinations, compressed, plain);
+    EXPECT_TRUE(compressed.empty());
+    EXPECT_EQ(3u, plain.size());
+
+    // Only the locators of the kinds announced by the participant are compressed.
+    std::string kinds = CompressionPeers::format_kinds({LOCATOR_KIND_UDPv4, LOCATOR_KIND_SHM});
+    EXPECT_EQ(std::to_string(LOCATOR_KIND_UDPv4) + "," + std::to_string(LOCATOR_KIND_SHM), kinds);
+    peers.add_peer(peer_locators, kinds);
+    split(peers, destinations, compressed, plain);
+    ASSERT_EQ(1u, compressed.size());
+    EXPECT_TRUE(udp_peer == compressed[0]);
+    ASSERT_EQ(2u, plain.size());
+    EXPECT_TRUE(tcp_peer == plain[0]);
+    EXPECT_TRUE(udp_other == plain[1]);
+
+    // A locator announced twice is kept until both announcements are removed.
+    peers.add_peer(peer_locators, kinds);
+    peers.remove_peer(peer_locators, kinds);
+    split(peers, destinations, compressed, plain);
+    EXPECT_EQ(1u, compressed.size());
+    peers.remove_peer(peer_locators, kinds);
+    split(peers, destinations, compressed, plain);
+    EXPECT_TRUE(compressed.empty());
+    EXPECT_EQ(3u, plain.size());
+
+    // Kinds are matched as a whole.
+    peers.add_peer(peer_locators, "11");
+    split(peers, destinations, compressed, plain);
+    EXPECT_TRUE(compressed.empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
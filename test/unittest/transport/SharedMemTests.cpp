@@ -1419,6 +1419,48 @@ TEST_F(SHMTransportTests, port_not_ok_listener_recover)
     thread_listener.join();
 }
 
+TEST_F(SHMTransportTests, spinning_listener)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    shared_mem_manager->global_segment()->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    // The budget is longer than the test, so the listener never blocks on the port
+    auto listener = read_port->create_listener(10000000u);
+    auto write_port = shared_mem_manager->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto data_segment = shared_mem_manager->create_segment(4, 4);
+
+    std::thread thread_listener([&]
+            {
+                for (uint8_t i = 1; i <= 3; ++i)
+                {
+                    auto buff = listener->pop();
+                    ASSERT_TRUE(buff != nullptr);
+                    EXPECT_EQ(*static_cast<uint8_t*>(buff->data()), i);
+                    listener->stop_processing_buffer();
+                }
+
+                // Closing the listener breaks the spin
+                EXPECT_TRUE(listener->pop() == nullptr);
+            });
+
+    for (uint8_t i = 1; i <= 3; ++i)
+    {
+        // Let the listener go back to spinning, so the push does not notify it
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        auto buffer = data_segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+        ASSERT_TRUE(buffer != nullptr);
+        *static_cast<uint8_t*>(buffer->data()) = i;
+        bool is_port_ok = false;
+        ASSERT_TRUE(write_port->try_push(buffer, is_port_ok));
+        ASSERT_TRUE(is_port_ok);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    listener->close();
+    thread_listener.join();
+}
+
 //! This test has been updated to avoid flakiness #20993
 TEST_F(SHMTransportTests, buffer_recover)
 {
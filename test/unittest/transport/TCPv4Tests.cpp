@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <thread>
@@ -31,6 +32,7 @@
 #include <MockReceiverResource.h>
 
 #include <rtps/transport/tcp/RTCPHeader.h>
+#include <rtps/transport/tcp/TCPMessageAssembler.h>
 #include <rtps/transport/TCPv4Transport.h>
 #include <utils/Semaphore.hpp>
 
@@ -78,6 +80,9 @@ public:
 
     void HELPER_SetDescriptorDefaults();
 
+    void HELPER_receive_unordered_data(
+            uint32_t reactor_threads);
+
     TCPv4TransportDescriptor descriptor;
     TCPv4TransportDescriptor descriptorOnlyOutput;
     std::unique_ptr<std::thread> senderThread;
@@ -1799,7 +1804,8 @@ TEST_F(TCPv4Tests, send_and_receive_between_blocked_interfaces_ports)
 
 #endif // ifndef __APPLE__
 
-TEST_F(TCPv4Tests, receive_unordered_data)
+void TCPv4Tests::HELPER_receive_unordered_data(
+        uint32_t reactor_threads)
 {
     constexpr uint16_t logical_port = 7410;
     constexpr uint32_t num_bytes_1 = 3;
@@ -1848,6 +1854,7 @@ TEST_F(TCPv4Tests, receive_unordered_data)
 
     TCPv4TransportDescriptor test_descriptor = descriptor;
     test_descriptor.check_crc = false;
+    test_descriptor.reactor_threads = reactor_threads;
     TCPv4Transport uut(test_descriptor);
     ASSERT_TRUE(uut.init()) << "Failed to initialize transport. Port " << g_default_port << " may be in use";
 
@@ -1931,6 +1938,105 @@ TEST_F(TCPv4Tests, receive_unordered_data)
     EXPECT_TRUE(uut.CloseInputChannel(input_locator));
 }
 
+TEST_F(TCPv4Tests, receive_unordered_data)
+{
+    HELPER_receive_unordered_data(0);
+}
+
+// Same as receive_unordered_data, but with the connections served by a pool of reactor threads.
+TEST_F(TCPv4Tests, receive_unordered_data_reactor)
+{
+    HELPER_receive_unordered_data(2);
+}
+
+// This test verifies that the RTCP framing is parsed correctly when the bytes of a connection arrive in any amount.
+TEST_F(TCPv4Tests, message_assembler)
+{
+    constexpr uint32_t capacity = 16;
+    std::array<octet, capacity> buffer{ 0 };
+
+    // Build the byte stream of a connection
+    std::vector<octet> stream;
+    auto add_bytes = [&stream](const void* data, size_t size)
+            {
+                const octet* bytes = static_cast<const octet*>(data);
+                stream.insert(stream.end(), bytes, bytes + size);
+            };
+    auto add_message = [&stream, &add_bytes](uint32_t body_size, octet value)
+            {
+                TCPHeader header;
+                header.logical_port = 7410;
+                header.length += body_size;
+                add_bytes(&header, TCPHeader::size());
+                stream.insert(stream.end(), body_size, value);
+            };
+
+    add_message(3, 1);
+    add_bytes("-RTC", 4);
+    add_message(13, 2);
+    add_bytes("-RRT", 4);
+    add_message(capacity, 3);
+    // Message bigger than the buffer, which will be dropped
+    add_message(capacity * 2 + 1, 4);
+    // Header with a length smaller than the header itself, which will be skipped
+    TCPHeader bad_header;
+    bad_header.length = 3;
+    add_bytes(&bad_header, TCPHeader::size());
+    add_message(0, 0);
+    add_message(5, 6);
+
+    const std::vector<std::pair<uint32_t, octet>> expected =
+    {
+        {3, 1}, {13, 2}, {capacity, 3}, {0, 0}, {5, 6}
+    };
+
+    for (size_t chunk : {size_t(1), size_t(3), TCPHeader::size(), stream.size()})
+    {
+        TCPMessageAssembler assembler;
+        std::vector<std::pair<uint32_t, octet>> received;
+        size_t num_too_big = 0;
+
+        size_t pos = 0;
+        while (pos < stream.size())
+        {
+            octet* data = nullptr;
+            size_t size = 0;
+            assembler.prepare(buffer.data(), capacity, data, size);
+            ASSERT_LT(0u, size);
+            size = std::min(size, std::min(chunk, stream.size() - pos));
+            memcpy(data, &stream[pos], size);
+            pos += size;
+
+            switch (assembler.commit(size, capacity, DEFAULT_ENDIAN))
+            {
+                case TCPMessageAssembler::Result::MESSAGE_READY:
+                {
+                    uint32_t body_size = assembler.body_size();
+                    octet value = (0 < body_size) ? buffer[0] : 0;
+                    EXPECT_EQ(7410u, assembler.header().logical_port);
+                    EXPECT_TRUE(std::all_of(buffer.begin(), buffer.begin() + body_size, [value](octet b)
+                            {
+                                return b == value;
+                            }));
+                    received.emplace_back(body_size, value);
+                    break;
+                }
+
+                case TCPMessageAssembler::Result::MESSAGE_TOO_BIG:
+                    EXPECT_EQ(capacity * 2 + 1, assembler.body_size());
+                    ++num_too_big;
+                    break;
+
+                case TCPMessageAssembler::Result::INCOMPLETE:
+                    break;
+            }
+        }
+
+        EXPECT_EQ(expected, received) << "Reading chunks of " << chunk << " bytes";
+        EXPECT_EQ(1u, num_too_big) << "Reading chunks of " << chunk << " bytes";
+    }
+}
+
 // This test verifies that disabling a TCPChannelResource in the middle of a Receive call (invoked in
 // perform_listen_operation) does not result in a hungup state [13721].
 TEST_F(TCPv4Tests, header_read_interrumption)
@@ -813,6 +813,131 @@ TEST_F(UDPv4Tests, simple_throughput)
             , std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (num_samples_per_batch * 1000.0));
 }
 
+TEST_F(UDPv4Tests, send_and_receive_batched)
+{
+    constexpr uint8_t num_messages = 64;
+
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor batched_descriptor;
+    batched_descriptor.receive_batch_size = 16;
+
+    UDPv4Transport transportUnderTest(batched_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t input_locator;
+    input_locator.kind = LOCATOR_KIND_UDPv4;
+    input_locator.port = g_default_port;
+    IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+
+    MockReceiverResource receiver(transportUnderTest, input_locator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, input_locator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    // Datagrams should be dispatched in the same order they were sent
+    std::atomic<uint8_t> next_expected(0);
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(next_expected.load(), msg_recv->data[0]);
+                next_expected.store(static_cast<uint8_t>(msg_recv->data[0] + 1));
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(input_locator);
+    for (uint8_t i = 0; i < num_messages; ++i)
+    {
+        octet message[4] = { i, 'B', 'A', 'T' };
+        std::vector<NetworkBuffer> buffer_list;
+        buffer_list.emplace_back(message, sizeof(message));
+
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+        EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, sizeof(message), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+    }
+
+    for (uint8_t i = 0; i < num_messages; ++i)
+    {
+        sem.wait();
+    }
+    EXPECT_EQ(num_messages, next_expected.load());
+}
+
+TEST_F(UDPv4Tests, send_batched_to_several_destinations)
+{
+    constexpr size_t num_destinations = 5;
+
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor batched_descriptor;
+    batched_descriptor.send_batch_size = 2;
+
+    UDPv4Transport transportUnderTest(batched_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Semaphore sem;
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    LocatorList_t locator_list;
+    std::vector<std::unique_ptr<MockReceiverResource>> receivers;
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        Locator_t input_locator;
+        input_locator.kind = LOCATOR_KIND_UDPv4;
+        input_locator.port = static_cast<uint32_t>(g_default_port + i);
+        IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+        locator_list.push_back(input_locator);
+
+        receivers.emplace_back(new MockReceiverResource(transportUnderTest, input_locator));
+        MockMessageReceiver* msg_recv =
+                dynamic_cast<MockMessageReceiver*>(receivers.back()->CreateMessageReceiver());
+        msg_recv->setCallback([&, msg_recv]()
+                {
+                    EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                    sem.post();
+                });
+    }
+
+    eprosima::fastdds::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, *locator_list.begin()));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    std::vector<NetworkBuffer> buffer_list;
+    buffer_list.emplace_back(message, 2);
+    buffer_list.emplace_back(&message[2], 3);
+
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+    EXPECT_TRUE(send_resource_list.at(0)->send(buffer_list, sizeof(message), &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::milliseconds(100))));
+
+    // Each destination should receive the message exactly once
+    for (size_t i = 0; i < num_destinations; ++i)
+    {
+        sem.wait();
+    }
+}
+
+TEST_F(UDPv4Tests, wrong_receive_batch_size)
+{
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor wrong_descriptor;
+    wrong_descriptor.receive_batch_size = 1025;
+
+    UDPv4Transport transportUnderTest(wrong_descriptor);
+    ASSERT_FALSE(transportUnderTest.init());
+}
+
+TEST_F(UDPv4Tests, wrong_send_batch_size)
+{
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor wrong_descriptor;
+    wrong_descriptor.send_batch_size = 1025;
+
+    UDPv4Transport transportUnderTest(wrong_descriptor);
+    ASSERT_FALSE(transportUnderTest.init());
+}
+
 // Regression test for redmine issue #19587
 TEST_F(UDPv4Tests, double_binding_fails)
 {
@@ -45,6 +45,13 @@ uint32_t MockTCPChannelResource::read(
     return 0;
 }
 
+void MockTCPChannelResource::async_read_some(
+        octet*,
+        std::size_t,
+        ReadHandler)
+{
+}
+
 size_t MockTCPChannelResource::send(
         const octet*,
         size_t,
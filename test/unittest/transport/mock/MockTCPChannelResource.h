@@ -50,6 +50,11 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    void async_read_some(
+            octet* buffer,
+            std::size_t size,
+            ReadHandler handler) override;
+
     size_t send(
             const octet* header,
             size_t header_size,
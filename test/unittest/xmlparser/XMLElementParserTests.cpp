@@ -2126,6 +2126,13 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
             XMLP_ret::XML_ERROR}, // duplicated sender_thread tag
         {{"", "HIGH_PRIORITY", "120", "50", \
             "12345", "12", "12", "a", "" }, XMLP_ret::XML_ERROR},   // invalid thread settings
+        {{"test_flow_controller", "FIFO", "120", "50", \
+            "12", "12", "12", "12", "<max_burst_bytes>60</max_burst_bytes><sender_threads>2</sender_threads>" },
+            XMLP_ret::XML_OK},   // token bucket with several sender threads
+        {{"test_flow_controller", "FIFO", "120", "50", \
+            "12", "12", "12", "12", "<max_burst_bytes>-60</max_burst_bytes>" }, XMLP_ret::XML_ERROR},   // negative max_burst_bytes
+        {{"test_flow_controller", "FIFO", "120", "50", \
+            "12", "12", "12", "12", "<sender_threads>0</sender_threads>" }, XMLP_ret::XML_ERROR},   // no sender threads
     };
 
     /* Run the tests */
@@ -2182,6 +2189,11 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
                     static_cast<uint64_t>(std::stoi(params[6])));
             ASSERT_EQ(flow_controller_descriptor_list.at(0)->sender_thread.stack_size,
                     static_cast<int32_t>(std::stoi(params[7])));
+            if (!params[8].empty())
+            {
+                ASSERT_EQ(flow_controller_descriptor_list.at(0)->max_burst_bytes, 60u);
+                ASSERT_EQ(flow_controller_descriptor_list.at(0)->sender_threads, 2u);
+            }
         }
     }
 }
@@ -3692,6 +3704,7 @@ TEST_F(XMLParserTests, getXMLEnum_positive)
  * 7. Correct parsing of a valid <data_sharing> set to AUTO with shared memory directory.
  * 8. Correct parsing of a valid <data_sharing> set to ON with shared memory directory.
  * 9. Correct parsing of a valid <data_sharing> set to OFF with shared memory directory.
+ * 10. Correct parsing of a valid <data_sharing> with a listener spin budget.
  */
 TEST_F(XMLParserTests, getXMLDataSharingQos)
 {
@@ -3834,6 +3847,23 @@ TEST_F(XMLParserTests, getXMLDataSharingQos)
         EXPECT_EQ(datasharing_policy.shm_directory().size(), 0u);
         EXPECT_EQ(datasharing_policy.max_domains(), 0u);
         EXPECT_EQ(datasharing_policy.domain_ids().size(), 0u);
+        EXPECT_EQ(datasharing_policy.listener_spin_budget_us(), 0u);
+    }
+
+    {
+        const char* xml =
+                "\
+                <data_sharing>\
+                    <kind>ON</kind>\
+                    <listener_spin_budget_us>20</listener_spin_budget_us>\
+                </data_sharing>\
+                ";
+
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::propertiesPolicy_wrapper(titleElement, datasharing_policy, ident));
+        EXPECT_EQ(datasharing_policy.kind(), DataSharingKind::ON);
+        EXPECT_EQ(datasharing_policy.listener_spin_budget_us(), 20u);
     }
 }
 
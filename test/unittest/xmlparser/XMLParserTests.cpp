@@ -1055,6 +1055,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
                     <non_blocking_send>true</non_blocking_send>\
                     <tcp_negotiation_timeout>100</tcp_negotiation_timeout>\
+                    <reactor_threads>4</reactor_threads>\
                     <tls><!-- TLS Section --></tls>\
                     <keep_alive_thread>\
                         <scheduling_policy>12</scheduling_policy>\
@@ -1128,6 +1129,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv4Desc->reactor_threads, 4u);
         EXPECT_EQ(pTCPv4Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1164,6 +1166,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->non_blocking_send, true);
         EXPECT_EQ(pTCPv6Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->tcp_negotiation_timeout, 100u);
+        EXPECT_EQ(pTCPv6Desc->reactor_threads, 4u);
         EXPECT_EQ(pTCPv6Desc->default_reception_threads(), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->get_thread_config_for_port(12346), modified_thread_settings);
@@ -1184,6 +1187,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
+                    <listener_spin_budget_us>50</listener_spin_budget_us>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <default_reception_threads>\
@@ -1225,6 +1229,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
+        EXPECT_EQ(pSHMDesc->listener_spin_budget_us(), 50u);
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pSHMDesc->default_reception_threads(), modified_thread_settings);
@@ -1292,6 +1297,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "keep_alive_thread",
         "accept_thread",
         "tcp_negotiation_timeout",
+        "reactor_threads",
         "default_reception_threads",
         "reception_threads",
         "bad_element"
@@ -1305,6 +1311,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "port_queue_capacity",
         "healthy_check_timeout_ms",
         "rtps_dump_file",
+        "listener_spin_budget_us",
         "default_reception_threads",
         "reception_threads",
         "dump_thread",
@@ -1741,6 +1741,8 @@ TEST_F(XMLProfileParserBasicTests, UDP_transport_descriptors_config)
     EXPECT_EQ(descriptor->receiveBufferSize, 8192u);
     EXPECT_EQ(descriptor->TTL, 250u);
     EXPECT_EQ(descriptor->non_blocking_send, true);
+    EXPECT_EQ(descriptor->receive_batch_size, 16u);
+    EXPECT_EQ(descriptor->send_batch_size, 32u);
     EXPECT_EQ(descriptor->maxMessageSize, 16384u);
     EXPECT_EQ(descriptor->maxInitialPeersRange, 100u);
     EXPECT_EQ(descriptor->interfaceWhiteList.size(), 2u);